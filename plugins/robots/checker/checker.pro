@@ -16,5 +16,7 @@ TEMPLATE = subdirs
 
 SUBDIRS = \
 	twoDModelRunner \
+	trajectoryConverter \
+	generatorRunner \
 	patcher \
 	scripts \
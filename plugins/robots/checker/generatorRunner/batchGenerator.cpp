@@ -0,0 +1,127 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "batchGenerator.h"
+
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+#include <QtCore/QTextStream>
+
+#include <qrkernel/logging.h>
+#include <qrkernel/settingsManager.h>
+#include <generatorBase/robotsGeneratorPluginBase.h>
+
+using namespace generatorRunner;
+
+BatchGenerator::BatchGenerator()
+{
+	mQRealFacade.reset(new qReal::SystemFacade());
+	mProjectManager.reset(new qReal::ProjectManager(mQRealFacade->models()));
+	mErrorReporter.reset(new qReal::ConsoleErrorReporter());
+	mMainWindow.reset(new qReal::NullMainWindow(*mErrorReporter, mQRealFacade->events()
+				, &*mProjectManager, &mQRealFacade->models().graphicalModelAssistApi()));
+
+	mController.reset(new qReal::Controller());
+	mSceneCustomizer.reset(new qReal::gui::editor::SceneCustomizer());
+	mTextManager.reset(new qReal::NullTextManager());
+	mConfigurator.reset(new qReal::PluginConfigurator(mQRealFacade->models().repoControlApi()
+							 , mQRealFacade->models().graphicalModelAssistApi()
+							 , mQRealFacade->models().logicalModelAssistApi()
+							 , *mController
+							 , *mMainWindow
+							 , *mMainWindow
+							 , *mProjectManager
+							 , *mSceneCustomizer
+							 , mQRealFacade->events()
+							 , *mTextManager));
+	mPluginFacade.reset(new interpreterCore::RobotsPluginFacade());
+	mPluginFacade->init(*mConfigurator);
+	for (auto &&defaultSettingsFile : mPluginFacade->defaultSettingsFiles()) {
+		qReal::SettingsManager::loadDefaultSettings(defaultSettingsFile);
+	}
+
+	const interpreterCore::KitPluginManager &kitPluginManager = mPluginFacade->kitPluginManager();
+	for (const QString &kitId : kitPluginManager.kitIds()) {
+		for (kitBase::KitPluginInterface * const kit : kitPluginManager.kitsById(kitId)) {
+			const auto generator = dynamic_cast<generatorBase::RobotsGeneratorPluginBase *>(kit);
+			if (!generator) {
+				continue;
+			}
+
+			for (kitBase::robotModel::RobotModelInterface * const robotModel : generator->robotModels()) {
+				mTargets[robotModel->name()] = Target{generator, robotModel};
+			}
+		}
+	}
+}
+
+BatchGenerator::~BatchGenerator()
+{
+	mTargets.clear();
+	mPluginFacade.reset();
+	mConfigurator.reset();
+	mTextManager.reset();
+	mSceneCustomizer.reset();
+	mController.reset();
+	mMainWindow.reset();
+	mErrorReporter.reset();
+	mProjectManager.reset();
+	mQRealFacade.reset();
+}
+
+QStringList BatchGenerator::targets() const
+{
+	return mTargets.keys();
+}
+
+QString BatchGenerator::friendlyTargetName(const QString &target) const
+{
+	const auto it = mTargets.constFind(target);
+	return it == mTargets.constEnd() ? QString() : it->robotModel->friendlyName();
+}
+
+bool BatchGenerator::generate(const QString &saveFile, const QStringList &targets, const QString &outputFolder)
+{
+	QLOG_INFO() << "Generating code for" << saveFile;
+	if (!mProjectManager->open(saveFile)) {
+		QLOG_ERROR() << "Can not open" << saveFile;
+		QTextStream(stderr) << QObject::tr("Can not open %1").arg(saveFile) << endl;
+		return false;
+	}
+
+	bool success = true;
+	for (const QString &target : targets) {
+		const auto it = mTargets.constFind(target);
+		if (it == mTargets.constEnd()) {
+			QTextStream(stderr) << QObject::tr("Unknown target %1").arg(target) << endl;
+			success = false;
+			continue;
+		}
+
+		// Generators take ports configuration and other details from the current robot model.
+		mPluginFacade->robotModelManager().setModel(it->robotModel);
+
+		const QString folder = QDir(outputFolder).filePath(target);
+		const QString generatedFile = it->generator->generateCodeInto(folder);
+		if (generatedFile.isEmpty()) {
+			QLOG_ERROR() << "Generation for" << target << "failed on" << saveFile;
+			QTextStream(stderr) << QObject::tr("Generation for %1 failed on %2").arg(target, saveFile) << endl;
+			success = false;
+		} else {
+			QTextStream(stdout) << generatedFile << endl;
+		}
+	}
+
+	return success;
+}
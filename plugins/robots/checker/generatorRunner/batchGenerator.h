@@ -0,0 +1,79 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QMap>
+#include <QtCore/QScopedPointer>
+
+#include <qrgui/systemFacade/systemFacade.h>
+#include <qrgui/systemFacade/components/consoleErrorReporter.h>
+#include <qrgui/systemFacade/components/nullMainWindow.h>
+#include <qrgui/systemFacade/components/projectManager.h>
+#include <qrgui/systemFacade/components/nullTextManager.h>
+#include <qrgui/controller/controller.h>
+#include <qrgui/editor/sceneCustomizer.h>
+#include <qrgui/plugins/toolPluginInterface/pluginConfigurator.h>
+#include <interpreterCore/robotsPluginFacade.h>
+
+namespace generatorBase {
+class RobotsGeneratorPluginBase;
+}
+
+namespace generatorRunner {
+
+/// Creates null QReal environment and robots plugin and generates code for save files without GUI.
+/// Editor plugins, kit plugins with their generators are loaded only once and are reused for all save files.
+class BatchGenerator : public QObject
+{
+	Q_OBJECT
+
+public:
+	BatchGenerator();
+	~BatchGenerator() override;
+
+	/// Returns a list of available generation targets. A target is identified by the name of the robot model
+	/// of a generator plugin, for example "TrikV62QtsGeneratorRobotModel".
+	QStringList targets() const;
+
+	/// Returns user-friendly name of the given target.
+	QString friendlyTargetName(const QString &target) const;
+
+	/// Opens the given save file and generates code for its main diagram by each of the given targets.
+	/// Code is written into outputFolder/<target> folder, so outputFolder must be unique for each save file.
+	/// @returns false if the save file could not be opened or there were errors for some target.
+	bool generate(const QString &saveFile, const QStringList &targets, const QString &outputFolder);
+
+private:
+	struct Target
+	{
+		generatorBase::RobotsGeneratorPluginBase *generator;
+		kitBase::robotModel::RobotModelInterface *robotModel;
+	};
+
+	QScopedPointer<qReal::SystemFacade> mQRealFacade;
+	QScopedPointer<qReal::Controller> mController;
+	QScopedPointer<qReal::ConsoleErrorReporter> mErrorReporter;
+	QScopedPointer<qReal::ProjectManager> mProjectManager;
+	QScopedPointer<qReal::NullMainWindow> mMainWindow;
+	QScopedPointer<qReal::NullTextManager> mTextManager;
+	QScopedPointer<qReal::gui::editor::SceneCustomizer> mSceneCustomizer;
+	QScopedPointer<qReal::PluginConfigurator> mConfigurator;
+	QScopedPointer<interpreterCore::RobotsPluginFacade> mPluginFacade;
+
+	/// Maps target names to generators and their robot models. Does not have ownership.
+	QMap<QString, Target> mTargets;
+};
+
+}
@@ -0,0 +1,40 @@
+# Copyright 2007-2015 QReal Research Group
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+TARGET = batch-generator
+TEMPLATE = app
+CONFIG += cmdline
+include(../../../../global.pri)
+
+QT += widgets xml
+
+includes(plugins/robots/interpreters/interpreterCore \
+		plugins/robots/common/kitBase \
+		plugins/robots/generators/generatorBase \
+		plugins/robots/utils \
+		qrtext \
+		qrgui \
+)
+
+links(qrkernel qrutils qrgui-tool-plugin-interface qrgui-preferences-dialog qrgui-facade \
+		qrgui-models qrgui-editor qrgui-plugin-manager qrgui-text-editor qrgui-controller \
+		robots-utils robots-kit-base robots-interpreter-core robots-generator-base \
+)
+
+HEADERS += \
+	$$PWD/batchGenerator.h \
+
+SOURCES += \
+	$$PWD/main.cpp \
+	$$PWD/batchGenerator.cpp \
@@ -0,0 +1,232 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QDir>
+#include <QtCore/QDirIterator>
+#include <QtCore/QHash>
+#include <QtCore/QProcess>
+#include <QtCore/QTextStream>
+#include <QtWidgets/QApplication>
+
+#include <qrkernel/logging.h>
+#include <qrkernel/platformInfo.h>
+#include <qrkernel/settingsManager.h>
+#include <interpreterCore/customizer.h>
+
+#include "batchGenerator.h"
+
+const int maxLogSize = 10 * 1024 * 1024;  // 10 MB
+
+/// Some save file could not be opened or generated.
+const int generationFailed = 1;
+/// A worker process crashed or could not be started.
+const int workerCrashed = 102;
+
+const QString description = QObject::tr(
+		"Generates code for TRIK Studio save files without programming environment. "\
+		"Editor and generator plugins are loaded once and reused for all given save files, folders are searched "\
+		"for save files recursively. Code for each save file and target is written into "\
+		"<output>/<path relative to given folder>/<save file name>/<target> folder.\n"\
+		"Example: \n") +
+		"    batch-generator --platform minimal --target TrikV62QtsGeneratorRobotModel --output generated "
+		"--jobs 4 examples";
+
+/// Save file and a folder relative to the output folder where code for it is written.
+struct SaveFile
+{
+	QString path;
+	QString outputFolder;
+};
+
+/// Collects save files from the given list of save files and folders. Code for save files found in a folder is
+/// written into the same subfolder of the output folder as the save file has in the given one, so files with the
+/// same name from different folders (like examples/trik and examples/ev3) do not overwrite each other.
+QList<SaveFile> saveFiles(const QStringList &paths)
+{
+	QList<SaveFile> result;
+	for (const QString &path : paths) {
+		const QFileInfo info(path);
+		if (!info.isDir()) {
+			result << SaveFile{path, info.completeBaseName()};
+			continue;
+		}
+
+		QDirIterator files(path, {"*.qrs"}, QDir::Files, QDirIterator::Subdirectories);
+		QStringList folderFiles;
+		while (files.hasNext()) {
+			folderFiles << files.next();
+		}
+
+		folderFiles.sort();
+		const QDir root(path);
+		for (const QString &file : folderFiles) {
+			const QFileInfo fileInfo(file);
+			const QString folder = root.relativeFilePath(fileInfo.path());
+			result << SaveFile{file, QDir::cleanPath(folder + "/" + fileInfo.completeBaseName())};
+		}
+	}
+
+	return result;
+}
+
+/// Reports save files that would be generated into the same output folder. Returns true if there are none.
+bool checkOutputFoldersUnique(const QList<SaveFile> &files)
+{
+	QHash<QString, QString> owners;
+	bool unique = true;
+	for (const SaveFile &file : files) {
+		const QString key = QDir::cleanPath(file.outputFolder);
+		if (owners.contains(key)) {
+			QLOG_ERROR() << file.path << "and" << owners[key] << "are both generated into" << key;
+			QTextStream(stderr) << QObject::tr("%1 and %2 would be generated into the same folder %3, "\
+					"pass them separately with different --output folders")
+					.arg(file.path, owners[key], key) << endl;
+			unique = false;
+		} else {
+			owners[key] = file.path;
+		}
+	}
+
+	return unique;
+}
+
+/// Distributes save files among given count of worker processes and waits for all of them.
+/// Each worker runs this application on the same paths and takes its part of save files with --worker option,
+/// so output folders are computed relative to the same roots as here. Since output folders of all save files
+/// are different, workers never write into the same folder.
+int generateInParallel(int files, const QStringList &paths, const QStringList &workerArguments, int jobs)
+{
+	QList<QProcess *> workers;
+	for (int i = 0; i < qMin(jobs, files); ++i) {
+		const QString part = QString("%1/%2").arg(i).arg(jobs);
+		QProcess * const worker = new QProcess(qApp);
+		worker->setProcessChannelMode(QProcess::ForwardedChannels);
+		worker->start(QCoreApplication::applicationFilePath(), workerArguments + QStringList{"--worker", part} + paths);
+		workers << worker;
+	}
+
+	int exitCode = 0;
+	for (QProcess * const worker : workers) {
+		if (!worker->waitForFinished(-1) || worker->exitStatus() != QProcess::NormalExit) {
+			exitCode = qMax(exitCode, workerCrashed);
+		} else {
+			exitCode = qMax(exitCode, worker->exitCode());
+		}
+	}
+
+	return exitCode;
+}
+
+int main(int argc, char *argv[])
+{
+	QApplication app(argc, argv);
+	QCoreApplication::setApplicationName("batch-generator");
+	QCoreApplication::setApplicationVersion(interpreterCore::Customizer::trikStudioVersion());
+
+	const auto &defaultPlatformConfigPath = qReal::PlatformInfo::defaultPlatformConfigPath();
+	if (!defaultPlatformConfigPath.isEmpty()) {
+		qReal::SettingsManager::instance()->loadSettings(defaultPlatformConfigPath);
+	}
+
+	qReal::Logger logger;
+	const QDir logsDir(qReal::PlatformInfo::invariantSettingsPath("pathToLogs"));
+	if (logsDir.mkpath(logsDir.absolutePath())) {
+		logger.addLogTarget(logsDir.filePath("batch-generator.log"), maxLogSize, 2);
+	}
+	QLOG_INFO() << "------------------- APPLICATION STARTED --------------------";
+	QLOG_INFO() << "Arguments:" << app.arguments();
+
+	QCommandLineParser parser;
+	parser.setApplicationDescription(description);
+	parser.addHelpOption();
+	parser.addVersionOption();
+	parser.addPositionalArgument("paths", QObject::tr("Save files or folders with save files."), "paths...");
+	QCommandLineOption targetOption({"t", "target"}, QObject::tr("Generation target, see --list-targets."\
+									" May be specified several times. All targets are used by default.")
+									, "target");
+	QCommandLineOption listTargetsOption("list-targets", QObject::tr("Prints available generation targets."));
+	QCommandLineOption outputOption({"o", "output"}, QObject::tr("A folder where generated code will be written.")
+									, "path-to-output", "generated");
+	QCommandLineOption jobsOption({"j", "jobs"}, QObject::tr("Process save files simultaneously in at most this"\
+									" count of separate processes.")
+									, "count", "1");
+	QCommandLineOption workerOption("worker", QObject::tr("Used internally by --jobs: process only save files with"\
+									" index modulo count equal to the given index.")
+									, "index/count");
+	parser.addOption(targetOption);
+	parser.addOption(listTargetsOption);
+	parser.addOption(outputOption);
+	parser.addOption(jobsOption);
+	parser.addOption(workerOption);
+
+	parser.process(app);
+
+	QList<SaveFile> files = saveFiles(parser.positionalArguments());
+	const int jobs = parser.value(jobsOption).toInt();
+	const QString output = parser.value(outputOption);
+	if (files.isEmpty() && !parser.isSet(listTargetsOption)) {
+		parser.showHelp();
+	}
+
+	if (!checkOutputFoldersUnique(files)) {
+		return generationFailed;
+	}
+
+	if (parser.isSet(workerOption)) {
+		const QStringList part = parser.value(workerOption).split('/');
+		const int index = part.value(0).toInt();
+		const int count = qMax(1, part.value(1).toInt());
+		QList<SaveFile> workerFiles;
+		for (int i = index; i < files.size(); i += count) {
+			workerFiles << files[i];
+		}
+
+		files = workerFiles;
+	}
+
+	if (jobs > 1 && !parser.isSet(listTargetsOption) && !parser.isSet(workerOption)) {
+		// Editor and generator plugins are not thread-safe, so parallel generation is done by worker processes.
+		QStringList workerArguments = { "-platform", QGuiApplication::platformName(), "--output", output };
+		for (const QString &target : parser.values(targetOption)) {
+			workerArguments << "--target" << target;
+		}
+
+		const int exitCode = generateInParallel(files.size(), parser.positionalArguments()
+				, workerArguments, jobs);
+		QLOG_INFO() << "------------------- APPLICATION FINISHED -------------------";
+		return exitCode;
+	}
+
+	generatorRunner::BatchGenerator generator;
+	if (parser.isSet(listTargetsOption)) {
+		QTextStream out(stdout);
+		for (const QString &target : generator.targets()) {
+			out << target << "\t" << generator.friendlyTargetName(target) << endl;
+		}
+
+		return 0;
+	}
+
+	const QStringList targets = parser.isSet(targetOption) ? parser.values(targetOption) : generator.targets();
+	int exitCode = 0;
+	for (const SaveFile &file : files) {
+		if (!generator.generate(file.path, targets, QDir(output).filePath(file.outputFolder))) {
+			exitCode = generationFailed;
+		}
+	}
+
+	QLOG_INFO() << "------------------- APPLICATION FINISHED -------------------";
+	return exitCode;
+}
@@ -0,0 +1,87 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QTextStream>
+
+#include "trajectoryReader.h"
+#include "trajectoryWriter.h"
+
+using namespace twoDModel;
+
+const QString description = QObject::tr(
+		"Converts robot`s trajectory written by 2D-model checker from one format into another. "\
+		"The format of the input is detected automatically.\n"\
+		"Example: \n") +
+		"    trajectory-converter --format json trajectory.bin trajectory.json";
+
+int main(int argc, char *argv[])
+{
+	QCoreApplication app(argc, argv);
+	QCoreApplication::setApplicationName("trajectory-converter");
+
+	QCommandLineParser parser;
+	parser.setApplicationDescription(description);
+	parser.addHelpOption();
+	parser.addPositionalArgument("input", QObject::tr("Trajectory in any of supported formats."));
+	parser.addPositionalArgument("output", QObject::tr("A path to file where converted trajectory will be written."));
+	QCommandLineOption formatOption({"f", "format"}, QObject::tr("A format of the output:"\
+				" \"json\" for JSON array, \"ndjson\" for one compact JSON object per line or \"binary\" for"\
+				" length-prefixed binary records.")
+			, "format", "json");
+	parser.addOption(formatOption);
+
+	parser.process(app);
+
+	const QStringList positionalArgs = parser.positionalArguments();
+	if (positionalArgs.size() != 2) {
+		parser.showHelp();
+	}
+
+	QTextStream errors(stderr);
+	TrajectoryFormat format = TrajectoryFormat::json;
+	if (!TrajectoryWriter::formatByName(parser.value(formatOption), format)) {
+		errors << QObject::tr("Unknown trajectory format %1").arg(parser.value(formatOption)) << endl;
+		return 1;
+	}
+
+	TrajectoryReader reader(positionalArgs[0]);
+	if (!reader.errorString().isEmpty()) {
+		errors << reader.errorString() << endl;
+		return 1;
+	}
+
+	TrajectoryWriter writer(positionalArgs[1], format);
+	if (!writer.isOpen()) {
+		errors << QObject::tr("Can not open %1 for writing: %2").arg(positionalArgs[1], writer.errorString()) << endl;
+		return 1;
+	}
+
+	writer.begin();
+	QJsonObject record;
+	while (reader.readNext(record)) {
+		writer.write(record);
+	}
+
+	writer.end();
+
+	// Records read before the error are still converted, that is useful for interrupted trajectories.
+	if (!reader.errorString().isEmpty()) {
+		errors << reader.errorString() << endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,181 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "trajectoryReader.h"
+
+#include <QtCore/QJsonDocument>
+
+using namespace twoDModel;
+
+TrajectoryReader::TrajectoryReader(const QString &fileName)
+	: mFile(fileName)
+{
+	if (!mFile.open(QIODevice::ReadOnly)) {
+		mError = QObject::tr("Can not open %1: %2").arg(fileName, mFile.errorString());
+		return;
+	}
+
+	detectFormat();
+}
+
+TrajectoryFormat TrajectoryReader::format() const
+{
+	return mFormat;
+}
+
+QString TrajectoryReader::errorString() const
+{
+	return mError;
+}
+
+void TrajectoryReader::detectFormat()
+{
+	const QByteArray magic(trajectoryBinary::magic);
+	if (mFile.peek(magic.size()) == magic) {
+		mFormat = TrajectoryFormat::binary;
+		mFile.read(magic.size());
+		char version = 0;
+		mFile.getChar(&version);
+		if (static_cast<quint8>(version) != trajectoryBinary::version) {
+			mError = QObject::tr("Unsupported binary trajectory version %1").arg(static_cast<quint8>(version));
+		}
+
+		mStream.setDevice(&mFile);
+		mStream.setVersion(trajectoryBinary::streamVersion);
+		return;
+	}
+
+	// JSON array starts with a bracket while NDJSON starts with an object, it is read line by line then.
+	if (!mFile.peek(64).trimmed().startsWith('[')) {
+		mFormat = TrajectoryFormat::ndjson;
+		return;
+	}
+
+	mFormat = TrajectoryFormat::json;
+	const QByteArray contents = mFile.readAll();
+	QJsonParseError error;
+	QJsonDocument document = QJsonDocument::fromJson(contents, &error);
+	if (error.error != QJsonParseError::NoError && !contents.trimmed().endsWith(']')) {
+		// The array is not terminated if the checker was interrupted.
+		document = QJsonDocument::fromJson(contents + "]", &error);
+	}
+
+	if (error.error != QJsonParseError::NoError) {
+		mError = QObject::tr("%1 at offset %2").arg(error.errorString()).arg(error.offset);
+		return;
+	}
+
+	mJsonRecords = document.array();
+}
+
+bool TrajectoryReader::readNext(QJsonObject &record)
+{
+	if (!mError.isEmpty()) {
+		return false;
+	}
+
+	switch (mFormat) {
+	case TrajectoryFormat::json:
+		if (mNextJsonRecord >= mJsonRecords.size()) {
+			return false;
+		}
+
+		record = mJsonRecords[mNextJsonRecord++].toObject();
+		return true;
+	case TrajectoryFormat::ndjson:
+		while (!mFile.atEnd()) {
+			const QByteArray line = mFile.readLine().trimmed();
+			if (line.isEmpty()) {
+				continue;
+			}
+
+			QJsonParseError error;
+			const QJsonDocument document = QJsonDocument::fromJson(line, &error);
+			if (error.error != QJsonParseError::NoError) {
+				mError = QObject::tr("%1 in line \"%2\"").arg(error.errorString(), QString::fromUtf8(line));
+				return false;
+			}
+
+			record = document.object();
+			return true;
+		}
+
+		return false;
+	case TrajectoryFormat::binary:
+		return readBinary(record);
+	}
+
+	return false;
+}
+
+bool TrajectoryReader::readBinary(QJsonObject &record)
+{
+	while (!mStream.atEnd()) {
+		quint32 size = 0;
+		mStream >> size;
+		if (mStream.status() != QDataStream::Ok || size > static_cast<quint64>(mFile.bytesAvailable())) {
+			mError = QObject::tr("Unexpected end of file");
+			return false;
+		}
+
+		QByteArray payload(static_cast<int>(size), Qt::Uninitialized);
+		mStream.readRawData(payload.data(), payload.size());
+		QDataStream payloadStream(payload);
+		payloadStream.setVersion(trajectoryBinary::streamVersion);
+		quint8 kind = 0;
+		QString robotId;
+		qint32 timestamp = 0;
+		payloadStream >> kind >> robotId >> timestamp;
+		if (kind == trajectoryBinary::robotPosition) {
+			double x = 0;
+			double y = 0;
+			double rotation = 0;
+			payloadStream >> x >> y >> rotation;
+			record = {
+				{ "robotId", robotId }
+				, { "timestamp", timestamp }
+				, { "x", x }
+				, { "y", y }
+				, { "rotation", rotation }
+			};
+		} else if (kind == trajectoryBinary::deviceState) {
+			QString device;
+			QString port;
+			QString property;
+			QByteArray value;
+			payloadStream >> device >> port >> property >> value;
+			const QJsonArray valueArray = QJsonDocument::fromJson(value).array();
+			record = {
+				{ "robotId", robotId }
+				, { "timestamp", timestamp }
+				, { "device", device }
+				, { "port", port }
+				, { "property", property }
+				, { "value", valueArray.isEmpty() ? QJsonValue() : valueArray.first() }
+			};
+		} else {
+			// Records of unknown kinds may be written by newer versions, they are skipped.
+			continue;
+		}
+
+		if (payloadStream.status() != QDataStream::Ok) {
+			mError = QObject::tr("Corrupted record of robot %1 at %2 ms").arg(robotId).arg(timestamp);
+			return false;
+		}
+
+		return true;
+	}
+
+	return false;
+}
@@ -0,0 +1,57 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QDataStream>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonObject>
+
+#include "trajectoryWriter.h"
+
+namespace twoDModel {
+
+/// Reads robot trajectory and device states written by TrajectoryWriter in any of trajectory formats.
+/// The format is detected by the contents of the file. Each record is returned in the same JSON representation
+/// as in JSON formats.
+class TrajectoryReader
+{
+public:
+	/// Opens the given file for reading, see errorString() if something went wrong.
+	explicit TrajectoryReader(const QString &fileName);
+
+	/// Returns the format of the read file.
+	TrajectoryFormat format() const;
+
+	/// Reads the next record from the file.
+	/// @returns false if there are no more records or the file is corrupted, see errorString() then.
+	bool readNext(QJsonObject &record);
+
+	/// Returns a human-readable message of the occured error or empty string if everything is ok.
+	QString errorString() const;
+
+private:
+	void detectFormat();
+	bool readBinary(QJsonObject &record);
+
+	QFile mFile;
+	TrajectoryFormat mFormat { TrajectoryFormat::json };
+	QDataStream mStream;
+	QJsonArray mJsonRecords;
+	int mNextJsonRecord { 0 };
+	QString mError;
+};
+
+}
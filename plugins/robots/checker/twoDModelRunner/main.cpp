@@ -18,12 +18,16 @@
 #include <QtCore/QCommandLineParser>
 #include <QtCore/QTranslator>
 #include <QtCore/QDirIterator>
+#include <QtCore/QTemporaryDir>
+#include <QtCore/QTextStream>
+#include <QtCore/QTimer>
 #include <QtWidgets/QApplication>
 
 #include <qrkernel/logging.h>
 #include <qrkernel/platformInfo.h>
 
 #include "runner.h"
+#include "parallelRunner.h"
 
 const int maxLogSize = 10 * 1024 * 1024;  // 10 MB
 
@@ -31,9 +35,13 @@ const QString description = QObject::tr(
 		"Emulates robot`s behaviour on TRIK Studio 2D model separately from programming environment. "\
 		"Passed .qrs will be interpreted just like when 'Run' button was pressed in TRIK Studio. \n"\
 		"In background mode the session will be terminated just after the execution ended and return code "
-		"will then contain binary information about program correctness."
+		"will then contain binary information about program correctness.\n"
+		"When one or more fields are given the save file will be interpreted on each of them in background, "
+		"report and trajectory options are then treated as folders for per-field files.\n"
 		"Example: \n") +
-		"    2D-model -b --platform minimal --report report.json --trajectory trajectory.fifo example.qrs";
+		"    2D-model -b --platform minimal --report report.json --trajectory trajectory.fifo example.qrs\n"
+		"    2D-model --platform minimal --field field1.xml --field field2.xml --report reports "
+		"--trajectory trajectories --jobs 2 example.qrs";
 
 bool loadTranslators(const QString &locale)
 {
@@ -106,9 +114,21 @@ int main(int argc, char *argv[])
 									, "path-to-report", "report.json");
 	QCommandLineOption trajectoryOption({"t", "trajectory"}
 										, QObject::tr("A path to file where robot`s trajectory will be"\
-				" written. The writing will not be performed not immediately, each trajectory point will be written"\
-				" just when obtained by checker, so FIFOs are recommended to be targets for this option.")
+				" written. The writing will not be performed not immediately, trajectory points will be written"\
+				" in chunks during the interpretation, so FIFOs are recommended to be targets for this option.")
 			, "path-to-trajectory", "trajectory.fifo");
+	QCommandLineOption trajectoryFormatOption("trajectory-format", QObject::tr("A format of the trajectory:"\
+				" \"json\" for JSON array, \"ndjson\" for one compact JSON object per line or \"binary\" for"\
+				" length-prefixed binary records. Use trajectory-converter to read binary trajectories.")
+			, "format", "json");
+	QCommandLineOption trajectoryIntervalOption("trajectory-min-interval", QObject::tr("Robot position is written"\
+				" into the trajectory not more often than once in this count of milliseconds of model time.")
+			, "milliseconds", "0");
+	QCommandLineOption trajectoryDistanceOption("trajectory-min-distance", QObject::tr("Robot position is written"\
+				" into the trajectory only when the robot moved at least this distance in pixels since"\
+				" the last written position, turn by one degree counts as one pixel. The last position of the robot"\
+				" is always written.")
+			, "pixels", "0");
 	QCommandLineOption inputOption({"i", "input"}, QObject::tr("Inputs for JavaScript solution.")// probably others too
 			, "path-to-input", "inputs.txt");
 	QCommandLineOption modeOption({"m", "mode"}, QObject::tr("Set to \"script\" for"\
@@ -124,15 +144,44 @@ int main(int argc, char *argv[])
 								   , QObject::tr("Close the window and exit after diagram/script"\
 												 " finishes."));
 	QCommandLineOption showConsoleOption({"c", "console"}, QObject::tr("Shows robot's console."));
+	QCommandLineOption fieldOption("field", QObject::tr("XML file with prepared 2D model field to check the solution on."\
+									" May be specified several times, the save file is then loaded only once and"\
+									" each field replaces its world model in memory. Inputs for a field are taken"\
+									" from the file with the same name and .txt extension if it exists.")
+									, "path-to-field");
+	QCommandLineOption noStopOnFailOption("no-stop-on-fail"
+									, QObject::tr("Check the solution on all given fields even if it failed on one"\
+												  " of them."));
+	QCommandLineOption jobsOption({"j", "jobs"}, QObject::tr("Check the solution on given fields simultaneously"\
+									" in at most this count of separate processes.")
+									, "count", "1");
+	QCommandLineOption mergedReportOption("merged-report"
+									, QObject::tr("A path to file where reports for all given fields will be"\
+												  " merged in the order fields were given (JSON). Fields that"\
+												  " were not checked are marked as cancelled.")
+									, "path-to-merged-report");
+	QCommandLineOption ticksPerBatchOption("ticks-per-batch", QObject::tr("In background mode emit this count of"\
+									" 2D model ticks one after another without letting the program react between them."\
+									" Greatly speeds up the modeling, but the program reactions become coarser."\
+									" The result still does not depend on machine speed.")
+									, "count", "0");
 	parser.addOption(backgroundOption);
 	parser.addOption(reportOption);
 	parser.addOption(trajectoryOption);
+	parser.addOption(trajectoryFormatOption);
+	parser.addOption(trajectoryIntervalOption);
+	parser.addOption(trajectoryDistanceOption);
 	parser.addOption(inputOption);
 	parser.addOption(modeOption);
 	parser.addOption(speedOption);
 	parser.addOption(closeOnFinishOption);
 	parser.addOption(closeOnSuccessOption);
 	parser.addOption(showConsoleOption);
+	parser.addOption(fieldOption);
+	parser.addOption(noStopOnFailOption);
+	parser.addOption(jobsOption);
+	parser.addOption(mergedReportOption);
+	parser.addOption(ticksPerBatchOption);
 
 	parser.process(*app);
 
@@ -150,15 +199,90 @@ int main(int argc, char *argv[])
 	const bool closeOnSuccessMode = parser.isSet(closeOnSuccessOption);
 	const bool closeOnFinishMode = backgroundMode || parser.isSet(closeOnFinishOption);
 	const bool showConsoleMode = parser.isSet(showConsoleOption);
-	QScopedPointer<twoDModel::Runner> runner(new twoDModel::Runner(report, trajectory, input, mode));
-
+	const QStringList fields = parser.values(fieldOption);
 	auto speedFactor = parser.value(speedOption).toInt();
-	if (!runner->interpret(qrsFile, backgroundMode, speedFactor
-						   , closeOnFinishMode, closeOnSuccessMode, showConsoleMode)) {
+
+	const int ticksPerBatch = parser.value(ticksPerBatchOption).toInt();
+	const int jobs = parser.value(jobsOption).toInt();
+	const bool stopOnFail = !parser.isSet(noStopOnFailOption);
+	const QString mergedReport = parser.value(mergedReportOption);
+
+	twoDModel::TrajectoryOptions trajectoryOptions;
+	if (!twoDModel::TrajectoryWriter::formatByName(parser.value(trajectoryFormatOption), trajectoryOptions.format)) {
+		QTextStream(stderr) << QObject::tr("Unknown trajectory format %1").arg(parser.value(trajectoryFormatOption))
+				<< endl;
 		return 2;
 	}
 
+	trajectoryOptions.minInterval = parser.value(trajectoryIntervalOption).toInt();
+	trajectoryOptions.minDistance = parser.value(trajectoryDistanceOption).toDouble();
+
+	QScopedPointer<twoDModel::Runner> runner;
+	QScopedPointer<twoDModel::ParallelRunner> parallelRunner;
+	QScopedPointer<QTemporaryDir> temporaryReports;
+	if (!fields.isEmpty() && (jobs > 1 || !mergedReport.isEmpty())) {
+		// Each field is checked by a separate worker process running in batch mode on this single field.
+		QStringList workerArguments = { qrsFile, "-platform", QGuiApplication::platformName(), "--mode", mode };
+		QString reportsFolder = report;
+		if (reportsFolder.isEmpty() && !mergedReport.isEmpty()) {
+			// Merged report is made of per-field reports, so workers write them into a temporary folder then.
+			temporaryReports.reset(new QTemporaryDir());
+			reportsFolder = temporaryReports->path();
+		}
+
+		if (!reportsFolder.isEmpty()) {
+			workerArguments << "--report" << reportsFolder;
+		}
+
+		if (!trajectory.isEmpty()) {
+			workerArguments << "--trajectory" << trajectory;
+		}
+
+		for (const QCommandLineOption &option
+				: { trajectoryFormatOption, trajectoryIntervalOption, trajectoryDistanceOption }) {
+			if (parser.isSet(option)) {
+				workerArguments << "--" + option.names().first() << parser.value(option);
+			}
+		}
+
+		if (!input.isEmpty()) {
+			workerArguments << "--input" << input;
+		}
+
+		if (parser.isSet(speedOption)) {
+			workerArguments << "--speed" << parser.value(speedOption);
+		}
+
+		if (parser.isSet(ticksPerBatchOption)) {
+			workerArguments << "--ticks-per-batch" << parser.value(ticksPerBatchOption);
+		}
+
+		parallelRunner.reset(new twoDModel::ParallelRunner(workerArguments, jobs, stopOnFail));
+		twoDModel::ParallelRunner * const pool = parallelRunner.data();
+		QTimer::singleShot(0, pool, [pool, fields, reportsFolder, mergedReport]() {
+			pool->start(fields, reportsFolder, mergedReport);
+		});
+	} else if (fields.isEmpty()) {
+		// Nobody will look at the scene in background mode, so there is no need to create 2D model windows.
+		runner.reset(new twoDModel::Runner(report, trajectory, input, mode, backgroundMode && !showConsoleMode));
+		runner->setTicksPerBatch(ticksPerBatch);
+		runner->setTrajectoryOptions(trajectoryOptions);
+		if (!runner->interpret(qrsFile, backgroundMode, speedFactor
+							   , closeOnFinishMode, closeOnSuccessMode, showConsoleMode)) {
+			return 2;
+		}
+	} else {
+		// Reports and trajectories are written separately for each field, so here we have folders for them.
+		runner.reset(new twoDModel::Runner(QString(), QString(), input, mode, true));
+		runner->setTicksPerBatch(ticksPerBatch);
+		runner->setTrajectoryOptions(trajectoryOptions);
+		if (!runner->interpretFields(qrsFile, fields, report, trajectory, speedFactor, stopOnFail)) {
+			return 2;
+		}
+	}
+
 	const int exitCode = app->exec();
+	parallelRunner.reset();
 	runner.reset();
 	app.reset();
 	QLOG_INFO() << "------------------- APPLICATION FINISHED -------------------";
@@ -0,0 +1,150 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "parallelRunner.h"
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QProcess>
+
+#include <qrkernel/logging.h>
+
+using namespace twoDModel;
+
+/// Exit code for fields that were not checked or which workers were terminated.
+static const int notChecked = -1;
+/// Exit code for workers that crashed or could not be started, treated as internal error like in checker scripts.
+static const int workerCrashed = 102;
+/// The solution was incorrect on the field.
+static const int fieldFailed = 1;
+/// The save file is broken, every field will fail in the same way.
+static const int incorrectSaveFile = 2;
+
+ParallelRunner::ParallelRunner(const QStringList &workerArguments, int jobs, bool stopOnFail, QObject *parent)
+	: QObject(parent)
+	, mWorkerArguments(workerArguments)
+	, mJobs(qMax(1, jobs))
+	, mStopOnFail(stopOnFail)
+{
+}
+
+ParallelRunner::~ParallelRunner()
+{
+	for (QProcess * const worker : mWorkers) {
+		worker->disconnect(this);
+		worker->kill();
+		worker->waitForFinished();
+	}
+}
+
+void ParallelRunner::start(const QStringList &fields, const QString &reportsFolder, const QString &mergedReport)
+{
+	mFields = fields;
+	mMergedReport = mergedReport;
+	mReportMerger.reset(new ReportMerger(fields, reportsFolder));
+	mExitCodes = QVector<int>(fields.size(), notChecked);
+	mNextField = 0;
+	mCancelFrom = fields.size();
+	launchMoreWorkers();
+}
+
+void ParallelRunner::launchMoreWorkers()
+{
+	while (mWorkers.size() < mJobs && mNextField < mCancelFrom) {
+		launchWorker(mNextField++);
+	}
+
+	if (mWorkers.isEmpty()) {
+		finish();
+	}
+}
+
+void ParallelRunner::launchWorker(int index)
+{
+	QProcess * const worker = new QProcess(this);
+	worker->setProcessChannelMode(QProcess::ForwardedChannels);
+	mWorkers[index] = worker;
+
+	connect(worker, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished)
+			, this, [this, index](int exitCode, QProcess::ExitStatus exitStatus) {
+		onWorkerFinished(index, exitStatus == QProcess::NormalExit ? exitCode : workerCrashed);
+	});
+	connect(worker, &QProcess::errorOccurred, this, [this, index](QProcess::ProcessError error) {
+		if (error == QProcess::FailedToStart) {
+			onWorkerFinished(index, workerCrashed);
+		}
+	});
+
+	QLOG_INFO() << "Starting worker for field" << mFields[index];
+	worker->start(QCoreApplication::applicationFilePath(), mWorkerArguments + QStringList{"--field", mFields[index]});
+}
+
+void ParallelRunner::onWorkerFinished(int index, int exitCode)
+{
+	QProcess * const worker = mWorkers.take(index);
+	if (!worker) {
+		// Already handled, for example errorOccurred and finished were both emitted.
+		return;
+	}
+
+	worker->deleteLater();
+	if (index >= mCancelFrom) {
+		// The worker was terminated because some previous field has failed.
+		launchMoreWorkers();
+		return;
+	}
+
+	mExitCodes[index] = exitCode;
+	mReportMerger->addResult(index, exitCode);
+	QLOG_INFO() << "Field" << mFields[index] << "finished with code" << exitCode;
+
+	const bool saveFileProblem = exitCode == incorrectSaveFile || exitCode > 100;
+	if (exitCode != 0 && (mStopOnFail || saveFileProblem)) {
+		cancelFieldsAfter(index);
+	}
+
+	launchMoreWorkers();
+}
+
+void ParallelRunner::cancelFieldsAfter(int index)
+{
+	mCancelFrom = qMin(mCancelFrom, index + 1);
+	for (auto it = mWorkers.begin(); it != mWorkers.end(); ++it) {
+		if (it.key() >= mCancelFrom) {
+			it.value()->kill();
+		}
+	}
+}
+
+void ParallelRunner::finish()
+{
+	if (!mMergedReport.isEmpty()) {
+		mReportMerger->write(mMergedReport);
+	}
+
+	QCoreApplication::exit(resultExitCode());
+}
+
+int ParallelRunner::resultExitCode() const
+{
+	// Taking the first unsuccessful field in the given order, so the result does not depend on scheduling.
+	for (const int exitCode : mExitCodes) {
+		if (exitCode != 0 && exitCode != notChecked) {
+			return exitCode == fieldFailed || exitCode == incorrectSaveFile || exitCode > 100
+					? exitCode
+					: workerCrashed;
+		}
+	}
+
+	return 0;
+}
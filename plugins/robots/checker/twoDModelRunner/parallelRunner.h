@@ -0,0 +1,77 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QObject>
+#include <QtCore/QMap>
+#include <QtCore/QScopedPointer>
+#include <QtCore/QStringList>
+#include <QtCore/QVector>
+
+#include "reportMerger.h"
+
+class QProcess;
+
+namespace twoDModel {
+
+/// Checks a solution on several fields at the same time. Each field is simulated by a separate 2D-model worker
+/// process, so every field gets its own completely isolated model, not more than given number of workers is run
+/// simultaneously. The results are merged in the order fields were given regardless of the order workers finished.
+class ParallelRunner : public QObject
+{
+	Q_OBJECT
+
+public:
+	/// Constructor.
+	/// @param workerArguments Command line arguments passed to each worker, field option will be appended to them.
+	/// @param jobs The maximal number of workers running simultaneously.
+	/// @param stopOnFail If true then fields following the first failed one will not be checked (and workers
+	/// checking them will be terminated). Fields preceding the failed one are still checked, so the result is
+	/// the same as of the sequential check.
+	ParallelRunner(const QStringList &workerArguments, int jobs, bool stopOnFail, QObject *parent = nullptr);
+
+	~ParallelRunner() override;
+
+	/// Starts checking. The application will exit with the same code as sequential batch mode would return when
+	/// all workers finish.
+	/// @param fields A list of paths to XML files with prepared 2D model fields.
+	/// @param reportsFolder A folder where workers write reports for each field.
+	/// @param mergedReport If non-empty then reports of all fields will be merged into this file in JSON.
+	void start(const QStringList &fields, const QString &reportsFolder, const QString &mergedReport);
+
+private:
+	void launchMoreWorkers();
+	void launchWorker(int index);
+	void onWorkerFinished(int index, int exitCode);
+	void cancelFieldsAfter(int index);
+	void finish();
+	int resultExitCode() const;
+
+	const QStringList mWorkerArguments;
+	const int mJobs;
+	const bool mStopOnFail;
+
+	QStringList mFields;
+	QString mMergedReport;
+	QScopedPointer<ReportMerger> mReportMerger;
+
+	/// Exit codes of finished workers, indexed like fields. Fields that were not checked have notChecked value.
+	QVector<int> mExitCodes;
+	QMap<int, QProcess *> mWorkers;  // Has ownership via Qt parent-child system.
+	int mNextField { 0 };
+	int mCancelFrom { 0 };
+};
+
+}
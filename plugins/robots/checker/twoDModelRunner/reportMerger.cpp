@@ -0,0 +1,76 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include "reportMerger.h"
+
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+
+#include <qrutils/inFile.h>
+#include <qrutils/outFile.h>
+
+using namespace twoDModel;
+
+ReportMerger::ReportMerger(const QStringList &fields, const QString &reportsFolder)
+	: mFields(fields)
+	, mReportsFolder(reportsFolder)
+	, mResults(fields.size())
+{
+}
+
+void ReportMerger::addResult(int index, int exitCode)
+{
+	Result &result = mResults[index];
+	result.checked = true;
+	result.exitCode = exitCode;
+	result.messages = QJsonArray();
+	if (!mReportsFolder.isEmpty()) {
+		const QString reportFile = QDir(mReportsFolder).filePath(fieldName(index));
+		if (QFileInfo::exists(reportFile)) {
+			result.messages = QJsonDocument::fromJson(utils::InFile::readAll(reportFile).toUtf8()).array();
+		}
+	}
+}
+
+void ReportMerger::write(const QString &path) const
+{
+	QJsonArray merged;
+	for (int i = 0; i < mFields.size(); ++i) {
+		const Result &result = mResults[i];
+		if (result.checked) {
+			merged.append(QJsonObject{
+				{ "field", fieldName(i) }
+				, { "exitCode", result.exitCode }
+				, { "messages", result.messages }
+			});
+		} else {
+			merged.append(QJsonObject{
+				{ "field", fieldName(i) }
+				, { "cancelled", true }
+			});
+		}
+	}
+
+	utils::OutFile out(path);
+	out() << QJsonDocument(merged).toJson();
+}
+
+QString ReportMerger::fieldName(int index) const
+{
+	return QFileInfo(mFields[index]).completeBaseName();
+}
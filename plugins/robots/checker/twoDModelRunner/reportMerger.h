@@ -0,0 +1,56 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#pragma once
+
+#include <QtCore/QJsonValue>
+#include <QtCore/QStringList>
+#include <QtCore/QVector>
+
+namespace twoDModel {
+
+/// Merges reports written by workers for each field into one JSON file. Entries go in the order the fields were
+/// given regardless of the order workers finished, so the merged report does not depend on scheduling.
+class ReportMerger
+{
+public:
+	/// @param fields Paths to fields in the order they were given.
+	/// @param reportsFolder A folder where workers write the report of each field into the file named like
+	/// the field without extension. If empty then merged entries will have no messages.
+	ReportMerger(const QStringList &fields, const QString &reportsFolder);
+
+	/// Remembers that the field with the given index was checked and reads its report.
+	void addResult(int index, int exitCode);
+
+	/// Writes merged report into \a path. Fields without result (that were not checked at all or whose workers
+	/// were terminated) are marked as cancelled.
+	void write(const QString &path) const;
+
+private:
+	struct Result
+	{
+		bool checked { false };
+		int exitCode { 0 };
+		QJsonValue messages;
+	};
+
+	QString fieldName(int index) const;
+
+	const QStringList mFields;
+	const QString mReportsFolder;
+	QVector<Result> mResults;
+};
+
+}
@@ -14,19 +14,27 @@
 
 #include "reporter.h"
 
-#include <QtCore/QPointF>
+#include <QtCore/QLineF>
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonObject>
 #include <QtCore/QJsonArray>
+#include <QtCore/QtMath>
 
+#include <qrkernel/logging.h>
 #include <qrutils/outFile.h>
 
 using namespace twoDModel;
 
 Reporter::Reporter(const QString &messagesFile, const QString &trajectoryFile)
 	: mMessagesFile(new utils::OutFile(messagesFile))
-	, mTrajectoryFile(new utils::OutFile(trajectoryFile))
+	, mTrajectoryFileName(trajectoryFile)
 {
+	mTrajectoryFlushTimer.setInterval(TrajectoryWriter::flushInterval);
+	connect(&mTrajectoryFlushTimer, &QTimer::timeout, this, [this]() {
+		if (!mTrajectory.isNull()) {
+			mTrajectory->flush();
+		}
+	});
 }
 
 Reporter::~Reporter()
@@ -38,6 +46,11 @@ bool Reporter::lastMessageIsError()
 	return !mMessages.isEmpty() && mMessages.last().first == Level::error;
 }
 
+void Reporter::setTrajectoryOptions(const TrajectoryOptions &options)
+{
+	mTrajectoryOptions = options;
+}
+
 void Reporter::addInformation(const QString &message)
 {
 	mMessages << qMakePair(Level::information, message);
@@ -55,48 +68,62 @@ void Reporter::addLog(const QString &message)
 
 void Reporter::onInterpretationStart()
 {
-	mFirstMessage = true;
-	report("[\n", mTrajectoryFile);
+	mLastTrajectoryPoints.clear();
+	mSkippedTrajectoryPoints.clear();
+	mTrajectory.reset(new TrajectoryWriter(mTrajectoryFileName, mTrajectoryOptions.format));
+	if (!mTrajectoryFileName.isEmpty() && !mTrajectory->isOpen()) {
+		QLOG_ERROR() << QString("Opening %1 for write failed: %2")
+				.arg(mTrajectoryFileName, mTrajectory->errorString());
+	}
+
+	mTrajectory->begin();
+	mTrajectoryFlushTimer.start();
 }
 
 void Reporter::onInterpretationEnd()
 {
-	report("]\n", mTrajectoryFile);
+	mTrajectoryFlushTimer.stop();
+	if (mTrajectory.isNull()) {
+		return;
+	}
+
+	for (auto it = mSkippedTrajectoryPoints.cbegin(); it != mSkippedTrajectoryPoints.cend(); ++it) {
+		mTrajectory->writeRobotPosition(it.key(), it->timestamp, it->position, it->rotation);
+	}
+
+	mSkippedTrajectoryPoints.clear();
+	mTrajectory->end();
+	mTrajectory.reset();
 }
 
 void Reporter::newTrajectoryPoint(const QString &robotId, int timestamp, const QPointF &position, qreal rotation)
 {
-	if (!mTrajectoryFile.isNull()) {
-		QJsonObject transition;
-		transition["robotId"] = robotId;
-		transition["timestamp"] = timestamp;
-		transition["x"] = position.x();
-		transition["y"] = position.y();
-		transition["rotation"] = rotation;
-
-		QJsonDocument document;
-		document.setObject(transition);
-		report((mFirstMessage ? "" : ", ") + document.toJson(), mTrajectoryFile);
-		mFirstMessage = false;
+	if (mTrajectory.isNull() || !mTrajectory->isOpen()) {
+		return;
+	}
+
+	const TrajectoryPoint point { timestamp, position, rotation };
+	const auto last = mLastTrajectoryPoints.constFind(robotId);
+	const bool tooEarly = last != mLastTrajectoryPoints.constEnd()
+			&& timestamp - last->timestamp < mTrajectoryOptions.minInterval;
+	// Turn by one degree is counted as one pixel of movement, otherwise turns in place would be lost.
+	const bool tooClose = last != mLastTrajectoryPoints.constEnd()
+			&& QLineF(last->position, position).length() + qAbs(std::remainder(rotation - last->rotation, 360.0))
+					< mTrajectoryOptions.minDistance;
+	if (tooEarly || tooClose) {
+		// Decimated point is remembered to be written at the end if it will be the last position of the robot.
+		mSkippedTrajectoryPoints[robotId] = point;
+		return;
 	}
+
+	writeTrajectoryPoint(robotId, point);
 }
 
 void Reporter::newDeviceState(const QString &robotId, int timestamp, const QString &deviceType
 		, const QString &devicePort, const QString &property, const QVariant &value)
 {
-	if (!mTrajectoryFile.isNull()) {
-		QJsonObject modification;
-		modification["robotId"] = robotId;
-		modification["timestamp"] = timestamp;
-		modification["device"] = deviceType;
-		modification["port"] = devicePort;
-		modification["property"] = property;
-		modification["value"] = variantToJson(value);
-
-		QJsonDocument document;
-		document.setObject(modification);
-		report((mFirstMessage ? "" : ", ") + document.toJson(), mTrajectoryFile);
-		mFirstMessage = false;
+	if (!mTrajectory.isNull() && mTrajectory->isOpen()) {
+		mTrajectory->writeDeviceState(robotId, timestamp, deviceType, devicePort, property, variantToJson(value));
 	}
 }
 
@@ -138,6 +165,13 @@ QJsonValue Reporter::variantToJson(const QVariant &value) const
 	}
 }
 
+void Reporter::writeTrajectoryPoint(const QString &robotId, const TrajectoryPoint &point)
+{
+	mSkippedTrajectoryPoints.remove(robotId);
+	mLastTrajectoryPoints[robotId] = point;
+	mTrajectory->writeRobotPosition(robotId, point.timestamp, point.position, point.rotation);
+}
+
 void Reporter::report(const QString &message, const QScopedPointer<utils::OutFile> &file)
 {
 	if (!file.isNull()) {
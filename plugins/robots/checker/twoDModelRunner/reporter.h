@@ -14,8 +14,13 @@
 
 #pragma once
 
+#include <QtCore/QHash>
 #include <QtCore/QObject>
+#include <QtCore/QPointF>
 #include <QtCore/QScopedPointer>
+#include <QtCore/QTimer>
+
+#include "trajectoryWriter.h"
 
 namespace utils {
 class OutFile;
@@ -34,6 +39,20 @@ enum class Level
 	, log
 };
 
+/// Options of robot`s trajectory written by Reporter.
+struct TrajectoryOptions
+{
+	/// A format of the trajectory file.
+	TrajectoryFormat format { TrajectoryFormat::json };
+
+	/// Robot position is skipped if less than this count of milliseconds passed since the last written one.
+	int minInterval { 0 };
+
+	/// Robot position is skipped if the robot moved less than this distance since the last written one.
+	/// Turning by one degree counts as moving by one pixel, so turns in place are not skipped.
+	qreal minDistance { 0 };
+};
+
 /// Collects information about the interpretation process and writes it into the given file as JSON report.
 class Reporter : public QObject
 {
@@ -44,7 +63,7 @@ public:
 	/// the interpretation ends.
 	/// @param trajectoryFile If non-empty the information about robot`s movement will be stored there
 	/// during the interpetation (so the factical data write will not be performed in one moment, it will be written
-	/// in chunks, each chunk with the new robot transition).
+	/// in chunks, each chunk with a bunch of new robot transitions).
 	Reporter(const QString &messagesFile, const QString &trajectoryFile);
 
 	~Reporter() override;
@@ -52,6 +71,9 @@ public:
 	/// Returns true if last reported to user message was an error.
 	bool lastMessageIsError();
 
+	/// Sets format and decimation of the trajectory. Must be called before the interpretation start.
+	void setTrajectoryOptions(const TrajectoryOptions &options);
+
 public slots:
 	/// Reports informational message reported to user during the interpretation process.
 	void addInformation(const QString &message);
@@ -69,6 +91,7 @@ public slots:
 	void onInterpretationEnd();
 
 	/// Writes an information abount the new trajectory point into the given in constructor file.
+	/// The point may be skipped according to trajectory options, the last position of each robot is always written.
 	/// @param robotId The id of the moved robot.
 	/// @param timestamp Count of milliseconds passed from the interpretation start when the event happened.
 	/// @param timestamp The position of the robot in scene coordinates.
@@ -90,14 +113,32 @@ public slots:
 	void reportMessages();
 
 private:
+	struct TrajectoryPoint
+	{
+		int timestamp;
+		QPointF position;
+		qreal rotation;
+	};
+
 	QJsonValue variantToJson(const QVariant &value) const;
 	void report(const QString &message, const QScopedPointer<utils::OutFile> &file);
 	QString levelToString(const Level level) const;
+	void writeTrajectoryPoint(const QString &robotId, const TrajectoryPoint &point);
 
 	QList<QPair<Level, QString>> mMessages;
 	const QScopedPointer<utils::OutFile> mMessagesFile;
-	const QScopedPointer<utils::OutFile> mTrajectoryFile;
-	bool mFirstMessage { true };
+	const QString mTrajectoryFileName;
+	TrajectoryOptions mTrajectoryOptions;
+	QScopedPointer<TrajectoryWriter> mTrajectory;
+
+	/// Flushes the trajectory periodically, so its readers get records even when new ones do not come.
+	QTimer mTrajectoryFlushTimer;
+
+	/// Last written position of each robot, used for decimation.
+	QHash<QString, TrajectoryPoint> mLastTrajectoryPoints;
+
+	/// The latest skipped position of each robot, written at the end if no newer position was written.
+	QHash<QString, TrajectoryPoint> mSkippedTrajectoryPoints;
 };
 
 }
@@ -14,22 +14,29 @@
 
 #include "runner.h"
 
+#include <QtCore/QDir>
 #include <QtCore/QFile>
+#include <QtCore/QFileInfo>
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonObject>
 #include <QtCore/QJsonValue>
 #include <QtWidgets/QApplication>
 
+#include <qrkernel/logging.h>
 #include <qrutils/widgets/consoleDock.h>
+#include <qrutils/xmlUtils.h>
 #include <kitBase/robotModel/robotParts/shell.h>
 #include <kitBase/robotModel/robotModelUtils.h>
 
 #include <twoDModel/engine/model/model.h>
 #include <twoDModel/engine/model/timeline.h>
+#include <twoDModel/engine/twoDModelEngineFacade.h>
+#include <twoDModel/engine/twoDModelEngineInterface.h>
+#include <twoDModel/robotModel/twoDRobotModel.h>
 
 using namespace twoDModel;
 
-Runner::Runner(const QString &report, const QString &trajectory)
+Runner::Runner(const QString &report, const QString &trajectory, bool headless)
 {
 	mQRealFacade.reset(new qReal::SystemFacade());
 	mProjectManager.reset(new qReal::ProjectManager(mQRealFacade->models()));
@@ -50,21 +57,17 @@ Runner::Runner(const QString &report, const QString &trajectory)
 							 , *mSceneCustomizer
 							 , mQRealFacade->events()
 							 , *mTextManager));
-	mReporter.reset(new Reporter(report, trajectory));
-	mPluginFacade.reset(new interpreterCore::RobotsPluginFacade());
+	resetReporter(report, trajectory);
+	mPluginFacade.reset(new interpreterCore::RobotsPluginFacade(headless));
 	mPluginFacade->init(*mConfigurator);
 	for (auto &&defaultSettingsFile : mPluginFacade->defaultSettingsFiles()) {
 		qReal::SettingsManager::loadDefaultSettings(defaultSettingsFile);
 	}
-
-	connect(&*mErrorReporter, &qReal::ConsoleErrorReporter::informationAdded, &*mReporter, &Reporter::addInformation);
-	connect(&*mErrorReporter, &qReal::ConsoleErrorReporter::errorAdded, &*mReporter, &Reporter::addError);
-	connect(&*mErrorReporter, &qReal::ConsoleErrorReporter::criticalAdded, &*mReporter, &Reporter::addError);
-	connect(&*mErrorReporter, &qReal::ConsoleErrorReporter::logAdded, &*mReporter, &Reporter::addLog);
 }
 
-Runner::Runner(const QString &report, const QString &trajectory, const QString &input, const QString &mode)
-	: Runner(report, trajectory)
+Runner::Runner(const QString &report, const QString &trajectory, const QString &input, const QString &mode
+		, bool headless)
+	: Runner(report, trajectory, headless)
 
 {
 	mInputsFile = input;
@@ -95,18 +98,7 @@ bool Runner::interpret(const QString &saveFile, const bool background
 		return false;
 	}
 
-	/// @todo: A bit hacky way to get 2D model window. Actually we must not have need in this.
-	/// GUI must be separated from logic and not appear here at all.
-	QList<view::TwoDModelWidget *> twoDModelWindows;
-	for (auto &&widget : QApplication::allWidgets()) {
-		if (const auto twoDModelWindow = dynamic_cast<view::TwoDModelWidget *>(widget)) {
-			twoDModelWindows << twoDModelWindow;
-			if (background) {
-				twoDModelWindow->setBackgroundMode();
-				twoDModelWindow->hide();
-			}
-		}
-	}
+	const QList<view::TwoDModelWidget *> twoDModelWindows = this->twoDModelWindows(background);
 
 	connect(&mPluginFacade->eventsForKitPlugins(), &kitBase::EventsForKitPluginInterface::interpretationStopped
 			, this, [this, closeOnFinish, closeOnSuccess](qReal::interpretation::StopReason reason) {
@@ -129,11 +121,7 @@ bool Runner::interpret(const QString &saveFile, const bool background
 			attachNewConsoleTo(twoDModelWindow);
 		}
 
-		auto &t = twoDModelWindow->model().timeline();
-		t.setImmediateMode(background);
-		if (customSpeedFactor >= model::Timeline::normalSpeedFactor) {
-			t.setSpeedFactor(customSpeedFactor);
-		}
+		setupTimeline(twoDModelWindow->model().timeline(), background, customSpeedFactor);
 
 		const auto models = twoDModelWindow->model().robotModels();
 		if (!models.isEmpty() && models[0]->info().name() == robotName) {
@@ -141,9 +129,113 @@ bool Runner::interpret(const QString &saveFile, const bool background
 		}
 	}
 
+	if (twoDModelWindows.isEmpty()) {
+		// Headless mode, nothing to show, just tuning the model itself.
+		for (auto &&twoDModel : twoDModels(twoDModelWindows)) {
+			setupTimeline(twoDModel->timeline(), background, customSpeedFactor);
+
+			for (auto &&robotModel : twoDModel->robotModels()) {
+				connectRobotModel(robotModel, nullptr);
+			}
+		}
+	}
+
 	mReporter->onInterpretationStart();
+	return startInterpretation(mInputsFile);
+}
+
+bool Runner::interpretFields(const QString &saveFile, const QStringList &fields
+		, const QString &reportsFolder, const QString &trajectoriesFolder
+		, const int customSpeedFactor, const bool stopOnFail)
+{
+	if (!mProjectManager->open(saveFile)) {
+		return false;
+	}
+
+	mTwoDModelWindows = twoDModelWindows(true);
+	mTwoDModels = twoDModels(mTwoDModelWindows);
+	mPendingFields = fields;
+	mReportsFolder = reportsFolder;
+	mTrajectoriesFolder = trajectoriesFolder;
+	mStopOnFail = stopOnFail;
+	for (auto &&folder : {reportsFolder, trajectoriesFolder}) {
+		if (!folder.isEmpty()) {
+			QDir().mkpath(folder);
+		}
+	}
+
+	const auto scheduleFinish = [this]() {
+		if (!mCurrentField.isEmpty() && !mFieldFinishScheduled) {
+			mFieldFinishScheduled = true;
+			// Errors may still be reported in the event loop after the interpretation stopped.
+			QTimer::singleShot(0, this, &Runner::finishField);
+		}
+	};
+
+	connect(&mPluginFacade->eventsForKitPlugins(), &kitBase::EventsForKitPluginInterface::interpretationStopped
+			, this, scheduleFinish);
+	connect(&mPluginFacade->eventsForKitPlugins(), &kitBase::EventsForKitPluginInterface::interpretationErrored
+			, this, scheduleFinish);
+
+	for (auto &&twoDModel : mTwoDModels) {
+		setupTimeline(twoDModel->timeline(), true, customSpeedFactor);
+
+		for (auto &&robotModel : twoDModel->robotModels()) {
+			connectRobotModel(robotModel, nullptr);
+		}
+	}
+
+	const auto &logicalRepo = mQRealFacade->models().logicalRepoApi();
+	if (mMode == "script" && logicalRepo.metaInformation("activeCode").toString().isEmpty()) {
+		// Each field will fail in the same way, so it is the problem of a save file itself.
+		return false;
+	}
+
+	runNextField();
+	return true;
+}
+
+QList<view::TwoDModelWidget *> Runner::twoDModelWindows(bool background) const
+{
+	/// @todo: A bit hacky way to get 2D model window. Actually we must not have need in this.
+	/// GUI must be separated from logic and not appear here at all.
+	QList<view::TwoDModelWidget *> result;
+	for (auto &&widget : QApplication::allWidgets()) {
+		if (const auto twoDModelWindow = dynamic_cast<view::TwoDModelWidget *>(widget)) {
+			result << twoDModelWindow;
+			if (background) {
+				twoDModelWindow->setBackgroundMode();
+				twoDModelWindow->hide();
+			}
+		}
+	}
+
+	return result;
+}
+
+QList<model::Model *> Runner::twoDModels(const QList<view::TwoDModelWidget *> &twoDModelWindows) const
+{
+	QList<model::Model *> result;
+	for (auto &&twoDModelWindow : twoDModelWindows) {
+		result << &twoDModelWindow->model();
+	}
+
+	if (result.isEmpty()) {
+		// No windows in headless mode, only the model of the selected robot will be used in interpretation.
+		const auto robotModel = dynamic_cast<twoDModel::robotModel::TwoDRobotModel *>(
+				&mPluginFacade->robotModelManager().model());
+		if (robotModel && robotModel->engine()) {
+			result << &robotModel->engine()->model();
+		}
+	}
+
+	return result;
+}
+
+bool Runner::startInterpretation(const QString &inputsFile)
+{
 	if (mMode == "script") {
-		return mPluginFacade->interpretCode(mInputsFile);
+		return mPluginFacade->interpretCode(inputsFile);
 	} else if (mMode == "diagram") {
 		mPluginFacade->actionsManager().runAction().trigger();
 	}
@@ -151,6 +243,128 @@ bool Runner::interpret(const QString &saveFile, const bool background
 	return true;
 }
 
+void Runner::setTicksPerBatch(int ticks)
+{
+	mTicksPerBatch = ticks;
+}
+
+void Runner::setTrajectoryOptions(const TrajectoryOptions &options)
+{
+	mTrajectoryOptions = options;
+	mReporter->setTrajectoryOptions(options);
+}
+
+void Runner::setupTimeline(model::Timeline &timeline, bool background, int customSpeedFactor) const
+{
+	timeline.setImmediateMode(background);
+	timeline.setTicksPerBatch(mTicksPerBatch);
+	if (customSpeedFactor >= model::Timeline::normalSpeedFactor) {
+		timeline.setSpeedFactor(customSpeedFactor);
+	}
+}
+
+void Runner::resetReporter(const QString &report, const QString &trajectory)
+{
+	mReporter.reset(new Reporter(report, trajectory));
+	mReporter->setTrajectoryOptions(mTrajectoryOptions);
+	connect(&*mErrorReporter, &qReal::ConsoleErrorReporter::informationAdded, &*mReporter, &Reporter::addInformation);
+	connect(&*mErrorReporter, &qReal::ConsoleErrorReporter::errorAdded, &*mReporter, &Reporter::addError);
+	connect(&*mErrorReporter, &qReal::ConsoleErrorReporter::criticalAdded, &*mReporter, &Reporter::addError);
+	connect(&*mErrorReporter, &qReal::ConsoleErrorReporter::logAdded, &*mReporter, &Reporter::addLog);
+}
+
+bool Runner::applyField(const QString &field)
+{
+	QString errorMessage;
+	int errorLine = 0;
+	int errorColumn = 0;
+	QDomDocument newWorld = utils::xmlUtils::loadDocumentWithConversion(field
+			, &errorMessage, &errorLine, &errorColumn);
+	if (newWorld.isNull()) {
+		QLOG_ERROR() << "Failed to load field" << field << errorLine << ":" << errorColumn << errorMessage;
+		return false;
+	}
+
+	// Doing the same as patcher does, but in memory: blobs and world are stored separately in a save file.
+	auto &repo = mQRealFacade->models().mutableLogicalRepoApi();
+	const QDomElement blobs = newWorld.firstChildElement("root").firstChildElement("blobs");
+	QDomDocument blobsDoc;
+	QDomElement blobsRoot = blobsDoc.createElement("root");
+	blobsRoot.appendChild(blobsDoc.importNode(blobs, true));
+	blobsDoc.appendChild(blobsRoot);
+	repo.setMetaInformation("blobs", blobsDoc.toString(4));
+
+	QDomDocument worldWithoutBlobs = newWorld.cloneNode().toDocument();
+	worldWithoutBlobs.firstChildElement("root").removeChild(
+			worldWithoutBlobs.firstChildElement("root").firstChildElement("blobs"));
+	repo.setMetaInformation("worldModel", worldWithoutBlobs.toString(4));
+
+	// Loading world resets the model: world is cleared, robot is returned to its start position.
+	if (mTwoDModelWindows.isEmpty()) {
+		for (auto &&twoDModel : mTwoDModels) {
+			twoDModel->deserialize(newWorld);
+		}
+	} else {
+		for (auto &&twoDModelWindow : mTwoDModelWindows) {
+			twoDModelWindow->loadXmls(newWorld);
+		}
+	}
+
+	return true;
+}
+
+void Runner::runNextField()
+{
+	if (mPendingFields.isEmpty()) {
+		mMainWindow->emulateClose(mSomeFieldFailed ? 1 : 0);
+		return;
+	}
+
+	const QString field = mPendingFields.takeFirst();
+	const QFileInfo fieldInfo(field);
+	const QString fieldName = fieldInfo.completeBaseName();
+	QLOG_INFO() << "Running field" << field;
+
+	resetReporter(mReportsFolder.isEmpty() ? QString() : QDir(mReportsFolder).filePath(fieldName)
+			, mTrajectoriesFolder.isEmpty() ? QString() : QDir(mTrajectoriesFolder).filePath(fieldName));
+
+	if (!applyField(field)) {
+		// Corrupted field is the problem of checker environment, not of the solution.
+		mMainWindow->emulateClose(101);
+		return;
+	}
+
+	const QString fieldInputs = fieldInfo.dir().filePath(fieldName + ".txt");
+	mCurrentField = field;
+	mFieldFinishScheduled = false;
+	mReporter->onInterpretationStart();
+	if (!startInterpretation(QFileInfo::exists(fieldInputs) ? fieldInputs : mInputsFile)) {
+		mFieldFinishScheduled = true;
+		finishField();
+	}
+}
+
+void Runner::finishField()
+{
+	mReporter->onInterpretationEnd();
+	mReporter->reportMessages();
+	const bool failed = mReporter->lastMessageIsError();
+	QLOG_INFO() << "Field" << mCurrentField << (failed ? "failed" : "passed");
+
+	// Everything was written, the reporter for the next field will be created on its start.
+	resetReporter(QString(), QString());
+	mCurrentField.clear();
+
+	if (failed) {
+		mSomeFieldFailed = true;
+		if (mStopOnFail) {
+			mPendingFields.clear();
+		}
+	}
+
+	QTimer::singleShot(0, this, &Runner::runNextField);
+}
+
 void Runner::connectRobotModel(const model::RobotModel *robotModel, const qReal::ui::ConsoleDock* console)
 {
 	connect(robotModel, &model::RobotModel::positionRecalculated
@@ -37,7 +37,9 @@ class ConsoleDock;
 namespace twoDModel {
 
 namespace model {
+class Model;
 class RobotModel;
+class Timeline;
 }
 
 /// Creates instances null QReal environment, of robots plugin and runs interpretation on 2D model window.
@@ -49,14 +51,17 @@ public:
 	/// Constructor.
 	/// @param report A path to a file where JSON report about the session will be written after it ends.
 	/// @param trajectory A path to a file where robot`s trajectory will be written during the session.
-	Runner(const QString &report, const QString &trajectory);
+	/// @param headless If true then 2D model windows will not be created, only the model itself will work.
+	Runner(const QString &report, const QString &trajectory, bool headless = false);
 
 	/// Constructor.
 	/// @param report A path to a file where JSON report about the session will be written after it ends.
 	/// @param trajectory A path to a file where robot`s trajectory will be written during the session.
 	/// @param input A path to a file where JSON with inputs for JavaScript.
 	/// @param mode Interpret mode.
-	Runner(const QString &report, const QString &trajectory, const QString &input, const QString &mode);
+	/// @param headless If true then 2D model windows will not be created, only the model itself will work.
+	Runner(const QString &report, const QString &trajectory, const QString &input, const QString &mode
+			, bool headless = false);
 
 	~Runner();
 
@@ -70,10 +75,41 @@ public:
 	bool interpret(const QString &saveFile, bool background, int speedFactor
 				   , bool closeOnFinish, bool closeOnSuccess, bool showConsole);
 
+	/// Starts the interpretation of the given save file on each of the given fields one after another in background.
+	/// The save file is opened only once, each field replaces the world model in memory just like patcher does,
+	/// 2D model is reset between the runs. The session is closed after the last field with exit code 0 if
+	/// the program was correct on all fields and 1 otherwise.
+	/// @param saveFile QReal save file (qrs) that will be opened and interpreted.
+	/// @param fields A list of paths to XML files with prepared 2D model fields.
+	/// @param reportsFolder A folder where JSON report for each field will be written into a file named as
+	/// the field file without extension.
+	/// @param trajectoriesFolder A folder where robot`s trajectory for each field will be written into a file named
+	/// as the field file without extension.
+	/// @param speedFactor Can be used to tune interpretation speed, the fastest one is used by default.
+	/// @param stopOnFail If true then the remaining fields will be skipped after the first failed one.
+	bool interpretFields(const QString &saveFile, const QStringList &fields
+			, const QString &reportsFolder, const QString &trajectoriesFolder
+			, int speedFactor, bool stopOnFail);
+
+	/// Sets the count of 2D model ticks emitted without processing events between them in background mode.
+	/// Must be called before the interpretation start. See Timeline::setTicksPerBatch().
+	void setTicksPerBatch(int ticks);
+
+	/// Sets format and decimation of written robot`s trajectories. Must be called before the interpretation start.
+	void setTrajectoryOptions(const TrajectoryOptions &options);
+
 private slots:
 	void close();
+	void runNextField();
+	void finishField();
 
 private:
+	QList<view::TwoDModelWidget *> twoDModelWindows(bool background) const;
+	QList<model::Model *> twoDModels(const QList<view::TwoDModelWidget *> &twoDModelWindows) const;
+	bool startInterpretation(const QString &inputsFile);
+	void setupTimeline(model::Timeline &timeline, bool background, int customSpeedFactor) const;
+	void resetReporter(const QString &report, const QString &trajectory);
+	bool applyField(const QString &field);
 	void connectRobotModel(const model::RobotModel *robotModel, const qReal::ui::ConsoleDock* console);
 	void onRobotRided(const QPointF &newPosition, const qreal newRotation);
 	void onDeviceStateChanged(const QString &robotId, const kitBase::robotModel::robotParts::Device *device
@@ -93,6 +129,18 @@ private:
 	QList<qReal::ui::ConsoleDock *> mRobotConsoles;
 	QString mInputsFile;
 	QString mMode;
+	int mTicksPerBatch { 0 };
+	TrajectoryOptions mTrajectoryOptions;
+
+	QList<view::TwoDModelWidget *> mTwoDModelWindows;
+	QList<model::Model *> mTwoDModels;
+	QStringList mPendingFields;
+	QString mCurrentField;
+	QString mReportsFolder;
+	QString mTrajectoriesFolder;
+	bool mStopOnFail { true };
+	bool mFieldFinishScheduled { false };
+	bool mSomeFieldFailed { false };
 };
 
 }
@@ -0,0 +1,200 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "trajectoryWriter.h"
+
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QPointF>
+#include <QtCore/QtEndian>
+
+using namespace twoDModel;
+
+/// Accumulated records are written into the file when the buffer exceeds this size.
+const int bufferSize = 64 * 1024;
+
+TrajectoryWriter::TrajectoryWriter(const QString &fileName, TrajectoryFormat format)
+	: mFile(fileName)
+	, mFormat(format)
+{
+	if (!fileName.isEmpty() && mFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+		// Reserved buffer keeps its capacity when it is cleared after flushes.
+		mBuffer.reserve(2 * bufferSize);
+	}
+
+	mSinceFlush.start();
+}
+
+TrajectoryWriter::~TrajectoryWriter()
+{
+	flush();
+}
+
+bool TrajectoryWriter::formatByName(const QString &name, TrajectoryFormat &format)
+{
+	if (name == "json") {
+		format = TrajectoryFormat::json;
+	} else if (name == "ndjson") {
+		format = TrajectoryFormat::ndjson;
+	} else if (name == "binary") {
+		format = TrajectoryFormat::binary;
+	} else {
+		return false;
+	}
+
+	return true;
+}
+
+bool TrajectoryWriter::isOpen() const
+{
+	return mFile.isOpen();
+}
+
+QString TrajectoryWriter::errorString() const
+{
+	return mFile.errorString();
+}
+
+void TrajectoryWriter::begin()
+{
+	mFirstRecord = true;
+	switch (mFormat) {
+	case TrajectoryFormat::json:
+		mBuffer.append("[\n");
+		break;
+	case TrajectoryFormat::ndjson:
+		break;
+	case TrajectoryFormat::binary:
+		mBuffer.append(trajectoryBinary::magic);
+		mBuffer.append(static_cast<char>(trajectoryBinary::version));
+		break;
+	}
+}
+
+void TrajectoryWriter::end()
+{
+	if (mFormat == TrajectoryFormat::json) {
+		mBuffer.append("]\n");
+	}
+
+	flush();
+}
+
+void TrajectoryWriter::writeRobotPosition(const QString &robotId, int timestamp, const QPointF &position
+		, qreal rotation)
+{
+	if (mFormat != TrajectoryFormat::binary) {
+		writeText({
+			{ "robotId", robotId }
+			, { "timestamp", timestamp }
+			, { "x", position.x() }
+			, { "y", position.y() }
+			, { "rotation", rotation }
+		});
+		return;
+	}
+
+	QByteArray payload;
+	QDataStream stream(&payload, QIODevice::WriteOnly);
+	stream.setVersion(trajectoryBinary::streamVersion);
+	stream << static_cast<quint8>(trajectoryBinary::robotPosition) << robotId << static_cast<qint32>(timestamp)
+			<< static_cast<double>(position.x()) << static_cast<double>(position.y())
+			<< static_cast<double>(rotation);
+	writeBinary(payload);
+}
+
+void TrajectoryWriter::writeDeviceState(const QString &robotId, int timestamp, const QString &deviceType
+		, const QString &devicePort, const QString &property, const QJsonValue &value)
+{
+	if (mFormat != TrajectoryFormat::binary) {
+		writeText({
+			{ "robotId", robotId }
+			, { "timestamp", timestamp }
+			, { "device", deviceType }
+			, { "port", devicePort }
+			, { "property", property }
+			, { "value", value }
+		});
+		return;
+	}
+
+	QByteArray payload;
+	QDataStream stream(&payload, QIODevice::WriteOnly);
+	stream.setVersion(trajectoryBinary::streamVersion);
+	stream << static_cast<quint8>(trajectoryBinary::deviceState) << robotId << static_cast<qint32>(timestamp)
+			<< deviceType << devicePort << property
+			<< QJsonDocument(QJsonArray({ value })).toJson(QJsonDocument::Compact);
+	writeBinary(payload);
+}
+
+void TrajectoryWriter::write(const QJsonObject &record)
+{
+	if (mFormat != TrajectoryFormat::binary) {
+		writeText(record);
+	} else if (record.contains("device")) {
+		writeDeviceState(record["robotId"].toString(), record["timestamp"].toInt(), record["device"].toString()
+				, record["port"].toString(), record["property"].toString(), record["value"]);
+	} else {
+		writeRobotPosition(record["robotId"].toString(), record["timestamp"].toInt()
+				, QPointF(record["x"].toDouble(), record["y"].toDouble()), record["rotation"].toDouble());
+	}
+}
+
+void TrajectoryWriter::flush()
+{
+	mSinceFlush.restart();
+	if (mBuffer.isEmpty()) {
+		return;
+	}
+
+	if (mFile.isOpen()) {
+		mFile.write(mBuffer);
+		mFile.flush();
+	}
+
+	mBuffer.resize(0);
+}
+
+void TrajectoryWriter::writeText(const QJsonObject &record)
+{
+	if (mFormat == TrajectoryFormat::json) {
+		// Keeping exactly the same output as when each record was written separately.
+		if (!mFirstRecord) {
+			mBuffer.append(", ");
+		}
+
+		mBuffer.append(QJsonDocument(record).toJson());
+	} else {
+		mBuffer.append(QJsonDocument(record).toJson(QJsonDocument::Compact));
+		mBuffer.append('\n');
+	}
+
+	mFirstRecord = false;
+	if (mBuffer.size() >= bufferSize || mSinceFlush.hasExpired(flushInterval)) {
+		flush();
+	}
+}
+
+void TrajectoryWriter::writeBinary(const QByteArray &payload)
+{
+	uchar size[sizeof(quint32)];
+	qToBigEndian<quint32>(payload.size(), size);
+	mBuffer.append(reinterpret_cast<const char *>(size), sizeof(size));
+	mBuffer.append(payload);
+
+	mFirstRecord = false;
+	if (mBuffer.size() >= bufferSize || mSinceFlush.hasExpired(flushInterval)) {
+		flush();
+	}
+}
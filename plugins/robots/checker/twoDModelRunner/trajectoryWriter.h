@@ -0,0 +1,112 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QDataStream>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QJsonObject>
+
+class QPointF;
+
+namespace twoDModel {
+
+/// Formats in which robot trajectory and device states may be written.
+enum class TrajectoryFormat
+{
+	/// JSON array of indented objects, the default one.
+	json = 0
+	/// Newline-delimited JSON, each record is a compact JSON object on a separate line.
+	, ndjson
+	/// Binary stream, see trajectoryBinary namespace.
+	, binary
+};
+
+/// Binary trajectory starts with magic bytes and a version byte, followed by records. Each record is
+/// a big-endian quint32 size of its payload followed by the payload itself written by QDataStream: a quint8 record
+/// kind, robot id and qint32 timestamp, then double x, y and rotation for robot position records or device type,
+/// port, property name and compact JSON array with the only value for device state records.
+namespace trajectoryBinary {
+
+const char magic[] = "QRTRJ";
+const quint8 version = 1;
+const QDataStream::Version streamVersion = QDataStream::Qt_5_0;
+
+enum RecordKind : quint8
+{
+	robotPosition = 1
+	, deviceState
+};
+
+}
+
+/// Writes robot trajectory and device states into a file in one of trajectory formats.
+/// Records are accumulated in memory and written into the file in big chunks. A chunk is also written when
+/// flushInterval passed since the previous one, so readers of FIFOs get records without long delays.
+class TrajectoryWriter
+{
+public:
+	/// Accumulated records are written when a new record comes at least this count of milliseconds after
+	/// the previous write. Callers should also call flush() with this interval if records may stop coming.
+	static const int flushInterval = 100;
+
+	/// Opens the given file for writing. Nothing is written if the file name is empty or the file can not be opened.
+	TrajectoryWriter(const QString &fileName, TrajectoryFormat format);
+
+	/// Flushes all accumulated records.
+	~TrajectoryWriter();
+
+	/// Returns the format with the given name ("json", "ndjson" or "binary") into @a format.
+	/// @returns false if there is no such format.
+	static bool formatByName(const QString &name, TrajectoryFormat &format);
+
+	/// Returns true if records are really written into some file.
+	bool isOpen() const;
+
+	/// Returns a human-readable message of the last occured error.
+	QString errorString() const;
+
+	/// Writes the beginning of the stream, must be called before all records.
+	void begin();
+
+	/// Writes the ending of the stream and flushes it.
+	void end();
+
+	/// Writes the position of the robot with the given id at the moment @a timestamp milliseconds after
+	/// the interpretation start.
+	void writeRobotPosition(const QString &robotId, int timestamp, const QPointF &position, qreal rotation);
+
+	/// Writes modification of some robot`s device property.
+	void writeDeviceState(const QString &robotId, int timestamp, const QString &deviceType
+			, const QString &devicePort, const QString &property, const QJsonValue &value);
+
+	/// Writes the record read from some trajectory in JSON representation, used by converters.
+	void write(const QJsonObject &record);
+
+	/// Writes all accumulated records into the file.
+	void flush();
+
+private:
+	void writeText(const QJsonObject &record);
+	void writeBinary(const QByteArray &payload);
+
+	QFile mFile;
+	const TrajectoryFormat mFormat;
+	QByteArray mBuffer;
+	bool mFirstRecord { true };
+	QElapsedTimer mSinceFlush;
+};
+
+}
@@ -17,7 +17,7 @@ TEMPLATE = app
 CONFIG += cmdline
 include(../../../../global.pri)
 
-QT += widgets
+QT += widgets xml
 
 includes(plugins/robots/interpreters/interpreterCore \
 		plugins/robots/common/kitBase \
@@ -39,8 +39,14 @@ TRANSLATIONS = \
 HEADERS += \
 	$$PWD/runner.h \
 	$$PWD/reporter.h \
+	$$PWD/parallelRunner.h \
+	$$PWD/reportMerger.h \
+	$$PWD/trajectoryWriter.h \
 
 SOURCES += \
 	$$PWD/main.cpp \
 	$$PWD/runner.cpp \
 	$$PWD/reporter.cpp \
+	$$PWD/parallelRunner.cpp \
+	$$PWD/reportMerger.cpp \
+	$$PWD/trajectoryWriter.cpp \
@@ -30,12 +30,14 @@ public:
 			, kitBase::robotModel::RobotModelManagerInterface &robotModelManager
 			, qrtext::LanguageToolboxInterface &textLanguage
 			, const kitBase::EventsForKitPluginInterface &eventsForKitPlugin
-			, kitBase::InterpreterControlInterface &interpreterControl)
+			, kitBase::InterpreterControlInterface &interpreterControl
+			, bool headless = false)
 		: mQRealConfigurator(qRealConfigurator)
 		, mRobotModelManager(robotModelManager)
 		, mTextLanguage(textLanguage)
 		, mEventsForKitPlugin(eventsForKitPlugin)
 		, mInterpreterControl(interpreterControl)
+		, mHeadless(headless)
 	{
 	}
 
@@ -71,12 +73,20 @@ public:
 		return mInterpreterControl;
 	}
 
+	/// Returns true if plugin works without user interface, for example in checker. Kit plugins should not create
+	/// windows then.
+	bool headless() const
+	{
+		return mHeadless;
+	}
+
 private:
 	const qReal::PluginConfigurator &mQRealConfigurator;
 	kitBase::robotModel::RobotModelManagerInterface &mRobotModelManager;
 	qrtext::LanguageToolboxInterface &mTextLanguage;
 	const kitBase::EventsForKitPluginInterface &mEventsForKitPlugin;
 	kitBase::InterpreterControlInterface &mInterpreterControl;
+	const bool mHeadless;
 };
 
 }
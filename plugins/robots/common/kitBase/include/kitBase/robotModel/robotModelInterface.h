@@ -108,6 +108,10 @@ public:
 	/// Requests updates for all configured sensors.
 	virtual void updateSensorsValues() const = 0;
 
+	/// Requests updates for sensors configured on the given ports, the list may be empty. Models that can not query
+	/// sensors separately or have other sensor readers (like 2D model constraints) may update all of them.
+	virtual void updateSensorsValuesOnPorts(const QList<PortInfo> &ports) const = 0;
+
 	/// Returns time interval for polling sensors data.
 	virtual int updateIntervalForInterpretation() const = 0;
 
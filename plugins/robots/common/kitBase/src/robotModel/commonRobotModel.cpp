@@ -101,6 +101,17 @@ void CommonRobotModel::updateSensorsValues() const
 	}
 }
 
+void CommonRobotModel::updateSensorsValuesOnPorts(const QList<PortInfo> &ports) const
+{
+	for (const PortInfo &port : ports) {
+		robotParts::AbstractSensor * const sensor
+				= dynamic_cast<robotParts::AbstractSensor *>(mConfiguration.device(port));
+		if (sensor && sensor->ready() && !sensor->isLocked()) {
+			sensor->read();
+		}
+	}
+}
+
 int CommonRobotModel::updateIntervalForInterpretation() const
 {
 	return updateInterval;
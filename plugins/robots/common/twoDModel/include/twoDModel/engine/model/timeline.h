@@ -53,6 +53,13 @@ public:
 	/// Thus the immediate process modeling may be performed in background.
 	void setImmediateMode(bool immediateMode);
 
+	/// Sets the count of ticks emitted one after another in immediate mode without processing events between them.
+	/// Pending events (so the program reactions too) are processed only between such batches, control returns
+	/// to the main event loop once per frame of wall-clock time. Since batches are measured in simulated time
+	/// the modeling result does not depend on machine speed, but the program reacts on model changes with
+	/// the granularity of @arg ticks. 0 (default) means that events are processed before each tick.
+	void setTicksPerBatch(int ticks);
+
 public slots:
 	void start();
 	void stop(qReal::interpretation::StopReason reason);
@@ -80,6 +87,7 @@ signals:
 
 private slots:
 	void onTimer();
+	void runBatches();
 	void gotoNextFrame();
 	utils::AbstractTimer *produceTimerImpl();
 
@@ -94,6 +102,8 @@ private:
 	bool mIsStarted;
 	quint64 mTimestamp;
 	int mFrameLength = defaultFrameLength;
+	bool mImmediateMode = false;
+	int mTicksPerBatch = 0;
 };
 
 }
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <functional>
+
 #include <QtCore/QPoint>
 #include <QtCore/QList>
 #include <QtCore/QPair>
@@ -27,6 +29,10 @@
 
 class QGraphicsItem;
 
+namespace graphicsUtils {
+class AbstractItem;
+}
+
 namespace qReal {
 class ErrorReporterInterface;
 }
@@ -45,12 +51,17 @@ class CommentItem;
 namespace model {
 
 class RobotModel;
+class SolidItemsIndex;
 
 class TWO_D_MODEL_EXPORT WorldModel : public QObject
 {
 	Q_OBJECT
 
 public:
+	/// Maximal count of segments in one trace item. Appending a segment copies the path of the last item,
+	/// so chunks keep this copying bounded instead of growing with the whole trace.
+	static const int traceChunkSize = 128;
+
 	WorldModel();
 	~WorldModel();
 
@@ -97,9 +108,15 @@ public:
 	/// Returns a set of comments in the world model. Result is mapping of comments ids to comments themselves.
 	const QMap<QString, QSharedPointer<items::CommentItem>> &commentItems() const;
 
-	/// Returns a list of trace items on the floor.
+	/// Returns a list of trace items on the floor. Trace is stored in chunks of at most traceChunkSize segments
+	/// of the same pen, all chunks but the last one are never modified.
 	const QList<QSharedPointer<QGraphicsPathItem>> &trace() const;
 
+	/// Returns the first trace item of each stroke, i.e. of each run of segments drawn with the same pen.
+	/// Unlike trace(), it has one item per stroke however long it is, so it is used where trace items are
+	/// counted, for example by constraints.
+	const QList<QSharedPointer<QGraphicsPathItem>> &traceStrokes() const;
+
 	/// Appends \a wall into world model.
 	void addWall(const QSharedPointer<items::WallItem> &wall);
 
@@ -142,7 +159,8 @@ public:
 	/// Removes all walls, colored items, regions and robot traces from the world model.
 	void clear();
 
-	/// Appends one more segment of the given to the robot`s trace.
+	/// Appends one more segment of the given to the robot`s trace. Only the last trace chunk is modified, so
+	/// the cost does not depend on the length of the trace.
 	void appendRobotTrace(const QPen &pen, const QPointF &begin, const QPointF &end);
 
 	/// Removes all the segments from the current robot`s trace.
@@ -230,8 +248,11 @@ signals:
 	/// Emitted each time when model is appended with some new item.
 	void regionItemAdded(const QSharedPointer<items::RegionItem> &item);
 
-	/// Emitted each time when model is appended with some new item.
-	void traceItemAddedOrChanged(const QSharedPointer<QGraphicsPathItem> &item, bool justChanged);
+	/// Emitted each time when a new trace chunk is started. The chunk already contains its first segment.
+	void traceItemAdded(const QSharedPointer<QGraphicsPathItem> &item);
+
+	/// Emitted each time when a segment from \a begin to \a end is appended to the last trace chunk \a item.
+	void traceSegmentAppended(const QSharedPointer<QGraphicsPathItem> &item, const QPointF &begin, const QPointF &end);
 
 	/// Emitted each time when some item was removed from the 2D model world.
 	void itemRemoved(const QSharedPointer<QGraphicsItem> &item);
@@ -246,10 +267,14 @@ signals:
 	void backgroundImageItemAdded(items::ImageItem *item);
 
 private:
-	/// Returns true if ray intersects some wall.
-	bool checkRangeDistance(const int distance, const QPointF &position
-			, const qreal direction, const qreal scanningAngle, const QPainterPath &wallPath) const;
-	QPainterPath buildSolidItemsPath() const;
+	/// Returns the geometry of solid items that may be significant for queries within the given region.
+	QPainterPath solidItemsPath(const QRectF &region) const;
+
+	/// Adds the given item into solid items geometry cache and tracks its moves and reshapes.
+	void watchSolidItem(graphicsUtils::AbstractItem *item, const std::function<QPainterPath()> &pathProvider);
+
+	/// Removes the given item from solid items geometry cache.
+	void unwatchSolidItem(graphicsUtils::AbstractItem *item);
 
 	void serializeBackground(QDomElement &background, const QRect &rect, const Image * const img) const;
 	QRectF deserializeRect(const QString &string) const;
@@ -265,8 +290,10 @@ private:
 	RobotModel * mRobotModel {}; // Doesn't take ownership
 	QMap<QString, int> mOrder;
 	QList<QSharedPointer<QGraphicsPathItem>> mRobotTrace;
+	QList<QSharedPointer<QGraphicsPathItem>> mRobotTraceStrokes;
 	QRect mBackgroundRect;
 	QScopedPointer<QDomDocument> mXmlFactory;
+	QScopedPointer<SolidItemsIndex> mSolidItemsIndex;
 	qReal::ErrorReporterInterface *mErrorReporter;  // Doesn`t take ownership.
 };
 
@@ -46,6 +46,9 @@ public:
 	virtual kitBase::DevicesConfigurationProvider &devicesConfigurationProvider() = 0;
 
 	/// Performs 2D model`s initialization with the given system components.
+	/// @param headless If true then only the model itself (world, robot, physics, constraints checker and sensors)
+	/// will work, no 2D model window, its scene or dock will be created. Useful for checker runs where nobody
+	/// looks at the scene.
 	/// @todo: Separate twoD model engine from the enviroment (get rid of parameters)
 	virtual void init(const kitBase::EventsForKitPluginInterface &eventsForKitPlugin
 			, const qReal::SystemEvents &systemEvents
@@ -54,7 +57,8 @@ public:
 			, qReal::gui::MainWindowInterpretersInterface &interpretersInterface
 			, qReal::gui::MainWindowDockInterface &dockInterface
 			, const qReal::ProjectManagementInterface &projectManager
-			, kitBase::InterpreterControlInterface &interpreterControl) = 0;
+			, kitBase::InterpreterControlInterface &interpreterControl
+			, bool headless) = 0;
 
 public slots:
 	/// Starts interpretation process in 2D model.
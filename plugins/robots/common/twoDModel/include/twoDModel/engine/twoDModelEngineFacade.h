@@ -31,6 +31,8 @@ class SmartDock;
 
 namespace twoDModel {
 
+class TwoDModelEngineApi;
+
 namespace model {
 class Model;
 }
@@ -46,7 +48,8 @@ class TWO_D_MODEL_EXPORT TwoDModelEngineFacade : public TwoDModelControlInterfac
 	Q_OBJECT
 
 public:
-	/// @param configurer - allows to configure various model parameters specific to a kit. Takes ownership.
+	/// Creates the model of the world and the robot. 2D model window is created later in init() unless
+	/// the engine is initialized in headless mode.
 	explicit TwoDModelEngineFacade(twoDModel::robotModel::TwoDRobotModel &robotModel);
 
 	~TwoDModelEngineFacade() override;
@@ -58,7 +61,8 @@ public:
 			, qReal::gui::MainWindowInterpretersInterface &interpretersInterface
 			, qReal::gui::MainWindowDockInterface &dockInterface
 			, const qReal::ProjectManagementInterface &projectManager
-			, kitBase::InterpreterControlInterface &interpreterControl) override;
+			, kitBase::InterpreterControlInterface &interpreterControl
+			, bool headless) override;
 
 	kitBase::DevicesConfigurationProvider &devicesConfigurationProvider() override;
 
@@ -74,9 +78,9 @@ private:
 	const QString mRobotModelName;
 
 	QScopedPointer<model::Model> mModel;
-	QPointer<view::TwoDModelWidget> mView {};
-	QScopedPointer<TwoDModelEngineInterface> mApi;
-	utils::SmartDock *mDock;  // Transfers ownership to main window indirectly
+	QPointer<view::TwoDModelWidget> mView {};  // nullptr in headless mode and before init().
+	QScopedPointer<TwoDModelEngineApi> mApi;
+	utils::SmartDock *mDock {};  // Transfers ownership to main window indirectly, nullptr in headless mode.
 
 	qReal::TabInfo::TabType mCurrentTabInfo { qReal::TabInfo::TabType::other }; // temp hack
 };
@@ -20,6 +20,11 @@
 #include <kitBase/robotModel/portInfo.h>
 
 namespace twoDModel {
+
+namespace model {
+class Model;
+}
+
 namespace engine {
 
 class TwoDModelDisplayInterface;
@@ -102,6 +107,9 @@ public:
 	/// Returns an object for convenient searching and managing widgets of 2D model GUI.
 	virtual engine::TwoDModelGuiFacade &guiFacade() const = 0;
 
+	/// Returns the model of 2D emulator this engine works with. Useful when there is no 2D model window.
+	virtual model::Model &model() const = 0;
+
 	// TODO: remove hack with video port name
 	virtual kitBase::robotModel::PortInfo videoPort() const = 0;
 
@@ -33,7 +33,12 @@ class TWO_D_MODEL_EXPORT TwoDModelGuiFacade : public QObject
 	Q_OBJECT
 
 public:
-	explicit TwoDModelGuiFacade(view::TwoDModelWidget &d2RobotWidget);
+	/// @param d2RobotWidget 2D model window, may be nullptr if 2D model works in headless mode. All methods
+	/// return nullptr then.
+	explicit TwoDModelGuiFacade(view::TwoDModelWidget *d2RobotWidget);
+
+	/// Sets 2D model window, may be nullptr if 2D model works in headless mode.
+	void setTwoDModelWidget(view::TwoDModelWidget *d2RobotWidget);
 
 	/// Searches and returns widget by type and object name.
 	Q_INVOKABLE QWidget *widget(const QString &type, const QString &name) const;
@@ -49,7 +54,7 @@ public:
 	Q_INVOKABLE QWidget *separateTwoDModelWindow() const;
 
 private:
-	view::TwoDModelWidget &mD2ModelWidget;
+	view::TwoDModelWidget *mD2ModelWidget;  // Does not have ownership.
 };
 
 }
@@ -43,6 +43,11 @@ public:
 	QString friendlyName() const override;
 	bool needsConnection() const override;
 	int updateIntervalForInterpretation() const override;
+
+	/// Polls all sensors if the 2D model has constraints, since they may check any sensor
+	/// (like "robot1.A1.value"), not only the ones on the given ports.
+	void updateSensorsValuesOnPorts(const QList<kitBase::robotModel::PortInfo> &ports) const override;
+
 	utils::TimelineInterface &timeline() override;
 	QList<kitBase::robotModel::PortInfo> configurablePorts() const override;
 	QList<kitBase::robotModel::DeviceInfo> convertibleBases() const override;
@@ -57,7 +57,9 @@ ConstraintsChecker::ConstraintsChecker(qReal::ErrorReporterInterface &errorRepor
 
 	bindToWorldModelObjects();
 	bindToRobotObjects();
-	mObjects["trace"] = new utils::ObjectsSet<QSharedPointer<QGraphicsPathItem>>(mModel.worldModel().trace(), this);
+	// Trace is stored in chunks of limited size, but constraints count strokes like before.
+	mObjects["trace"] = new utils::ObjectsSet<QSharedPointer<QGraphicsPathItem>>(
+			mModel.worldModel().traceStrokes(), this);
 }
 
 ConstraintsChecker::~ConstraintsChecker()
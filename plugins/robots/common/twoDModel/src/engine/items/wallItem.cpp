@@ -38,6 +38,12 @@ WallItem::WallItem(const QPointF &begin, const QPointF &end)
 	connect(this, &AbstractItem::mouseInteractionStarted, this, [this](){
 			mEstimatedPos = pos();
 		});
+	// Keeping the path actual even if the wall is not painted, world model caches it as collision geometry.
+	connect(this, &AbstractItem::x1Changed, this, &WallItem::recalculateBorders);
+	connect(this, &AbstractItem::y1Changed, this, &WallItem::recalculateBorders);
+	connect(this, &AbstractItem::x2Changed, this, &WallItem::recalculateBorders);
+	connect(this, &AbstractItem::y2Changed, this, &WallItem::recalculateBorders);
+	recalculateBorders();
 }
 
 WallItem *WallItem::clone() const
@@ -213,7 +213,7 @@ void Model::replaceRobotModel(twoDModel::robotModel::TwoDRobotModel &newModel)
 
 bool Model::hasConstraints() const
 {
-	return mChecker->hasConstraints();
+	return mChecker && mChecker->hasConstraints();
 }
 
 void Model::setConstraintsEnabled(bool enabled)
@@ -0,0 +1,159 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "rayCaster.h"
+
+#include <cmath>
+
+#include <QtCore/QtMath>
+#include <QtCore/qnumeric.h>
+
+using namespace twoDModel::model;
+
+namespace {
+
+const qreal epsilon = 1e-9;
+const int fullCircle = 360;
+
+/// Brings the given angle in degrees into (-180, 180] range.
+qreal normalized(qreal angle)
+{
+	angle = std::fmod(angle, fullCircle);
+	if (angle > fullCircle / 2) {
+		angle -= fullCircle;
+	} else if (angle <= -fullCircle / 2) {
+		angle += fullCircle;
+	}
+
+	return angle;
+}
+
+qreal cross(const QPointF &first, const QPointF &second)
+{
+	return first.x() * second.y() - first.y() * second.x();
+}
+
+/// Returns the point of @a segment nearest to @a point.
+QPointF nearestPoint(const QLineF &segment, const QPointF &point)
+{
+	const QPointF vector = segment.p2() - segment.p1();
+	const qreal squaredLength = QPointF::dotProduct(vector, vector);
+	if (squaredLength < epsilon) {
+		return segment.p1();
+	}
+
+	const qreal t = QPointF::dotProduct(point - segment.p1(), vector) / squaredLength;
+	return segment.p1() + qBound(0.0, t, 1.0) * vector;
+}
+
+}
+
+RayCaster::RayCaster(const QPointF &position, const QVector<QLineF> &outline)
+	: mPosition(position)
+	, mOutline(outline)
+{
+}
+
+qreal RayCaster::distance(qreal direction, qreal angle) const
+{
+	qreal result = qInf();
+	for (const QLineF &segment : mOutline) {
+		result = qMin(result, distance(segment, direction, angle / 2));
+	}
+
+	return result;
+}
+
+QVector<qreal> RayCaster::sweep(qreal direction, int count) const
+{
+	QVector<qreal> result(count, qInf());
+	const int beams = qMin(count, fullCircle);
+	for (const QLineF &segment : mOutline) {
+		// Angular span of the segment as seen from the position, the segment is seen at less than 180 degrees
+		// if it does not pass through the position itself.
+		int first = 0;
+		int last = beams - 1;
+		if (QLineF(mPosition, nearestPoint(segment, mPosition)).length() > epsilon) {
+			const qreal p1Angle = normalized(qRadiansToDegrees(qAtan2(segment.y1() - mPosition.y()
+					, segment.x1() - mPosition.x())) - direction);
+			const qreal span = normalized(qRadiansToDegrees(qAtan2(segment.y2() - mPosition.y()
+					, segment.x2() - mPosition.x())) - direction - p1Angle);
+			const qreal from = span >= 0 ? p1Angle : p1Angle + span;
+			first = qFloor(from - 0.5);
+			last = qCeil(from + qAbs(span) + 0.5);
+		}
+
+		for (int i = first; i <= last; ++i) {
+			const int beam = (i % fullCircle + fullCircle) % fullCircle;
+			if (beam < beams) {
+				result[beam] = qMin(result[beam], distance(segment, direction + beam, 0.5));
+			}
+		}
+	}
+
+	for (int i = fullCircle; i < count; ++i) {
+		result[i] = result[i % fullCircle];
+	}
+
+	return result;
+}
+
+qreal RayCaster::distance(const QLineF &segment, qreal direction, qreal halfAngle) const
+{
+	const QPointF nearest = nearestPoint(segment, mPosition);
+	if (halfAngle >= fullCircle / 2) {
+		return QLineF(mPosition, nearest).length();
+	}
+
+	// Distance along the segment has the only minimum, so within each part of the segment inside the sector
+	// the nearest point is either the nearest point of the whole segment or one of the part ends.
+	qreal result = qInf();
+	for (const QPointF &point : { nearest, segment.p1(), segment.p2() }) {
+		if (inSector(point, direction, halfAngle)) {
+			result = qMin(result, QLineF(mPosition, point).length());
+		}
+	}
+
+	result = qMin(result, rayDistance(segment, direction - halfAngle));
+	result = qMin(result, rayDistance(segment, direction + halfAngle));
+	return result;
+}
+
+bool RayCaster::inSector(const QPointF &point, qreal direction, qreal halfAngle) const
+{
+	const QPointF vector = point - mPosition;
+	if (qAbs(vector.x()) < epsilon && qAbs(vector.y()) < epsilon) {
+		return true;
+	}
+
+	const qreal angle = qRadiansToDegrees(qAtan2(vector.y(), vector.x()));
+	return qAbs(normalized(angle - direction)) <= halfAngle + epsilon;
+}
+
+qreal RayCaster::rayDistance(const QLineF &segment, qreal direction) const
+{
+	const qreal radians = qDegreesToRadians(direction);
+	const QPointF ray(qCos(radians), qSin(radians));
+	const QPointF vector = segment.p2() - segment.p1();
+	const qreal denominator = cross(ray, vector);
+	if (qAbs(denominator) < epsilon) {
+		// Parallel segments are handled by their ends.
+		return qInf();
+	}
+
+	const QPointF toSegment = segment.p1() - mPosition;
+	const qreal t = cross(toSegment, vector) / denominator;
+	const qreal s = cross(toSegment, ray) / denominator;
+	return t >= 0 && s >= -epsilon && s <= 1 + epsilon ? t : qInf();
+}
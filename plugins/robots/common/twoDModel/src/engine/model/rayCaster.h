@@ -0,0 +1,56 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QLineF>
+#include <QtCore/QVector>
+
+namespace twoDModel {
+namespace model {
+
+/// Measures distances from some point to the outlines of solid items within angular sectors, like range
+/// sensors and lidars do. Works on outline segments directly, so no path clipping is performed.
+/// Directions are given in degrees clockwise from the x axis of the scene.
+class RayCaster
+{
+public:
+	/// @param position The point from where the distances are measured.
+	/// @param outline Segments of solid items outlines.
+	RayCaster(const QPointF &position, const QVector<QLineF> &outline);
+
+	/// Returns the distance to the nearest outline point within the sector of width @a angle centered in
+	/// @a direction or infinity if there is no such point.
+	qreal distance(qreal direction, qreal angle) const;
+
+	/// Returns distances for @a count sectors one degree wide each, the i-th of them is centered in
+	/// @a direction + i. Each outline segment is looked through only once.
+	QVector<qreal> sweep(qreal direction, int count) const;
+
+private:
+	/// Returns the distance to the nearest point of @a segment within the sector or infinity.
+	qreal distance(const QLineF &segment, qreal direction, qreal halfAngle) const;
+
+	/// Returns true if the given point is inside the sector.
+	bool inSector(const QPointF &point, qreal direction, qreal halfAngle) const;
+
+	/// Returns the distance to the point where the ray intersects @a segment or infinity.
+	qreal rayDistance(const QLineF &segment, qreal direction) const;
+
+	const QPointF mPosition;
+	const QVector<QLineF> mOutline;
+};
+
+}
+}
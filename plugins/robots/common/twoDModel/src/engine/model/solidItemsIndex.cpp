@@ -0,0 +1,237 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "solidItemsIndex.h"
+
+#include <algorithm>
+
+#include <QtCore/QtMath>
+
+using namespace twoDModel::model;
+
+void SolidItemsIndex::insert(const QGraphicsItem *item, const std::function<QPainterPath()> &pathProvider)
+{
+	remove(item);
+	Entry &entry = mEntries[item];
+	entry.pathProvider = pathProvider;
+	entry.order = mNextOrder++;
+	mOutdatedItems.insert(item);
+}
+
+void SolidItemsIndex::remove(const QGraphicsItem *item)
+{
+	auto entry = mEntries.find(item);
+	if (entry == mEntries.end()) {
+		return;
+	}
+
+	if (!mOutdatedItems.remove(item)) {
+		unplace(item, entry.value());
+	}
+
+	mEntries.erase(entry);
+}
+
+void SolidItemsIndex::invalidate(const QGraphicsItem *item)
+{
+	auto entry = mEntries.find(item);
+	if (entry == mEntries.end() || mOutdatedItems.contains(item)) {
+		return;
+	}
+
+	unplace(item, entry.value());
+	mOutdatedItems.insert(item);
+}
+
+void SolidItemsIndex::clear()
+{
+	mEntries.clear();
+	mGrid.clear();
+	mLargeItems.clear();
+	mOutdatedItems.clear();
+}
+
+QPainterPath SolidItemsIndex::path(const QRectF &region) const
+{
+	QPainterPath result;
+	for (const Entry *entry : entries(region)) {
+		result.addPath(entry->path);
+	}
+
+	return result;
+}
+
+QPainterPath SolidItemsIndex::path() const
+{
+	update();
+	QSet<const QGraphicsItem *> items;
+	for (auto entry = mEntries.cbegin(); entry != mEntries.cend(); ++entry) {
+		items.insert(entry.key());
+	}
+
+	QPainterPath result;
+	for (const Entry *entry : sorted(items)) {
+		result.addPath(entry->path);
+	}
+
+	return result;
+}
+
+QVector<QLineF> SolidItemsIndex::outline(const QRectF &region) const
+{
+	QVector<QLineF> result;
+	for (const Entry *entry : entries(region)) {
+		result += entry->outline;
+	}
+
+	return result;
+}
+
+bool SolidItemsIndex::contains(const QPointF &point) const
+{
+	for (const Entry *entry : entries(QRectF(point, QSizeF()))) {
+		if (entry->path.contains(point)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+QList<const SolidItemsIndex::Entry *> SolidItemsIndex::entries(const QRectF &region) const
+{
+	update();
+	QSet<const QGraphicsItem *> candidates = mLargeItems;
+	const QRect range = cellsRange(region);
+	if (static_cast<qint64>(range.width()) * range.height() > mGrid.size()) {
+		// The region is huge, it is cheaper to look through non-empty cells.
+		for (auto cell = mGrid.cbegin(); cell != mGrid.cend(); ++cell) {
+			candidates += cell.value();
+		}
+	} else {
+		for (int x = range.left(); x <= range.right(); ++x) {
+			for (int y = range.top(); y <= range.bottom(); ++y) {
+				const auto cell = mGrid.constFind(cellKey(x, y));
+				if (cell != mGrid.cend()) {
+					candidates += cell.value();
+				}
+			}
+		}
+	}
+
+	QSet<const QGraphicsItem *> result;
+	for (const QGraphicsItem *item : candidates) {
+		if (overlap(mEntries[item].path.controlPointRect(), region)) {
+			result.insert(item);
+		}
+	}
+
+	return sorted(result);
+}
+
+bool SolidItemsIndex::overlap(const QRectF &first, const QRectF &second)
+{
+	// Unlike QRectF::intersects() degenerate rects (like the ones of straight lines) are also considered here.
+	return first.left() <= second.right() && second.left() <= first.right()
+			&& first.top() <= second.bottom() && second.top() <= first.bottom();
+}
+
+quint64 SolidItemsIndex::cellKey(int x, int y)
+{
+	return (static_cast<quint64>(static_cast<quint32>(x)) << 32) | static_cast<quint32>(y);
+}
+
+QRect SolidItemsIndex::cellsRange(const QRectF &rect)
+{
+	const int left = qFloor(rect.left() / cellSize);
+	const int top = qFloor(rect.top() / cellSize);
+	const int right = qFloor(rect.right() / cellSize);
+	const int bottom = qFloor(rect.bottom() / cellSize);
+	return QRect(QPoint(left, top), QPoint(right, bottom));
+}
+
+void SolidItemsIndex::update() const
+{
+	for (const QGraphicsItem *item : mOutdatedItems) {
+		Entry &entry = mEntries[item];
+		entry.path = entry.pathProvider();
+		entry.outline.clear();
+		for (const QPolygonF &polygon : entry.path.toSubpathPolygons()) {
+			for (int i = 0; i < polygon.size(); ++i) {
+				// Subpaths are closed when filled, so the last point is connected with the first one too.
+				const QLineF segment(polygon[i], polygon[(i + 1) % polygon.size()]);
+				if (segment.p1() != segment.p2()) {
+					entry.outline << segment;
+				}
+			}
+		}
+
+		place(item, entry);
+	}
+
+	mOutdatedItems.clear();
+}
+
+void SolidItemsIndex::place(const QGraphicsItem *item, Entry &entry) const
+{
+	entry.cells.clear();
+	const QRect range = cellsRange(entry.path.controlPointRect());
+	entry.large = static_cast<qint64>(range.width()) * range.height() > maxCellsPerItem;
+	if (entry.large) {
+		mLargeItems.insert(item);
+		return;
+	}
+
+	for (int x = range.left(); x <= range.right(); ++x) {
+		for (int y = range.top(); y <= range.bottom(); ++y) {
+			const quint64 key = cellKey(x, y);
+			mGrid[key].insert(item);
+			entry.cells << key;
+		}
+	}
+}
+
+void SolidItemsIndex::unplace(const QGraphicsItem *item, Entry &entry) const
+{
+	if (entry.large) {
+		mLargeItems.remove(item);
+	}
+
+	for (const quint64 key : entry.cells) {
+		auto cell = mGrid.find(key);
+		if (cell != mGrid.end()) {
+			cell.value().remove(item);
+			if (cell.value().isEmpty()) {
+				mGrid.erase(cell);
+			}
+		}
+	}
+
+	entry.cells.clear();
+	entry.large = false;
+}
+
+QList<const SolidItemsIndex::Entry *> SolidItemsIndex::sorted(const QSet<const QGraphicsItem *> &items) const
+{
+	QList<const Entry *> result;
+	for (const QGraphicsItem *item : items) {
+		result << &mEntries[item];
+	}
+
+	std::sort(result.begin(), result.end(), [](const Entry *first, const Entry *second) {
+		return first->order < second->order;
+	});
+
+	return result;
+}
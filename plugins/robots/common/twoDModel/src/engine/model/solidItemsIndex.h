@@ -0,0 +1,97 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <functional>
+
+#include <QtCore/QHash>
+#include <QtCore/QLineF>
+#include <QtCore/QSet>
+#include <QtGui/QPainterPath>
+
+class QGraphicsItem;
+
+namespace twoDModel {
+namespace model {
+
+/// Caches the geometry of solid world items (walls, skittles, balls) and distributes their bounding rects
+/// over a uniform grid, so geometric queries look only at the items near the queried region.
+/// Item geometry is obtained once and kept till the item is marked as changed with invalidate().
+class SolidItemsIndex
+{
+public:
+	/// Size of the grid cell in pixels.
+	static const int cellSize = 128;
+
+	/// Items covering more cells than this are not distributed over the grid and are checked by each query.
+	static const int maxCellsPerItem = 64;
+
+	/// Adds the given item into the index, its geometry in scene coordinates will be obtained from
+	/// @a pathProvider each time when the item is invalidated. Does not take ownership on @a item.
+	void insert(const QGraphicsItem *item, const std::function<QPainterPath()> &pathProvider);
+
+	/// Removes the given item from the index.
+	void remove(const QGraphicsItem *item);
+
+	/// Marks the geometry of the given item outdated, it will be obtained again on the next query.
+	void invalidate(const QGraphicsItem *item);
+
+	/// Removes all items from the index.
+	void clear();
+
+	/// Returns the geometry of all the items whose bounding rects intersect the given region.
+	/// Items geometry is united in the order they were inserted, so the result is the part of the whole
+	/// world geometry that is significant for any query within @a region.
+	QPainterPath path(const QRectF &region) const;
+
+	/// Returns the geometry of all the items.
+	QPainterPath path() const;
+
+	/// Returns outline segments of all the items whose bounding rects intersect the given region.
+	QVector<QLineF> outline(const QRectF &region) const;
+
+	/// Returns true if the given point is inside some item.
+	bool contains(const QPointF &point) const;
+
+private:
+	struct Entry
+	{
+		std::function<QPainterPath()> pathProvider;
+		QPainterPath path;
+		QVector<QLineF> outline;
+		QList<quint64> cells;
+		bool large = false;
+		quint64 order = 0;
+	};
+
+	static quint64 cellKey(int x, int y);
+	static QRect cellsRange(const QRectF &rect);
+	static bool overlap(const QRectF &first, const QRectF &second);
+
+	void update() const;
+	QList<const Entry *> entries(const QRectF &region) const;
+	void place(const QGraphicsItem *item, Entry &entry) const;
+	void unplace(const QGraphicsItem *item, Entry &entry) const;
+	QList<const Entry *> sorted(const QSet<const QGraphicsItem *> &items) const;
+
+	mutable QHash<const QGraphicsItem *, Entry> mEntries;
+	mutable QHash<quint64, QSet<const QGraphicsItem *>> mGrid;
+	mutable QSet<const QGraphicsItem *> mLargeItems;
+	mutable QSet<const QGraphicsItem *> mOutdatedItems;
+	quint64 mNextOrder = 0;
+};
+
+}
+}
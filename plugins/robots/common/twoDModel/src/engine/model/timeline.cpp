@@ -66,6 +66,11 @@ void Timeline::onTimer()
 		return;
 	}
 
+	if (mImmediateMode && mTicksPerBatch > 0) {
+		runBatches();
+		return;
+	}
+
 	for (int i = 0; i < ticksPerCycle; ++i) {
 		QCoreApplication::processEvents();
 		if (mIsStarted) {
@@ -90,6 +95,24 @@ void Timeline::onTimer()
 	}
 }
 
+void Timeline::runBatches()
+{
+	const qint64 yieldTimestamp = QDateTime::currentMSecsSinceEpoch() + defaultFrameLength;
+	do {
+		QCoreApplication::processEvents();
+		for (int i = 0; i < mTicksPerBatch && mIsStarted; ++i) {
+			mTimestamp += timeInterval;
+			emit tick();
+			++mCyclesCount;
+			if (mCyclesCount >= mSpeedFactor) {
+				mCyclesCount = 0;
+				emit nextFrame();
+			}
+		}
+		// Wall-clock time is checked only on batch boundaries, so it does not affect simulated one.
+	} while (mIsStarted && QDateTime::currentMSecsSinceEpoch() < yieldTimestamp);
+}
+
 void Timeline::gotoNextFrame()
 {
 	emit nextFrame();
@@ -129,6 +152,12 @@ void Timeline::setImmediateMode(bool immediateMode)
 	mTimer.setInterval(immediateMode ? 0 : defaultRealTimeInterval);
 	setSpeedFactor(immediateMode ? immediateSpeedFactor : normalSpeedFactor);
 	mFrameLength = immediateMode ? 0 : defaultFrameLength;
+	mImmediateMode = immediateMode;
+}
+
+void Timeline::setTicksPerBatch(int ticks)
+{
+	mTicksPerBatch = qMax(0, ticks);
 }
 
 void Timeline::setSpeedFactor(int factor)
@@ -12,6 +12,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License. */
 
+#include <QtCore/QtMath>
 #include <QtGui/QTransform>
 #include <QtCore/QStringList>
 #include <QtCore/QUuid>
@@ -22,6 +23,8 @@
 #include "twoDModel/engine/model/worldModel.h"
 #include "twoDModel/engine/model/image.h"
 #include "twoDModel/engine/model/robotModel.h"
+#include "rayCaster.h"
+#include "solidItemsIndex.h"
 
 #include "src/engine/items/wallItem.h"
 #include "src/engine/items/skittleItem.h"
@@ -49,6 +52,7 @@ QGraphicsPathItem *debugPath = nullptr;
 
 WorldModel::WorldModel()
 	: mXmlFactory(new QDomDocument)
+	, mSolidItemsIndex(new SolidItemsIndex)
 	, mErrorReporter(nullptr)
 {
 }
@@ -67,57 +71,38 @@ qreal WorldModel::pixelsInCm() const
 
 QVector<int> WorldModel::lidarReading(const QPointF &position, qreal direction, int maxDistance, qreal maxAngle) const
 {
+	const int beamsCount = qMax(0, qCeil(maxAngle));
+	const qreal rangeInPixels = maxDistance * pixelsInCm();
+	if (mSolidItemsIndex->contains(position)) {
+		return QVector<int>(beamsCount, 0);
+	}
+
+	const RayCaster rayCaster(position, mSolidItemsIndex->outline(QRectF(position.x() - rangeInPixels
+			, position.y() - rangeInPixels, 2 * rangeInPixels, 2 * rangeInPixels)));
 	QVector<int> res;
-	const auto solidItemsPath = buildSolidItemsPath();
-	auto angleAndRange = QPair<qreal, int>(1, maxDistance);
-	for (int i = 0; i < maxAngle; i++) {
-		auto laserPath = rangeSensorScanningRegion(position, direction + i, angleAndRange);
-		const auto intersection = solidItemsPath.intersected(laserPath);
-		int currentRangeInCm = INT_MAX;
-		for (int j = 0; j < intersection.elementCount(); j++) {
-			auto el = intersection.elementAt(j);
-			if (el.type != QPainterPath::CurveToDataElement) {
-				auto lenght = QLineF(position, QPointF(el)).length() / pixelsInCm();
-				if (lenght < currentRangeInCm) {
-					currentRangeInCm = static_cast<int>(lenght);
-				}
-			}
-		}
-		res.append(currentRangeInCm <= maxDistance ? currentRangeInCm : 0);
+	for (const qreal distance : rayCaster.sweep(direction, beamsCount)) {
+		res.append(distance <= rangeInPixels ? static_cast<int>(distance / pixelsInCm()) : 0);
 	}
+
 	return res;
 }
 
 int WorldModel::rangeReading(const QPointF &position, qreal direction, int maxDistance, qreal maxAngle) const
 {
-	int maxRangeCms = maxDistance;
-	int minRangeCms = 0;
-	int currentRangeInCm = (minRangeCms + maxRangeCms) / 2;
-
-	const QPainterPath path = buildSolidItemsPath();
-	if (!checkRangeDistance(maxRangeCms, position, direction, maxAngle, path)) {
-		return maxRangeCms;
+	if (mSolidItemsIndex->contains(position)) {
+		return 0;
 	}
 
-	for ( ; minRangeCms < maxRangeCms;
-			currentRangeInCm = (minRangeCms + maxRangeCms) / 2)
-	{
-		if (checkRangeDistance(currentRangeInCm, position, direction, maxAngle, path)) {
-			maxRangeCms = currentRangeInCm;
-		} else {
-			minRangeCms = currentRangeInCm + 1;
-		}
+	const qreal rangeInPixels = maxDistance * pixelsInCm();
+	const QRectF region = rangeSensorScanningRegion(position, direction
+			, QPair<qreal, int>(maxAngle, maxDistance)).boundingRect();
+	const qreal distance = RayCaster(position, mSolidItemsIndex->outline(region)).distance(direction, maxAngle);
+	if (distance > rangeInPixels) {
+		return maxDistance;
 	}
 
-	return currentRangeInCm;
-}
-
-bool WorldModel::checkRangeDistance(const int distance, const QPointF &position
-		, const qreal direction, const qreal scanningAngle, const QPainterPath &wallPath) const
-{
-	const QPainterPath rayPath = rangeSensorScanningRegion(position, direction
-			, QPair<qreal,int>(scanningAngle, distance));
-	return rayPath.intersects(wallPath);
+	// The reading is the smallest whole distance in cm at which the scanning region touches some item.
+	return qMin(maxDistance, qCeil(distance / pixelsInCm()));
 }
 
 QPainterPath WorldModel::rangeSensorScanningRegion(const QPointF &position, QPair<qreal,int> angleAndRange) const
@@ -143,7 +128,7 @@ bool WorldModel::checkCollision(const QPainterPath &path) const
 {
 #ifdef D2_MODEL_FRAMES_DEBUG
 	delete debugPath;
-	QPainterPath commonPath = buildSolidItemsPath();
+	QPainterPath commonPath = mSolidItemsIndex->path();
 	commonPath.addPath(path);
 	debugPath = new QGraphicsPathItem(commonPath);
 	debugPath->setBrush(Qt::red);
@@ -160,7 +145,7 @@ bool WorldModel::checkCollision(const QPainterPath &path) const
 	}
 #endif
 
-	return buildSolidItemsPath().intersects(path);
+	return solidItemsPath(path.boundingRect()).intersects(path);
 }
 
 const QMap<QString, QSharedPointer<items::WallItem> > &WorldModel::walls() const
@@ -187,6 +172,7 @@ void WorldModel::addWall(const QSharedPointer<items::WallItem> &wall)
 	}
 
 	mWalls[id] = wall;
+	watchSolidItem(wall.data(), [item = wall.data()]() { return item->path(); });
 	mOrder[id] = mOrder.size();
 	emit wallAdded(wall);
 }
@@ -194,6 +180,7 @@ void WorldModel::addWall(const QSharedPointer<items::WallItem> &wall)
 void WorldModel::removeWall(QSharedPointer<items::WallItem> wall)
 {
 	mWalls.remove(wall->id());
+	unwatchSolidItem(wall.data());
 	emit itemRemoved(wall);
 }
 
@@ -206,12 +193,14 @@ void WorldModel::addSkittle(const QSharedPointer<items::SkittleItem> &skittle)
 	}
 
 	mSkittles[id] = skittle;
+	watchSolidItem(skittle.data(), [item = skittle.data()]() { return item->path(); });
 	emit skittleAdded(skittle);
 }
 
 void WorldModel::removeSkittle(QSharedPointer<items::SkittleItem> skittle)
 {
 	mSkittles.remove(skittle->id());
+	unwatchSolidItem(skittle.data());
 	emit itemRemoved(skittle);
 }
 
@@ -224,12 +213,14 @@ void WorldModel::addBall(const QSharedPointer<items::BallItem> &ball)
 	}
 
 	mBalls[id] = ball;
+	watchSolidItem(ball.data(), [item = ball.data()]() { return item->path(); });
 	emit ballAdded(ball);
 }
 
 void WorldModel::removeBall(QSharedPointer<items::BallItem> ball)
 {
 	mBalls.remove(ball->id());
+	unwatchSolidItem(ball.data());
 	emit itemRemoved(ball);
 }
 
@@ -276,6 +267,11 @@ const QList<QSharedPointer<QGraphicsPathItem> > &WorldModel::trace() const
 	return mRobotTrace;
 }
 
+const QList<QSharedPointer<QGraphicsPathItem>> &WorldModel::traceStrokes() const
+{
+	return mRobotTraceStrokes;
+}
+
 void WorldModel::addColorField(const QSharedPointer<items::ColorFieldItem> &colorField)
 {
 	const QString id = colorField->id();
@@ -384,7 +380,9 @@ void WorldModel::appendRobotTrace(const QPen &pen, const QPointF &begin, const Q
 	if (pen.color() == QColor(Qt::transparent)) {
 		return;
 	}
-	if (mRobotTrace.isEmpty() || mRobotTrace.last()->pen() != pen) {
+	const bool newStroke = mRobotTrace.isEmpty() || mRobotTrace.last()->pen() != pen;
+	// Each segment is stored as a pair of moveTo and lineTo elements.
+	if (newStroke || mRobotTrace.last()->path().elementCount() >= 2 * traceChunkSize) {
 		auto path = QPainterPath(begin);
 		path.lineTo(end);
 		auto traceItem = QSharedPointer<QGraphicsPathItem>::create(path);
@@ -392,18 +390,23 @@ void WorldModel::appendRobotTrace(const QPen &pen, const QPointF &begin, const Q
 		traceItem->setZValue(graphicsUtils::AbstractItem::ZValue::Marker);
 		emit robotTraceAppearedOrDisappeared(true);
 		mRobotTrace << traceItem;
-		emit traceItemAddedOrChanged(traceItem, false);
+		if (newStroke) {
+			mRobotTraceStrokes << traceItem;
+		}
+
+		emit traceItemAdded(traceItem);
 	} else {
 		auto path = mRobotTrace.last()->path();
 		path.moveTo(begin);
 		path.lineTo(end);
 		mRobotTrace.last()->setPath(path);
-		emit traceItemAddedOrChanged(mRobotTrace.last(), true);
+		emit traceSegmentAppended(mRobotTrace.last(), begin, end);
 	}
 }
 
 void WorldModel::clearRobotTrace()
 {
+	mRobotTraceStrokes.clear();
 	while (!mRobotTrace.isEmpty()) {
 		auto const toRemove = mRobotTrace.first();
 		mRobotTrace.removeOne(toRemove);
@@ -413,24 +416,30 @@ void WorldModel::clearRobotTrace()
 	emit robotTraceAppearedOrDisappeared(false);
 }
 
-QPainterPath WorldModel::buildSolidItemsPath() const
+QPainterPath WorldModel::solidItemsPath(const QRectF &region) const
 {
-	/// @todo Maintain a cache for this.
-	QPainterPath path;
-
-	for (auto &&wall : mWalls) {
-		path.addPath(wall->path());
-	}
-
-	for (auto &&skittle: mSkittles) {
-		path.addPath(skittle->path());
-	}
+	return mSolidItemsIndex->path(region);
+}
 
-	for (auto &&ball: mBalls) {
-		path.addPath(ball->path());
-	}
+void WorldModel::watchSolidItem(graphicsUtils::AbstractItem *item, const std::function<QPainterPath()> &pathProvider)
+{
+	mSolidItemsIndex->insert(item, pathProvider);
+	const auto invalidate = [this, item]() { mSolidItemsIndex->invalidate(item); };
+	connect(item, &QGraphicsObject::xChanged, this, invalidate);
+	connect(item, &QGraphicsObject::yChanged, this, invalidate);
+	connect(item, &QGraphicsObject::rotationChanged, this, invalidate);
+	connect(item, &QGraphicsObject::scaleChanged, this, invalidate);
+	connect(item, &graphicsUtils::AbstractItem::x1Changed, this, invalidate);
+	connect(item, &graphicsUtils::AbstractItem::y1Changed, this, invalidate);
+	connect(item, &graphicsUtils::AbstractItem::x2Changed, this, invalidate);
+	connect(item, &graphicsUtils::AbstractItem::y2Changed, this, invalidate);
+	connect(item, &graphicsUtils::AbstractItem::penChanged, this, invalidate);
+}
 
-	return path;
+void WorldModel::unwatchSolidItem(graphicsUtils::AbstractItem *item)
+{
+	disconnect(item, nullptr, this, nullptr);
+	mSolidItemsIndex->remove(item);
 }
 
 void WorldModel::serializeBackground(QDomElement &background, const QRect &rect, const Image * const img) const
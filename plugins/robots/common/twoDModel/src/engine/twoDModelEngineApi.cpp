@@ -46,7 +46,7 @@ using namespace twoDModel;
 using namespace kitBase::robotModel;
 using namespace twoDModel::model;
 
-TwoDModelEngineApi::TwoDModelEngineApi(model::Model &model, view::TwoDModelWidget &view)
+TwoDModelEngineApi::TwoDModelEngineApi(model::Model &model, view::TwoDModelWidget *view)
 	: mModel(model)
 	, mView(view)
 	, mFakeScene(new view::FakeScene(mModel.worldModel()))
@@ -61,6 +61,12 @@ TwoDModelEngineApi::~TwoDModelEngineApi()
 {
 }
 
+void TwoDModelEngineApi::setView(view::TwoDModelWidget *view)
+{
+	mView = view;
+	mGuiFacade->setTwoDModelWidget(view);
+}
+
 void TwoDModelEngineApi::setNewMotor(int speed, uint degrees, const PortInfo &port, bool breakMode)
 {
 	auto target = mModel.robotModels()[0];
@@ -175,24 +181,28 @@ QColor TwoDModelEngineApi::readColorSensor(const PortInfo &port) const
 	const QImage image = areaUnderSensor(port, 0.3);
 	if (image.isNull()) return QColor();
 
-	qreal averageB = 0, averageG = 0, averageR = 0;
-	auto arr = image.constBits();
-	auto nPix = image.byteCount() / 4;
+	return averageColor(image, mModel.settings().realisticSensors()
+			? mathUtils::Math::gaussianNoise(spoilColorDispersion)
+			: 0);
+}
+
+QColor TwoDModelEngineApi::averageColor(const QImage &image, qreal noise)
+{
+	// Sums are accumulated in separate integer channels in a branchless loop that compilers vectorize well.
+	quint64 sumB = 0;
+	quint64 sumG = 0;
+	quint64 sumR = 0;
+	const uint *pixels = reinterpret_cast<const uint *>(image.constBits());
+	const int nPix = image.width() * image.height();
 	for (int i = 0; i < nPix; i++) {
-		averageB += arr[4 * i];
-		averageG += arr[4 * i + 1];
-		averageR += arr[4 * i + 2];
+		sumB += pixels[i] & 0xFF;
+		sumG += (pixels[i] >> 8) & 0xFF;
+		sumR += (pixels[i] >> 16) & 0xFF;
 	}
-	averageR /= nPix;
-	averageG /= nPix;
-	averageB /= nPix;
 
-	if (mModel.settings().realisticSensors()) {
-		const qreal noise = mathUtils::Math::gaussianNoise(spoilColorDispersion);
-		averageR += noise;
-		averageG += noise;
-		averageB += noise;
-	}
+	const qreal averageR = static_cast<qreal>(sumR) / nPix + noise;
+	const qreal averageG = static_cast<qreal>(sumG) / nPix + noise;
+	const qreal averageB = static_cast<qreal>(sumB) / nPix + noise;
 
 	auto r = mathUtils::Math::truncateToInterval(0, 255, qRound(averageR));
 	auto g = mathUtils::Math::truncateToInterval(0, 255, qRound(averageG));
@@ -233,24 +243,15 @@ QImage TwoDModelEngineApi::areaUnderSensor(const PortInfo &port, qreal widthFact
 	const QRect imageRect = mModel.robotModels()[0]->info().sensorImageRect(device);
 	const qreal width = imageRect.width() * widthFactor / 2.0;
 
-	const QRectF sensorRectangle = QTransform().rotate(direction).map(QPolygonF(QRectF(imageRect))).boundingRect();
-	const qreal rotationFactor = sensorRectangle.width() / imageRect.width();
-
-	const qreal realWidth = width * rotationFactor;
-	const QRectF scanningRect = QRectF(position.x() - realWidth, position.y() - realWidth
-			, 2 * realWidth, 2 * realWidth);
-	const QImage image(mFakeScene->render(scanningRect));
-	const QPoint offset = QPointF(width, width).toPoint() - QPoint(1, 1);
-	const QImage rotated(image.transformed(QTransform().rotate(-(90 + direction))));
-	const QRect realImage(rotated.rect().center() - offset, rotated.rect().center() + offset);
-	QImage result(realImage.size(), QImage::Format_RGB32);
-	result.fill(Qt::white);
-	QPainter painter(&result);
-	painter.drawImage(QRect(QPoint(), result.size()), rotated, realImage);
-	painter.end();
+	// The floor is sampled right from the cached raster of the fake scene, rotated so that the sensor direction
+	// looks upwards on the result.
+	const int size = qMax(1, 2 * qRound(width) - 1);
+	const QImage result = mFakeScene->sample(position, 90 + direction, size);
 
 #ifdef BACKGROUND_SCENE_DEBUGGING
-	mView.scene()->addItem(new QGraphicsPixmapItem(QPixmap::fromImage(result)));
+	if (mView) {
+		mView->scene()->addItem(new QGraphicsPixmapItem(QPixmap::fromImage(result)));
+	}
 #endif
 
 	return result;
@@ -266,21 +267,39 @@ int TwoDModelEngineApi::readLightSensor(const PortInfo &port) const
 		return 0;
 	}
 
-	uint sum = 0;
-	const uint *data = reinterpret_cast<const uint *>(image.bits());
-	const int n = image.byteCount() / 4;
+	if (!mModel.settings().realisticSensors()) {
+		return lightReading(image);
+	}
 
+	QImage spoiled = image;
+	uint * const pixels = reinterpret_cast<uint *>(spoiled.bits());
+	const int n = spoiled.width() * spoiled.height();
 	for (int i = 0; i < n; ++i) {
-		const uint color = mModel.settings().realisticSensors() ? spoilLight(data[i]) : data[i];
+		pixels[i] = spoilLight(pixels[i]);
+	}
+
+	return lightReading(spoiled);
+}
+
+int TwoDModelEngineApi::lightReading(const QImage &image)
+{
+	const uint *data = reinterpret_cast<const uint *>(image.constBits());
+	const int n = image.width() * image.height();
+	const auto brightness = [](const uint color) {
 		const uint b = (color >> 0) & 0xFF;
 		const uint g = (color >> 8) & 0xFF;
 		const uint r = (color >> 16) & 0xFF;
 		// brightness in [0..256]
-		const uint brightness = static_cast<uint>(0.2126 * r + 0.7152 * g + 0.0722 * b);
+		return static_cast<uint>(0.2126 * r + 0.7152 * g + 0.0722 * b);
+	};
 
-		sum += 4 * brightness; // 4 = max sensor value / max brightness value
+	// Kept free of branches and calls, so compilers vectorize it.
+	uint sum = 0;
+	for (int i = 0; i < n; ++i) {
+		sum += brightness(data[i]);
 	}
 
+	sum *= 4; // 4 = max sensor value / max brightness value
 	const qreal rawValue = sum * 1.0 / n; // Average by whole region
 	return static_cast<int>(rawValue * 100.0 / maxLightSensorValue); // Normalizing to percents
 }
@@ -312,7 +331,12 @@ utils::TimelineInterface &TwoDModelEngineApi::modelTimeline()
 
 engine::TwoDModelDisplayInterface *TwoDModelEngineApi::display()
 {
-	return mView.display();
+	if (mView) {
+		return mView->display();
+	}
+
+	// Without 2D model window the display emulator is not embedded anywhere, but still can be painted on.
+	return mModel.robotModels().isEmpty() ? nullptr : mModel.robotModels()[0]->info().displayWidget();
 }
 
 engine::TwoDModelGuiFacade &TwoDModelEngineApi::guiFacade() const
@@ -320,6 +344,11 @@ engine::TwoDModelGuiFacade &TwoDModelEngineApi::guiFacade() const
 	return *mGuiFacade;
 }
 
+Model &TwoDModelEngineApi::model() const
+{
+	return mModel;
+}
+
 uint TwoDModelEngineApi::spoilLight(const uint color) const
 {
 	const qreal noise = mathUtils::Math::gaussianNoise(spoilLightDispersion);
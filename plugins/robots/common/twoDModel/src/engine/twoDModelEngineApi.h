@@ -32,9 +32,13 @@ class TwoDModelEngineApi : public engine::TwoDModelEngineInterface
 {
 
 public:
-	TwoDModelEngineApi(model::Model &model, view::TwoDModelWidget &view);
+	/// @param view 2D model window, nullptr if 2D model works in headless mode.
+	TwoDModelEngineApi(model::Model &model, view::TwoDModelWidget *view);
 	~TwoDModelEngineApi() override;
 
+	/// Sets 2D model window that displays the model, may be nullptr in headless mode.
+	void setView(view::TwoDModelWidget *view);
+
 	void setNewMotor(int speed, uint degrees
 			, const kitBase::robotModel::PortInfo &port, bool breakMode) override;
 
@@ -64,8 +68,17 @@ public:
 	utils::TimelineInterface &modelTimeline() override;
 	engine::TwoDModelDisplayInterface *display() override;
 	engine::TwoDModelGuiFacade &guiFacade() const override;
+	model::Model &model() const override;
 
 	kitBase::robotModel::PortInfo videoPort() const override;
+
+	/// Returns the average colour of @a image pixels like colour sensor sees it. @a noise is added to each
+	/// averaged component before rounding.
+	static QColor averageColor(const QImage &image, qreal noise = 0);
+
+	/// Returns light sensor reading in percents for the floor under the sensor in @a image.
+	static int lightReading(const QImage &image);
+
 private:
 	QPair<QPointF, qreal> countPositionAndDirection(const kitBase::robotModel::PortInfo &port) const;
 
@@ -76,7 +89,7 @@ private:
 	void enableBackgroundSceneDebugging();
 
 	model::Model &mModel;
-	view::TwoDModelWidget &mView;
+	view::TwoDModelWidget *mView;  // Does not have ownership.
 	QScopedPointer<view::FakeScene> mFakeScene;
 	QScopedPointer<engine::TwoDModelGuiFacade> mGuiFacade;
 };
@@ -29,15 +29,9 @@ using namespace twoDModel::engine;
 TwoDModelEngineFacade::TwoDModelEngineFacade(twoDModel::robotModel::TwoDRobotModel &robotModel)
 	: mRobotModelName(robotModel.name())
 	, mModel(new model::Model())
-	, mView(new view::TwoDModelWidget(*mModel, nullptr))
-	, mApi(new TwoDModelEngineApi(*mModel, *mView))
-	, mDock(new utils::SmartDock("2dModelDock", mView))
+	, mApi(new TwoDModelEngineApi(*mModel, nullptr))
 {
 	mModel->addRobotModel(robotModel);
-	connect(mView, &view::TwoDModelWidget::runButtonPressed, this, &TwoDModelEngineFacade::runButtonPressed);
-	connect(mView, &view::TwoDModelWidget::stopButtonPressed, this, &TwoDModelEngineFacade::stopButtonPressed);
-	connect(mView, &view::TwoDModelWidget::widgetClosed, this, &TwoDModelEngineFacade::stopButtonPressed);
-	connect(mDock, &utils::SmartDock::dockedChanged, mView, &view::TwoDModelWidget::setCompactMode);
 }
 
 TwoDModelEngineFacade::~TwoDModelEngineFacade(){
@@ -51,14 +45,27 @@ void TwoDModelEngineFacade::init(const kitBase::EventsForKitPluginInterface &eve
 								 qReal::gui::MainWindowInterpretersInterface &interpretersInterface,
 								 qReal::gui::MainWindowDockInterface &dockInterface,
 								 const qReal::ProjectManagementInterface &projectManager,
-								 kitBase::InterpreterControlInterface &interpreterControl)
+								 kitBase::InterpreterControlInterface &interpreterControl,
+								 bool headless)
 {
 	mModel->init(*interpretersInterface.errorReporter(), interpreterControl, logicalModel);
-	dockInterface.registerEditor(*mView);
-	mView->setController(controller);
+	if (!headless) {
+		mView = new view::TwoDModelWidget(*mModel, nullptr);
+		mApi->setView(mView);
+		mDock = new utils::SmartDock("2dModelDock", mView);
+		connect(mView, &view::TwoDModelWidget::runButtonPressed, this, &TwoDModelEngineFacade::runButtonPressed);
+		connect(mView, &view::TwoDModelWidget::stopButtonPressed, this, &TwoDModelEngineFacade::stopButtonPressed);
+		connect(mView, &view::TwoDModelWidget::widgetClosed, this, &TwoDModelEngineFacade::stopButtonPressed);
+		connect(mDock, &utils::SmartDock::dockedChanged, mView, &view::TwoDModelWidget::setCompactMode);
+		dockInterface.registerEditor(*mView);
+		mView->setController(controller);
+	}
 
 	const auto onActiveTabChanged = [this](const qReal::TabInfo &info) {
-		mView->setEnabled(info.type() != qReal::TabInfo::TabType::other);
+		if (mView) {
+			mView->setEnabled(info.type() != qReal::TabInfo::TabType::other);
+		}
+
 		mCurrentTabInfo = info.type();
 	};
 
@@ -88,8 +95,12 @@ void TwoDModelEngineFacade::init(const kitBase::EventsForKitPluginInterface &eve
 			worldModel.firstChild().appendChild(blobs.firstChild().firstChild());
 		}
 
-		mView->loadXmls(worldModel);
-		mView->resetDrawAction();
+		if (mView) {
+			mView->loadXmls(worldModel);
+			mView->resetDrawAction();
+		} else {
+			mModel->deserialize(worldModel);
+		}
 
 		loadReadOnlyFlags(logicalModel);
 		QLOG_DEBUG() << "Reloading 2D world done";
@@ -164,18 +175,28 @@ void TwoDModelEngineFacade::init(const kitBase::EventsForKitPluginInterface &eve
 				const bool isCurrentModel = modelName == mRobotModelName;
 				if (isCurrentModel) {
 					connectTwoDModel();
-					mDock->attachToMainWindow(Qt::TopDockWidgetArea);
+					if (mDock) {
+						mDock->attachToMainWindow(Qt::TopDockWidgetArea);
+					}
+
 					reloadWorld();
 				} else {
 					disconnectTwoDModel();
-					mDock->detachFromMainWindow();
+					if (mDock) {
+						mDock->detachFromMainWindow();
+					}
 				}
 			});
 }
 
 kitBase::DevicesConfigurationProvider &TwoDModelEngineFacade::devicesConfigurationProvider()
 {
-	return *mView;
+	if (mView) {
+		return *mView;
+	}
+
+	// Without a window robot`s sensors configuration is synchronized with interpreter directly.
+	return mModel->robotModels()[0]->configuration();
 }
 
 TwoDModelEngineInterface &TwoDModelEngineFacade::engine()
@@ -213,5 +234,7 @@ void TwoDModelEngineFacade::loadReadOnlyFlags(const qReal::LogicalModelAssistInt
 	load("twoDModelRobotConfigurationReadOnly", kitBase::ReadOnly::RobotSetup);
 	load("twoDModelSimulationSettingsReadOnly", kitBase::ReadOnly::SimulationSettings);
 
-	mView->setInteractivityFlags(readOnlyFlags);
+	if (mView) {
+		mView->setInteractivityFlags(readOnlyFlags);
+	}
 }
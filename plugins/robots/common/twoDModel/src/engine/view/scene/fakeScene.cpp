@@ -14,6 +14,8 @@
 
 #include "fakeScene.h"
 
+#include <QtCore/QtMath>
+
 #include "twoDModel/engine/model/worldModel.h"
 #include "src/engine/items/wallItem.h"
 #include "src/engine/items/colorFieldItem.h"
@@ -37,14 +39,26 @@ FakeScene::FakeScene(const WorldModel &world)
 			addClone(item, item->clone());
 		}
 	});
-	connect(&world, &WorldModel::traceItemAddedOrChanged
-			, this, [this](const QSharedPointer<QGraphicsPathItem> &item, bool justChanged) {
-		// if traceItem was changed need delete old clone before adding new clone
-		if (justChanged) {
-			deleteItem(item);
-		}
+	connect(&world, &WorldModel::traceItemAdded, this, [this](const QSharedPointer<QGraphicsPathItem> &item) {
 		addClone(item, new QGraphicsPathItem(item->path()));
 	});
+	connect(&world, &WorldModel::traceSegmentAppended, this
+			, [this](const QSharedPointer<QGraphicsPathItem> &item, const QPointF &begin, const QPointF &end) {
+		QGraphicsPathItem * const clone = static_cast<QGraphicsPathItem *>(mClonedItems.value(item));
+		if (!clone) {
+			addClone(item, new QGraphicsPathItem(item->path()));
+			return;
+		}
+
+		// Trace is only appended with new segments, so only the last one must be redrawn on the raster.
+		const qreal margin = item->pen().widthF() + 2;
+		invalidateTiles(QRectF(begin, end).normalized().adjusted(-margin, -margin, margin, margin));
+
+		QPainterPath path = clone->path();
+		path.moveTo(begin);
+		path.lineTo(end);
+		clone->setPath(path);
+	});
 	connect(&world, &WorldModel::itemRemoved, this, &FakeScene::deleteItem);
 }
 
@@ -52,6 +66,7 @@ void FakeScene::addClone(const QWeakPointer<QGraphicsItem> &original, QGraphicsI
 {
 	mClonedItems[original] = cloned;
 	addItem(cloned);
+	invalidateTiles(cloned->sceneBoundingRect());
 
 	// Interesting things happen here. Fake scene behaviours really strangely without this hack.
 	// Lines, ellipses and stylus is drawn correctly, but PARTIALLY until it moves the first time
@@ -67,12 +82,26 @@ void FakeScene::addClone(const QWeakPointer<QGraphicsItem> &original, QGraphicsI
 		connect(&*orit, &graphicsUtils::AbstractItem::y1Changed, this, hack);
 		connect(&*orit, &graphicsUtils::AbstractItem::x2Changed, this, hack);
 		connect(&*orit, &graphicsUtils::AbstractItem::y2Changed, this, hack);
+
+		// Items are edited rarely, so the whole raster is simply redrawn then.
+		const auto invalidate = [this]() { mTiles.clear(); };
+		connect(&*orit, &graphicsUtils::AbstractItem::positionChanged, this, invalidate);
+		connect(&*orit, &graphicsUtils::AbstractItem::x1Changed, this, invalidate);
+		connect(&*orit, &graphicsUtils::AbstractItem::y1Changed, this, invalidate);
+		connect(&*orit, &graphicsUtils::AbstractItem::x2Changed, this, invalidate);
+		connect(&*orit, &graphicsUtils::AbstractItem::y2Changed, this, invalidate);
+		connect(&*orit, &graphicsUtils::AbstractItem::penChanged, this, invalidate);
+		connect(&*orit, &graphicsUtils::AbstractItem::brushChanged, this, invalidate);
+		if (auto &&image = qSharedPointerDynamicCast<items::ImageItem>(orit)) {
+			connect(&*image, &items::ImageItem::internalImageChanged, this, invalidate);
+		}
 	}
 }
 
 void FakeScene::deleteItem(const QSharedPointer<QGraphicsItem> &original)
 {
 	if (mClonedItems.contains(original)) {
+		invalidateTiles(mClonedItems[original]->sceneBoundingRect());
 		removeItem(mClonedItems[original]);
 		delete mClonedItems[original];
 		mClonedItems.remove(original);
@@ -87,3 +116,73 @@ QImage view::FakeScene::render(const QRectF &piece)
 	QGraphicsScene::render(&painter, QRectF(), piece);
 	return result;
 }
+
+QImage FakeScene::sample(const QPointF &center, qreal rotation, int size)
+{
+	QImage result(size, size, QImage::Format_RGB32);
+	const qreal angle = qDegreesToRadians(rotation);
+	const qreal cos = qCos(angle);
+	const qreal sin = qSin(angle);
+	const qreal half = (size - 1) / 2.0;
+
+	// The last used tile is remembered since neighbour pixels almost always fall into the same tile.
+	quint64 lastTileKey = 0;
+	const QImage *lastTile = nullptr;
+	for (int j = 0; j < size; ++j) {
+		QRgb * const line = reinterpret_cast<QRgb *>(result.scanLine(j));
+		for (int i = 0; i < size; ++i) {
+			const qreal u = i - half;
+			const qreal v = j - half;
+			const int x = qFloor(center.x() + u * cos - v * sin);
+			const int y = qFloor(center.y() + u * sin + v * cos);
+			const int tileX = qFloor(static_cast<qreal>(x) / tileSize);
+			const int tileY = qFloor(static_cast<qreal>(y) / tileSize);
+			const quint64 tileKey = (static_cast<quint64>(static_cast<quint32>(tileX)) << 32)
+					| static_cast<quint32>(tileY);
+			if (!lastTile || tileKey != lastTileKey) {
+				lastTile = &tile(tileX, tileY);
+				lastTileKey = tileKey;
+			}
+
+			const QRgb * const tileLine = reinterpret_cast<const QRgb *>(lastTile->constScanLine(y - tileY * tileSize));
+			line[i] = tileLine[x - tileX * tileSize];
+		}
+	}
+
+	return result;
+}
+
+void FakeScene::invalidateTiles(const QRectF &rect)
+{
+	const int left = qFloor(rect.left() / tileSize);
+	const int right = qFloor(rect.right() / tileSize);
+	const int top = qFloor(rect.top() / tileSize);
+	const int bottom = qFloor(rect.bottom() / tileSize);
+	if (static_cast<qint64>(right - left + 1) * (bottom - top + 1) > mTiles.size()) {
+		mTiles.clear();
+		return;
+	}
+
+	for (int x = left; x <= right; ++x) {
+		for (int y = top; y <= bottom; ++y) {
+			mTiles.remove((static_cast<quint64>(static_cast<quint32>(x)) << 32) | static_cast<quint32>(y));
+		}
+	}
+}
+
+const QImage &FakeScene::tile(int x, int y)
+{
+	const quint64 key = (static_cast<quint64>(static_cast<quint32>(x)) << 32) | static_cast<quint32>(y);
+	auto tile = mTiles.find(key);
+	if (tile == mTiles.end()) {
+		QImage image(tileSize, tileSize, QImage::Format_RGB32);
+		image.fill(Qt::white);
+		QPainter painter(&image);
+		QGraphicsScene::render(&painter, QRectF(0, 0, tileSize, tileSize)
+				, QRectF(x * tileSize, y * tileSize, tileSize, tileSize));
+		painter.end();
+		tile = mTiles.insert(key, image);
+	}
+
+	return tile.value();
+}
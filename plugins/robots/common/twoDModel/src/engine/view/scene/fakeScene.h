@@ -14,7 +14,9 @@
 
 #pragma once
 
+#include <QtCore/QHash>
 #include <QtCore/QMap>
+#include <QtGui/QImage>
 #include <QtWidgets/QGraphicsScene>
 
 #include "twoDModel/engine/model/image.h"
@@ -35,14 +37,30 @@ class FakeScene : public QGraphicsScene
 public:
 	explicit FakeScene(const model::WorldModel &world);
 
+	/// Size of the side of square tiles in which the scene is rasterized, in pixels.
+	static const int tileSize = 256;
+
 	/// Renders a given piece of the scene and returns resulting image.
 	QImage render(const QRectF &piece);
 
+	/// Returns a square piece of the scene with a side of @a size pixels centered in @a center and rotated
+	/// around it by @a rotation degrees, so the scene itself appears rotated by -@a rotation on the result.
+	/// Pixels are taken from the raster of the scene that is cached in tiles and redrawn only where the
+	/// scene has changed, so this is much cheaper than render() for frequent small reads.
+	QImage sample(const QPointF &center, qreal rotation, int size);
+
 private:
 	void addClone(const QWeakPointer<QGraphicsItem> &original, QGraphicsItem * const cloned);
 	void deleteItem(const QSharedPointer<QGraphicsItem> &original);
 
+	/// Drops cached tiles intersecting the given rect.
+	void invalidateTiles(const QRectF &rect);
+
+	/// Returns the cached tile with the given coordinates rendering it if needed.
+	const QImage &tile(int x, int y);
+
 	QMap<QSharedPointer<QGraphicsItem>, QGraphicsItem *> mClonedItems; // Owns values
+	QHash<quint64, QImage> mTiles;
 };
 
 }
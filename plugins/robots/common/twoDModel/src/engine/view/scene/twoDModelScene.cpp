@@ -86,10 +86,8 @@ TwoDModelScene::TwoDModelScene(model::Model &model
 	connect(&mModel.worldModel(), &model::WorldModel::imageItemAdded, this, &TwoDModelScene::onAbstractItemAdded);
 	connect(&mModel.worldModel(), &model::WorldModel::regionItemAdded
 			, this, [=](const QSharedPointer<items::RegionItem> &item) { addItem(item.data()); });
-	connect(&mModel.worldModel(), &model::WorldModel::traceItemAddedOrChanged
-			, this, [this](const QSharedPointer<QGraphicsPathItem> &item, bool justChanged) {
-		if (!justChanged) { addItem(item.data()); }
-	});
+	connect(&mModel.worldModel(), &model::WorldModel::traceItemAdded
+			, this, [this](const QSharedPointer<QGraphicsPathItem> &item) { addItem(item.data()); });
 	connect(&mModel.worldModel(), &model::WorldModel::itemRemoved, this, &TwoDModelScene::onItemRemoved);
 
 	connect(&mModel, &model::Model::robotAdded, this, &TwoDModelScene::onRobotAdd);
@@ -37,6 +37,7 @@
 #include "twoDModel/robotModel/parts/lidar.h"
 
 #include "twoDModel/engine/twoDModelEngineInterface.h"
+#include "twoDModel/engine/model/model.h"
 
 const int updateInterval = 20;
 
@@ -87,6 +88,15 @@ int TwoDRobotModel::updateIntervalForInterpretation() const
 	return updateInterval;
 }
 
+void TwoDRobotModel::updateSensorsValuesOnPorts(const QList<PortInfo> &ports) const
+{
+	if (mEngine && mEngine->model().hasConstraints()) {
+		updateSensorsValues();
+	} else {
+		CommonRobotModel::updateSensorsValuesOnPorts(ports);
+	}
+}
+
 utils::TimelineInterface &TwoDRobotModel::timeline()
 {
 	return mEngine->modelTimeline();
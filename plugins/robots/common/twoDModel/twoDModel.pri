@@ -92,6 +92,8 @@ HEADERS += \
 	$$PWD/src/engine/constraints/details/triggersFactory.h \
 	$$PWD/src/engine/constraints/details/valuesFactory.h \
 	$$PWD/src/engine/model/modelTimer.h \
+	$$PWD/src/engine/model/rayCaster.h \
+	$$PWD/src/engine/model/solidItemsIndex.h \
 	$$PWD/src/engine/model/physics/physicsEngineBase.h \
 	$$PWD/src/engine/model/physics/simplePhysicsEngine.h \
 	$$PWD/src/engine/model/physics/parts/box2DRobot.h \
@@ -156,6 +158,8 @@ SOURCES += \
 	$$PWD/src/engine/model/settings.cpp \
 	$$PWD/src/engine/model/robotModel.cpp \
 	$$PWD/src/engine/model/modelTimer.cpp \
+	$$PWD/src/engine/model/rayCaster.cpp \
+	$$PWD/src/engine/model/solidItemsIndex.cpp \
 	$$PWD/src/engine/model/sensorsConfiguration.cpp \
 	$$PWD/src/engine/model/worldModel.cpp \
 	$$PWD/src/engine/model/timeline.cpp \
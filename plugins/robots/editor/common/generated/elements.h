@@ -26,6 +26,10 @@
 			setFriendlyName(QObject::tr("AbstractNode"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr(""));
+		}
+
+		void initialize() override
+		{
 			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/AbstractNodeClass.sdf").documentElement());
 			setSize(QSizeF(50, 50));
 			initProperties();
@@ -61,6 +65,10 @@
 			setFriendlyName(QObject::tr("Clear Screen"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Clears everything drawn on the robot`s screen."));
+		}
+
+		void initialize() override
+		{
 			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/ClearScreenClass.sdf").documentElement());
 			setSize(QSizeF(50, 50));
 			initProperties();
@@ -97,6 +105,10 @@
 			setFriendlyName(QObject::tr("Comment"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("This block can hold text notes that are ignored by generators and interpreters. Use it for improving the diagram readability."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.1, 0.2, "Comment", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -145,6 +157,10 @@
 			setFriendlyName(QObject::tr("Link"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("For creating a link between two elements A and B you can just hover a mouse above A, press the right mouse button and (without releasing it) draw a line to the element B. Alternatively you can just 'pull' a link from a small blue circle next to the element."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0, 0, "Guard", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -158,36 +174,14 @@
 			setPenWidth(1);
 			setPenColor(QColor(0,0,0));
 			setPenStyle(Qt::SolidLine);
+			setStartArrowStyle("no_arrow");
+			setEndArrowStyle("open_arrow");
 			setDividable(true)
 ;			initProperties();
 		}
 
 		virtual ~ControlFlow() {}
 
-		void drawStartArrow(QPainter * painter) const override
-		{
-			QBrush old = painter->brush();
-			QBrush brush;
-			brush.setStyle(Qt::SolidPattern);
-			painter->setBrush(brush);
-			painter->setBrush(old);
-		}
-
-		void drawEndArrow(QPainter * painter) const override
-		{
-			QBrush old = painter->brush();
-			QBrush brush;
-			brush.setStyle(Qt::SolidPattern);
-			painter->setBrush(brush);
-			static const QPointF points[] = {
-				QPointF(-5,10),
-				QPointF(0,0),
-				QPointF(5,10)
-			};
-			painter->drawPolyline(points, 3);
-			painter->setBrush(old);
-		}
-
 	private:
 		void initProperties()
 		{
@@ -205,6 +199,10 @@
 			setFriendlyName(QObject::tr("EngineCommand"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr(""));
+		}
+
+		void initialize() override
+		{
 			setSize(QSizeF(-1, -1));
 			initProperties();
 			setMouseGesture("");
@@ -239,6 +237,10 @@
 			setFriendlyName(QObject::tr("EngineMovementCommand"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr(""));
+		}
+
+		void initialize() override
+		{
 			setSize(QSizeF(-1, -1));
 			initProperties();
 			setMouseGesture("");
@@ -274,6 +276,10 @@
 			setFriendlyName(QObject::tr("End if"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Unites control flow from different condition branches."));
+		}
+
+		void initialize() override
+		{
 			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/FiBlockClass.sdf").documentElement());
 			setSize(QSizeF(50, 50));
 			initProperties();
@@ -309,6 +315,10 @@
 			setFriendlyName(QObject::tr("Final Node"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("The final node of the program. If the program consists of some parallel execution lines the reachment of this block terminates the corresponding execution line. This block can`t have outgoing links."));
+		}
+
+		void initialize() override
+		{
 			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/FinalNodeClass.sdf").documentElement());
 			setSize(QSizeF(50, 50));
 			initProperties();
@@ -344,6 +354,10 @@
 			setFriendlyName(QObject::tr("Fork"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Separates program execution into a number of threads that will be executed concurrently from the programmers`s point of view. For example in such way signal from sensor and some time interval can be waited synchroniously. This block must have at least two outgoing links. 'Guard' property of every link must contain unique thread identifiers, and one of those identifiers must be the same as the identifier of a thread where fork is placed (it must be 'main' if it is the first fork in a program."));
+		}
+
+		void initialize() override
+		{
 			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/ForkClass.sdf").documentElement());
 			setSize(QSizeF(50, 50));
 			initProperties();
@@ -379,6 +393,10 @@
 			setFriendlyName(QObject::tr("Expression"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Evaluates a value of the given expression. Also new variables can be defined in this block. See the 'Expressions Syntax' chapter in help for more information about 'Function' block syntax."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.6, 1.2, "Body", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -424,6 +442,10 @@
 			setFriendlyName(QObject::tr("Get Button Code"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Assigns a given variable a value of pressed button. If no button is pressed at the moment and 'Wait' property is false when variable is set to -1."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.6, 1.2, "Variable", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -477,6 +499,10 @@
 			setFriendlyName(QObject::tr("Condition"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Separates program execution in correspondece with the given condition. The 'Condition' parameter value must be some boolean expression that will determine subsequent program execution line. This block must have two outgoing links, at least one of them must have 'Guard' parameter set to 'true' or 'false'. The execution will be proceed trough the link marked with the guard corresponding to 'Condition' parameter of the block."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, 1.2, "Condition", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -522,6 +548,10 @@
 			setFriendlyName(QObject::tr("Initial Node"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("The entry point of the program execution. Each diagram should have only one such block, it must not have incomming links and it must have only one outgoing link. The interpretation process starts from exactly this block."));
+		}
+
+		void initialize() override
+		{
 			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/InitialNodeClass.sdf").documentElement());
 			setSize(QSizeF(50, 50));
 			initProperties();
@@ -565,6 +595,10 @@
 			setFriendlyName(QObject::tr("User Input"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Reads a value into variable from an input dialog."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.66, 1.2, "variable", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -627,6 +661,10 @@
 			setFriendlyName(QObject::tr("Join"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Joins a number of threads into one. 'Guard' property of the single outgoing link must contain an identifier of one of threads being joined. The specified thread would wait until the rest of them finish execution, and then proceed in a normal way."));
+		}
+
+		void initialize() override
+		{
 			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/JoinClass.sdf").documentElement());
 			setSize(QSizeF(50, 50));
 			initProperties();
@@ -662,6 +700,10 @@
 			setFriendlyName(QObject::tr("Kill Thread"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Terminates execution of a specified thread."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.6, 1.2, "Thread", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -706,6 +748,10 @@
 			setFriendlyName(QObject::tr("Loop"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("This block executes a sequence of blocks for a given number of times. The number of repetitions is specified by the 'Iterations' parameter. This block must have two outgoing links. One of them must be marked with the 'body' guard (that means that the property 'Guard' of the link must be set to 'body' value). Another outgoing link must be unmarked: the program execution will be proceeded through this link when it will go through our 'Loop' block for the given number of times."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Iterations", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -752,6 +798,10 @@
 			setFriendlyName(QObject::tr("Marker Down"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Moves the marker of the 2D model robot down to the floor: the robot will draw its trace on the floor after that. If the marker of another color is already drawing at the moment it will be replaced."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.54, -0.7, "Color", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -796,6 +846,10 @@
 			setFriendlyName(QObject::tr("Marker Up"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Lifts the marker of the 2D model robot up: the robot stops drawing its trace on the floor after that."));
+		}
+
+		void initialize() override
+		{
 			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/MarkerUpClass.sdf").documentElement());
 			setSize(QSizeF(50, 50));
 			initProperties();
@@ -831,6 +885,10 @@
 			setFriendlyName(QObject::tr("Pre-conditional Loop"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("This block executes a sequence of blocks while condition in 'Condition' is true. This block must have two outgoing links. One of them must be marked with the 'body' guard (that means that the property 'Guard' of the link must be set to 'body' value). Another outgoing link must be unmarked: the program execution will be proceeded through this link when condition becomes false."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Condition", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -875,6 +933,10 @@
 			setFriendlyName(QObject::tr("Print Text"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Prints a given line in the specified coordinates on the robot`s screen. The value of 'Text' property is interpreted as a plain text unless 'Evaluate' property is set to true, then it will be interpreted as an expression (that may be useful for example when debugging variables values)."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 1, 1.2, "XCoordinateText", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -939,6 +1001,10 @@
 			setFriendlyName(QObject::tr("Random Initialization"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Sets a variable value to a random value inside given interval."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.6, 1.2, "Variable", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1001,6 +1067,10 @@
 			setFriendlyName(QObject::tr("Receive Message From Thread"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Receive a message sent to a thread from which this block is called."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.6, 1.2, "Variable", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1069,6 +1139,10 @@
 			setFriendlyName(QObject::tr("Robot`s Behaviour Diagram"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr(""));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.205882, 0.0588235, "name", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1112,6 +1186,10 @@
 			setFriendlyName(QObject::tr("Send Message To Thread"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Sends a message to a specified thread."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.6, 1.2, "Thread", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1165,6 +1243,10 @@
 			setFriendlyName(QObject::tr("Subprogram"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Subprogram call. Subprograms are used for splitting repetitive program parts into a separate diagram and then calling it from main diagram or other subprograms. When this block is added into a diagram it will be suggested to enter subprogram name. The double click on subprogram call block may open the corresponding subprogram diagram. Moreover user palette will appear containing existing subrpograms, they can be dragged into a diagram like the usual blocks."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, -0.4, -0.7, "name", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1207,6 +1289,10 @@
 			setFriendlyName(QObject::tr("Subprogram Diagram"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr(""));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.205882, 0.0588235, "name", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1264,6 +1350,10 @@
 			setFriendlyName(QObject::tr("Switch"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Selects the program execution branch in correspondence with some expression value. The value of the expression written in 'Expression' property is compared to the values on the outgoing links. If equal value is found then execution will be proceeded by that branch. Else branch without a marker will be selected."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 1, 1.2, "Expression", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1308,6 +1398,10 @@
 			setFriendlyName(QObject::tr("Timer"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits for a given time in milliseconds."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.6, -0.7, "Delay", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1362,6 +1456,10 @@
 			setFriendlyName(QObject::tr("Variable Initialization"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Assigns a given value to a given variable."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.66, 1.2, "variable", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -26,6 +26,10 @@
 			setFriendlyName(QObject::tr("Beep"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Plays on the robot a sound with the fixed frequency. There are two parameters. The first one is a loudness of the sound, the second means if program should wait for sound completion or go to next block right away."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 1.2, -0.7, "Volume", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -88,6 +92,10 @@
 			setFriendlyName(QObject::tr("Calibrate Black"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Calibrates the black threshold for each sensor in the array. Place the array over the black surface with all sensors on the black area."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -132,6 +140,10 @@
 			setFriendlyName(QObject::tr("Calibrate gyroscope"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Sets gyroscope's angle to zero in current position."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -176,6 +188,10 @@
 			setFriendlyName(QObject::tr("Calibrate PID"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Sets set point, P, I, D value of PID control and P factor, I factor, D factor for P, I, D value of PID control."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -283,6 +299,10 @@
 			setFriendlyName(QObject::tr("Calibrate White"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Calibrates the white threshold for each sensor in the array. Place the array over the white surface with all sensors on the white area."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -327,6 +347,10 @@
 			setFriendlyName(QObject::tr("Clear Encoder"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Nullifies tacho limit of the motors on the given ports."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Ports", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -372,6 +396,10 @@
 			setFriendlyName(QObject::tr("Draw Circle"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Draws on the robot screen a circle with the given center and radius."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 1, 1.2, "XCoordinateCircle", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -444,6 +472,10 @@
 			setFriendlyName(QObject::tr("Draw Line"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Draws a segment on the robot screen. The parameters specify the ends of the segment."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.72, 1.2, "X1CoordinateLine", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -516,6 +548,10 @@
 			setFriendlyName(QObject::tr("Draw Pixel"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Draws one pixel in the specified coordinates on the robot screen."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.72, 1.2, "XCoordinatePix", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -570,6 +606,10 @@
 			setFriendlyName(QObject::tr("Draw Rectangle"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Draws a rectangle on the robot screen. The parameters specify the coordinates of top-left corner, the width and the height of the rectangle."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 1, 1.2, "XCoordinateRect", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -651,6 +691,10 @@
 			setFriendlyName(QObject::tr("Ev3EngineMovementCommand"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr(""));
+		}
+
+		void initialize() override
+		{
 			setSize(QSizeF(-1, -1));
 			initProperties();
 			setMouseGesture("");
@@ -687,6 +731,10 @@
 			setFriendlyName(QObject::tr("Motors Backward"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Enables motors on the given ports in reverse mode with the given power. Ports are specified with A, B or C letters divided by commas. The power is specified in percents with the number from -100 to 100, if negative number is specified then the motor is enabled in the usual mode."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.5, -0.7, "Ports", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -741,6 +789,10 @@
 			setFriendlyName(QObject::tr("Motors Forward"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Enables motors on the given ports with the given power. Ports are specified with A, B or C letters divided by commas. The power is specified in percents with the number from -100 to 100, if negative number is specified then the motor is enabled in the reverse mode."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.5, -0.7, "Ports", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -795,6 +847,10 @@
 			setFriendlyName(QObject::tr("Stop Motors"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Disables motors on the given ports."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.5, -0.7, "Ports", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -848,6 +904,10 @@
 			setFriendlyName(QObject::tr("Led"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Sets the color of the LED on the robot`s front panel."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.7, -0.7, "Color", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -893,6 +953,10 @@
 			setFriendlyName(QObject::tr("Play Tone"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Plays on the robot a sound with the given frequency and duration. This block is similar to the 'Beep' block wuth the only difference that here you can specify sound parameters."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 1, -0.7, "Frequency", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -968,6 +1032,10 @@
 			setFriendlyName(QObject::tr("Read Sensor to Array"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Read the values from the Line Leader.  Amount of light or dark each sensor sees.  Typically between 0-20.  0=black, 100=white."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1021,6 +1089,10 @@
 			setFriendlyName(QObject::tr("Read Average to Variable"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Read the Weighted Average value from the sensor.  This value is calculated internally by the sensor where each of the eight sensors is either triggered or not and multiplied by a factor to help determine if the line is left, right or on center of the line (according to the set point). EXPECTED VALUES: 0-80 (-1=ERROR)"));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1074,6 +1146,10 @@
 			setFriendlyName(QObject::tr("Read RGB into Variables"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Reads R, G, B channels values into given variables"));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1145,6 +1221,10 @@
 			setFriendlyName(QObject::tr("Read Steering to Variable"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Read the Steering value from the sensor.  This value is calculated internally and can directly be used to set turning values for the robot's motors. EXPECTED VALUES: -100 to 100 (-101=ERROR)"));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1198,6 +1278,10 @@
 			setFriendlyName(QObject::tr("Send Mail"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Sends mail (message) to another robot. If Receiver name left empty, message will be sent to all connected robots"));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.9, 1.2, "MsgType", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1269,6 +1353,10 @@
 			setFriendlyName(QObject::tr("Ev3SensorBlock"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr(""));
+		}
+
+		void initialize() override
+		{
 			setSize(QSizeF(-1, -1));
 			initProperties();
 			setMouseGesture("");
@@ -1304,6 +1392,10 @@
 			setFriendlyName(QObject::tr("Sleep Line Leader"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Puts the line leader to sleep conserve power"));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1348,6 +1440,10 @@
 			setFriendlyName(QObject::tr("Start Compass Calibration"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Starts compass calibration under program control. To calibrate, robot needs to spin >=540 clockwise and counterclockwise with minimum 20 seconds duration for each direction. Atfer robot rotation add Stop Compass Сalibration block."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1392,6 +1488,10 @@
 			setFriendlyName(QObject::tr("Stop Compass Calibration"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Ends compass calibration process. Stores result of calibration into the given variable. Not zero means success."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1445,6 +1545,10 @@
 			setFriendlyName(QObject::tr("Wait for button"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits for press of a button on a brick."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, 1.2, "Button", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1489,6 +1593,10 @@
 			setFriendlyName(QObject::tr("Wait for Color"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits till the color sensor on the given port will recognize the given color."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.74, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1543,6 +1651,10 @@
 			setFriendlyName(QObject::tr("Wait for Color Intensity"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits till the value returned by the color sensor on the given port will be greater or less than the given in the 'Intensity' parameter value (the intensity is specified in percents, 0 to 100)."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1622,6 +1734,10 @@
 			setFriendlyName(QObject::tr("Wait for Encoder"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits till the tacho limit of the motor on the given port will reach the value of the 'Tacho Limit' parameter."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1685,6 +1801,10 @@
 			setFriendlyName(QObject::tr("Wait for Gyroscope"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits till the value returned by the gyroscope on the given port will be greater or less than the given."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1748,6 +1868,10 @@
 			setFriendlyName(QObject::tr("Wait for Light"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits till the value returned by the light sensor on the given port will be greater or less than the given in the 'Percents' parameter value (0 to 100)."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1819,6 +1943,10 @@
 			setFriendlyName(QObject::tr("Wait for Mail Receiving"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Stores a message from another robot (fom mailbox) into a given variable. When no incoming messages are present at the moment, a robot will wait for incoming message if 'Synchronized' property is true, and doing nothing otherwise."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.9, 1.2, "MsgType", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1890,6 +2018,10 @@
 			setFriendlyName(QObject::tr("Wait for Range Sensor"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits till the value returned by the ultrasonic or infrared range sensor on the given port will be greater or less than the given in the 'Distance' parameter value (the distance is specified in centimeters, 0 to 255)."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1955,6 +2087,10 @@
 			setFriendlyName(QObject::tr("Wait for Sound Sensor"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits till the loudness obtained by the sound sensor on the given port will be greater or less than the given value."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -2018,6 +2154,10 @@
 			setFriendlyName(QObject::tr("Wait for Touch Sensor"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits till the touch sensor is pressed. The only parameter is a sensor`s port number (1, 2, 3 or 4)."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -2063,6 +2203,10 @@
 			setFriendlyName(QObject::tr("Wake Up Line Leader"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Wakes the line leader to prepare for use."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -26,6 +26,10 @@
 			setFriendlyName(QObject::tr("Beep"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Plays on the robot a sound with the fixed frequency. There are two parameters. The first one is a loudness of the sound, the second means if program should wait for sound completion or go to next block right away."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 1.2, -0.7, "Volume", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -88,6 +92,10 @@
 			setFriendlyName(QObject::tr("Clear Encoder"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Nullifies tacho limit of the motors on the given ports."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Ports", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -133,6 +141,10 @@
 			setFriendlyName(QObject::tr("Draw Circle"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Draws on the robot screen a circle with the given center and radius."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 1, 1.2, "XCoordinateCircle", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -196,6 +208,10 @@
 			setFriendlyName(QObject::tr("Draw Line"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Draws a segment on the robot screen. The parameters specify the ends of the segment."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.72, 1.2, "X1CoordinateLine", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -268,6 +284,10 @@
 			setFriendlyName(QObject::tr("Draw Pixel"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Draws one pixel in the specified coordinates on the robot screen."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.72, 1.2, "XCoordinatePix", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -322,6 +342,10 @@
 			setFriendlyName(QObject::tr("Draw Rectangle"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Draws a rectangle on the robot screen. The parameters specify the coordinates of top-left corner, the width and the height of the rectangle."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 1, 1.2, "XCoordinateRect", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -394,6 +418,10 @@
 			setFriendlyName(QObject::tr("NxtEngineMovementCommand"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr(""));
+		}
+
+		void initialize() override
+		{
 			setSize(QSizeF(-1, -1));
 			initProperties();
 			setMouseGesture("");
@@ -431,6 +459,10 @@
 			setFriendlyName(QObject::tr("Motors Backward"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Enables motors on the given ports in reverse mode with the given power. Ports are specified with A, B or C letters divided by commas. The power is specified in percents with the number from -100 to 100, if negative number is specified then the motor is enabled in the usual mode."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.5, -0.7, "Ports", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -487,6 +519,10 @@
 			setFriendlyName(QObject::tr("Motors Forward"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Enables motors on the given ports with the given power. Ports are specified with A, B or C letters divided by commas. The power is specified in percents with the number from -100 to 100, if negative number is specified then the motor is enabled in the reverse mode."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.5, -0.7, "Ports", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -543,6 +579,10 @@
 			setFriendlyName(QObject::tr("Stop Motors"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Disables motors on the given ports."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.5, -0.7, "Ports", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -595,6 +635,10 @@
 			setFriendlyName(QObject::tr("Play Tone"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Plays on the robot a sound with the given frequency and duration. This block is similar to the 'Beep' block wuth the only difference that here you can specify sound parameters."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 1, -0.7, "Frequency", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -670,6 +714,10 @@
 			setFriendlyName(QObject::tr("NxtSensorBlock"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr(""));
+		}
+
+		void initialize() override
+		{
 			setSize(QSizeF(-1, -1));
 			initProperties();
 			setMouseGesture("");
@@ -705,6 +753,10 @@
 			setFriendlyName(QObject::tr("Wait for Button"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits for press of a button on a brick."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, 1.2, "Button", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -749,6 +801,10 @@
 			setFriendlyName(QObject::tr("Wait for Color"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits till the color sensor on the given port will recognize the given color."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.74, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -803,6 +859,10 @@
 			setFriendlyName(QObject::tr("Wait for Color Intensity"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits till the value returned by the color sensor on the given port will be greater or less than the given in the 'Intensity' parameter value (the intensity is specified in percents, 0 to 100)."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -882,6 +942,10 @@
 			setFriendlyName(QObject::tr("Wait for Encoder"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits till the tacho limit of the motor on the given port will reach the value of the 'Tacho Limit' parameter."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -945,6 +1009,10 @@
 			setFriendlyName(QObject::tr("Wait for Light"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits till the value returned by the light sensor on the given port will be greater or less than the given in the 'Percents' parameter value (0 to 100)."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1016,6 +1084,10 @@
 			setFriendlyName(QObject::tr("Wait for Sonar Distance"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits till the value returned by the ultrasonic sensor on the given port will be greater or less than the given in the 'Distance' parameter value (the distance is specified in centimeters, 0 to 255)."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1081,6 +1153,10 @@
 			setFriendlyName(QObject::tr("Wait for Sound Sensor"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits till the loudness obtained by the sound sensor on the given port will be greater or less than the given value."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1144,6 +1220,10 @@
 			setFriendlyName(QObject::tr("Wait for Touch Sensor"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits till the touch sensor is pressed. The only parameter is a sensor`s port number (1, 2, 3 or 4)."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
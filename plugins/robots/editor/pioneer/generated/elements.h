@@ -26,6 +26,10 @@
 			setFriendlyName(QObject::tr("Landing"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Orders quadcopter to land."));
+		}
+
+		void initialize() override
+		{
 			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/GeoLandingClass.sdf").documentElement());
 			setSize(QSizeF(50, 50));
 			initProperties();
@@ -61,6 +65,10 @@
 			setFriendlyName(QObject::tr("Takeoff"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Orders quadcopter to takeoff."));
+		}
+
+		void initialize() override
+		{
 			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/GeoTakeoffClass.sdf").documentElement());
 			setSize(QSizeF(50, 50));
 			initProperties();
@@ -96,6 +104,10 @@
 			setFriendlyName(QObject::tr("Go to point"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Orders quadcopter to fly to given GPS coordinates."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.7, 1.2, "Latitude", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -158,6 +170,10 @@
 			setFriendlyName(QObject::tr("Go to local point"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Orders quadcopter to fly to given coordinates."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.7, 1.2, "X", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -230,6 +246,10 @@
 			setFriendlyName(QObject::tr("GPIO Initialization"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Create GPIO in settings port."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.7, -0.7, "PinName", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -301,6 +321,10 @@
 			setFriendlyName(QObject::tr("Get Accelerometer"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Returns accelerometer."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.7, 1.2, "X", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -363,6 +387,10 @@
 			setFriendlyName(QObject::tr("Get Gyroscope"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Returns gyroscope."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.7, 1.2, "X", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -425,6 +453,10 @@
 			setFriendlyName(QObject::tr("Get LPS Position"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Returns position (local positioning system)."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.7, 1.2, "X", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -487,6 +519,10 @@
 			setFriendlyName(QObject::tr("Get LPS Velocity"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Returns velocity (local position system)."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.7, 1.2, "X", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -549,6 +585,10 @@
 			setFriendlyName(QObject::tr("Get LPS Yaw"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Returns yaw (local position system)."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.7, 1.2, "Yaw", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -593,6 +633,10 @@
 			setFriendlyName(QObject::tr("Get Orientation"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Returns orientation."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.7, 1.2, "Roll", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -655,6 +699,10 @@
 			setFriendlyName(QObject::tr("Led"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Sets the color of the specified LED on a quadcopter."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.7, -0.8, "Number", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -727,6 +775,10 @@
 			setFriendlyName(QObject::tr("Magnet"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Controls magnet on a quadcopter."));
+		}
+
+		void initialize() override
+		{
 			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/PioneerMagnetClass.sdf").documentElement());
 			setSize(QSizeF(50, 50));
 			initProperties();
@@ -763,6 +815,10 @@
 			setFriendlyName(QObject::tr("Print"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Prints given string on a console."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.7, 1.2, "PrintText", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -808,6 +864,10 @@
 			setFriendlyName(QObject::tr("Read GPIO"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Returns GPIO value."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.7, -0.7, "PinName", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -861,6 +921,10 @@
 			setFriendlyName(QObject::tr("Read Range Sensor"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Reads distance from rangefinder."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, 1.2, "Variable", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -907,6 +971,10 @@
 			setFriendlyName(QObject::tr("Set GPIO state"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Set GPIO value in \"true/false\"."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.7, -0.7, "PinName", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -952,6 +1020,10 @@
 			setFriendlyName(QObject::tr("System"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Executes given Lua script."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, 1.2, "Command", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -997,6 +1069,10 @@
 			setFriendlyName(QObject::tr("Yaw"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Sets yaw for quadcopter"));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.7, -0.8, "Angle", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -26,6 +26,10 @@
 			setFriendlyName(QObject::tr("TrikAnalogSensorBlock"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr(""));
+		}
+
+		void initialize() override
+		{
 			setSize(QSizeF(-1, -1));
 			initProperties();
 			setMouseGesture("");
@@ -61,6 +65,10 @@
 			setFriendlyName(QObject::tr("Angular Servo"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Manages angular servomotor. Sets up rotation angle on the given port in degrees. Values from 0 to 90 are correspond to a clockwise rotation and values from -90 to 0 correspond to counterclockwise rotation."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.5, -0.7, "Ports", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -115,6 +123,10 @@
 			setFriendlyName(QObject::tr("Calibrate gyroscope"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Sets gyroscope's angle to zero in current position."));
+		}
+
+		void initialize() override
+		{
 			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikCalibrateGyroscopeClass.sdf").documentElement());
 			setSize(QSizeF(50, 50));
 			initProperties();
@@ -150,6 +162,10 @@
 			setFriendlyName(QObject::tr("Detect by Videocamera"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Initializes videocamera line or object detector with the color of the object in the middle of the camera`s sight."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Mode", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -201,6 +217,10 @@
 			setFriendlyName(QObject::tr("Line Detector into Variable"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Stores videocamera line detector`s value into a given variable."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, -0.3, 1.2, QObject::tr("Line Detector into Variable"), 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -252,6 +272,10 @@
 			setFriendlyName(QObject::tr("TrikDigitalSensorBlock"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr(""));
+		}
+
+		void initialize() override
+		{
 			setSize(QSizeF(-1, -1));
 			initProperties();
 			setMouseGesture("");
@@ -287,6 +311,10 @@
 			setFriendlyName(QObject::tr("Draw Arc"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Draws the arc defined by the rectangle beginning at (x, y) with the specified width and height, and the given startAngle and spanAngle."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 1, 1.2, "XCoordinateArc", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -377,6 +405,10 @@
 			setFriendlyName(QObject::tr("Draw Ellipse"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Draws the ellipse defined by the rectangle beginning at (x, y) with the given width and height."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 1, 1.2, "XCoordinateEllipse", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -450,6 +482,10 @@
 			setFriendlyName(QObject::tr("Draw Line"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Draws a segment on the robot screen. The parameters specify the ends of the segment."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.72, 1.2, "X1CoordinateLine", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -522,6 +558,10 @@
 			setFriendlyName(QObject::tr("Draw Pixel"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Draws one pixel in the specified coordinates on the robot screen."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.72, 1.2, "XCoordinatePix", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -576,6 +616,10 @@
 			setFriendlyName(QObject::tr("Draw Rectangle"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Draws a rectangle on the robot screen. The parameters specify the coordinates of top-left corner, the width and the height of the rectangle."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 1, 1.2, "XCoordinateRect", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -649,6 +693,10 @@
 			setFriendlyName(QObject::tr("Initialize Videocamera"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Enables line or object or color detector by videocamera and draws videostream on the robot`s screen."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Mode", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -701,6 +749,10 @@
 			setFriendlyName(QObject::tr("Enable Video Streaming"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Enables video stream on robot. Video then can be watched on TRIK gamepad or in browser using URL http://ROBOT.IP.ADDRESS:8080/?action=stream"));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, -0.5, 1.2, QObject::tr("Enable Video Streaming"), 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -745,6 +797,10 @@
 			setFriendlyName(QObject::tr("Led"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Sets the color of the LED on the robot`s front panel."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.7, -0.7, "Color", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -790,6 +846,10 @@
 			setFriendlyName(QObject::tr("Play Sound"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Plays on the robot a sound file (.wav or .mp3) previously uploaded to it."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 1, -0.7, "FileName", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -835,6 +895,10 @@
 			setFriendlyName(QObject::tr("Play Tone"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Plays on the robot a sound with the given frequency and duration."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 1, -0.7, "Frequency", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -890,6 +954,10 @@
 			setFriendlyName(QObject::tr("Print Text"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Prints a given line in the specified coordinates and font size on the robot`s screen. The value of 'Text' property is interpreted as a plain text unless 'Evaluate' property is set to true, then it will be interpreted as an expression (that may be useful for example when debugging variables values)."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 1, 1.2, "XCoordinateText", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -963,6 +1031,10 @@
 			setFriendlyName(QObject::tr("Read Lidar To Variable"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Assigns a value from lidar to a given variable."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.66, 1.2, "variable", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1007,6 +1079,10 @@
 			setFriendlyName(QObject::tr("Remove File"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Removes a file. File path may be absolute or relative to a directory containing TRIK Studio executable."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.66, 1.2, "File", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1051,6 +1127,10 @@
 			setFriendlyName(QObject::tr("Sad Smile"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Draws a sad smile on the robot`s screen :("));
+		}
+
+		void initialize() override
+		{
 			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikSadSmileClass.sdf").documentElement());
 			setSize(QSizeF(50, 50));
 			initProperties();
@@ -1088,6 +1168,10 @@
 			setFriendlyName(QObject::tr("Say"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Synthesizes the given phrase and plays it on the robot. If 'Evaluate' property is set to true then the value of 'Text' property is interpreted as a formula, otherwise it is interpreted as plain string."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.7, -0.7, "Text", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1133,6 +1217,10 @@
 			setFriendlyName(QObject::tr("Send message"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Sends message to another robot."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.9, 1.2, "Message", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1186,6 +1274,10 @@
 			setFriendlyName(QObject::tr("TrikSensorBlock"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr(""));
+		}
+
+		void initialize() override
+		{
 			setSize(QSizeF(-1, -1));
 			initProperties();
 			setMouseGesture("");
@@ -1220,6 +1312,10 @@
 			setFriendlyName(QObject::tr("Background Color"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Sets the background color of the current picture on the robot`s screen."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.7, -0.7, "Color", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1265,6 +1361,10 @@
 			setFriendlyName(QObject::tr("Painter Color"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Sets the painter color."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.5, -0.7, "Color", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1309,6 +1409,10 @@
 			setFriendlyName(QObject::tr("Painter Width"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Sets the painter width."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 1, -0.7, "Width", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1353,6 +1457,10 @@
 			setFriendlyName(QObject::tr("Smile"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Draws a smile on the robot`s screen :)"));
+		}
+
+		void initialize() override
+		{
 			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikSmileClass.sdf").documentElement());
 			setSize(QSizeF(50, 50));
 			initProperties();
@@ -1390,6 +1498,10 @@
 			setFriendlyName(QObject::tr("Stop Videocamera"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Stops line or object or color detector by videocamera."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Mode", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1441,6 +1553,10 @@
 			setFriendlyName(QObject::tr("Disable Video Streaming"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Disables video stream on robot."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, -0.5, 1.2, QObject::tr("Disable Video Streaming"), 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1483,6 +1599,10 @@
 			setFriendlyName(QObject::tr("System Call"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Invokes bash script-style command on the robot. If 'Evaluate' property is set to true then the value of 'Command' property is interpreted as a formula, otherwise it is interpreted as plain string."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, 1.2, "Command", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1529,6 +1649,10 @@
 			setFriendlyName(QObject::tr("Angular Servo"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Manages angular servomotor. Sets up rotation angle on the given port in degrees. Values from 0 to 90 are correspond to a clockwise rotation and values from -90 to 0 correspond to counterclockwise rotation."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.5, -0.7, "Ports", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1583,6 +1707,10 @@
 			setFriendlyName(QObject::tr("Clear Encoder"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Nullifies tacho limit of the motors on the given ports."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Ports", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1628,6 +1756,10 @@
 			setFriendlyName(QObject::tr("Wait for Encoder"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits till the tacho limit of the motor on the given port will reach the value of the 'Tacho Limit' parameter."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1691,6 +1823,10 @@
 			setFriendlyName(QObject::tr("Clear Encoder"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Nullifies tacho limit of the motors on the given ports."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Ports", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1736,6 +1872,10 @@
 			setFriendlyName(QObject::tr("TrikV6EngineMovementCommand"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr(""));
+		}
+
+		void initialize() override
+		{
 			setSize(QSizeF(-1, -1));
 			initProperties();
 			setMouseGesture("");
@@ -1772,6 +1912,10 @@
 			setFriendlyName(QObject::tr("Motors Backward"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Enables motors on the given ports in reverse mode with the given power. Ports are specified in accordance with TRIK controller notations (for example M1, E2) and divided by commas. The power is specified in percents with the number from -100 to 100, if negative number is specified then the motor is enabled in the usual mode."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.5, -0.7, "Ports", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1827,6 +1971,10 @@
 			setFriendlyName(QObject::tr("Motors Forward"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Enables motors on the given ports with the given power. Ports are specified in accordance with TRIK controller notations (for example M1, E2) and divided by commas. The power is specified in percents with the number from -100 to 100, if negative number is specified then the motor is enabled in the reverse mode."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.5, -0.7, "Ports", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1882,6 +2030,10 @@
 			setFriendlyName(QObject::tr("Stop Motors"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Disables motors on the given ports."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.5, -0.7, "Ports", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1935,6 +2087,10 @@
 			setFriendlyName(QObject::tr("Wait for Accelerometer"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr(""));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 1, 1.2, "Acceleration", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -1997,6 +2153,10 @@
 			setFriendlyName(QObject::tr("Wait for Button"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits for press of a button on a brick."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, 1.2, "Button", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -2041,6 +2201,10 @@
 			setFriendlyName(QObject::tr("Wait for Encoder"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits till the tacho limit of the motor on the given port will reach the value of the 'Tacho Limit' parameter."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -2104,6 +2268,10 @@
 			setFriendlyName(QObject::tr("Wait for Gyroscope"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits till the value returned by the gyroscope on the given port will be greater or less than the given in the 'Degrees' parameter value."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 1.1, 1.2, "Degrees", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -2158,6 +2326,10 @@
 			setFriendlyName(QObject::tr("Wait for Infrared Distance"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits till the value returned by the infrared sensor on the given port will be greater or less than the given in the 'Distance' parameter value. By default on ports A1 and A2 the distance is specified in centimeters (from 0 to 100). It is not recommended to plug IR sensor into other ports because its raw value will be processed by software on robot with expectation of another sensor type."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -2222,6 +2394,10 @@
 			setFriendlyName(QObject::tr("Wait for Light"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits till the value returned by the light sensor on the given port will be greater or less than the given in the 'Percents' parameter value (0 to 100)."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -2293,6 +2469,10 @@
 			setFriendlyName(QObject::tr("Wait for Message"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Stores a message from another robot into a given variable. When no incoming messages are present at the moment, a robot will wait for incoming message if 'Synchronized' property is true, and empty string will be assigned to a variable otherwise."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 1, 1.2, "Variable", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -2346,6 +2526,10 @@
 			setFriendlyName(QObject::tr("Wait for Motion"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits till the motion sensor on the given port is triggered."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, QObject::tr("F1"), 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -2389,6 +2573,10 @@
 			setFriendlyName(QObject::tr("Wait for Ultrasonic Distance"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits till the value returned by the ultrasonic sensor on the given port will be greater or less than the given in the 'Distance' parameter value (the distance is specified in centimeters, from 0 to 300)."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -2451,6 +2639,10 @@
 			setFriendlyName(QObject::tr("Wait for Touch Sensor"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits till the touch sensor is pressed. The only parameter is a sensor`s port number (1, 2, 3 or 4)."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.8, -0.7, "Port", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -2496,6 +2688,10 @@
 			setFriendlyName(QObject::tr("Wait Gamepad Button"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits for Android gamepad 'magic button' press. Buttons are identified by numbers from 1 to 5 (from left to right)"));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, -0.7, 1.2, QObject::tr("Wait gamepad button"), 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -2547,6 +2743,10 @@
 			setFriendlyName(QObject::tr("Wait for Gamepad Connect"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits until Android gamepad is connected."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, -1.4, -0.7, QObject::tr("Wait for Gamepad Connect"), 0));
 			label_1->setBackground(Qt::transparent);
 			label_1->setScalingX(false);
@@ -2589,6 +2789,10 @@
 			setFriendlyName(QObject::tr("Wait for Gamepad Disconnect"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits until Android gamepad is disconnected."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, -1.4, -0.7, QObject::tr("Wait for Gamepad Disconnect"), 0));
 			label_1->setBackground(Qt::transparent);
 			label_1->setScalingX(false);
@@ -2631,6 +2835,10 @@
 			setFriendlyName(QObject::tr("Wait for Gamepad Wheel"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits till the value returned by gamepad wheel be greater or less than the given in the 'Angle' parameter value. Angle is measured from -100 (max left) to 100 (max right)."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, -1.4, -0.7, QObject::tr("Wait for Gamepad Wheel"), 0));
 			label_1->setBackground(Qt::transparent);
 			label_1->setScalingX(false);
@@ -2691,6 +2899,10 @@
 			setFriendlyName(QObject::tr("Wait Pad Press"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Waits for Android gamepad pad press (left pad has number 1, right pad - number 2)."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, -0.4, 1.2, QObject::tr("Wait pad press"), 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -2742,6 +2954,10 @@
 			setFriendlyName(QObject::tr("Write To File"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Writes a given message to a file. File path may be absolute or relative to a directory containing TRIK Studio executable."));
+		}
+
+		void initialize() override
+		{
 			QSharedPointer<qReal::LabelProperties> label_1(new qReal::LabelProperties(1, 0.66, 1.2, "File", false, 0));
 			label_1->setBackground(Qt::white);
 			label_1->setScalingX(false);
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <QtCore/QObject>
+#include <QtCore/QMap>
 
 #include <qrrepo/repoApi.h>
 #include <qrgui/plugins/toolPluginInterface/usedInterfaces/errorReporterInterface.h>
@@ -101,6 +102,12 @@ protected:
 
 	void replaceWithAutoIndent(QString &where, const QString &what, const QString &withWhat);
 
+	/// Substitutes placeholders occupying whole lines of the main template (like "@@MAIN_CODE@@" with some
+	/// indentation before it) with corresponding code indented like the placeholder and leaves at most one empty
+	/// line in a row. The result is assembled in one pass instead of replaceWithAutoIndent() call for each placeholder.
+	/// @param code Maps placeholders to code that shall be put instead of them.
+	static QString fillMainTemplate(const QString &mainTemplate, const QMap<QString, QString> &code);
+
 	const qrRepo::RepoApi &mRepo;
 	qReal::ErrorReporterInterface &mErrorReporter;
 	const kitBase::robotModel::RobotModelManagerInterface &mRobotModelManager;
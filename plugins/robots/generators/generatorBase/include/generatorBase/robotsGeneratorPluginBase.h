@@ -43,6 +43,11 @@ public:
 
 	QString friendlyKitName() const override;
 
+	/// Generates code for the active diagram into the given folder instead of generator root folder, generated code
+	/// is not shown in text editor. Used for batch generation without GUI.
+	/// @returns a path to generated file or an empty string if there were errors.
+	QString generateCodeInto(const QString &folder);
+
 protected slots:
 	/// Calls code generator. Returns file path if operation was successful and an empty string otherwise.
 	/// @param openTab If true after code generation a tab with generated code will be opened.
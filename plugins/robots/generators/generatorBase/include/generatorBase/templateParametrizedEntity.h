@@ -36,6 +36,10 @@ public:
 	/// Resets a path to a folder containing all concrete generator templates
 	void setPathsToTemplates(const QStringList &pathsTemplates);
 
+	/// Templates are read and parsed once and then are taken from process-wide cache. This method forgets
+	/// all cached templates, so they will be read again (needed only if template files were changed on disk).
+	static void clearTemplatesCache();
+
 protected:
 	/// Reads the given file contents. A path to file must be relative to templates folder root.
 	/// @param pathFromRoot A path to a concrete template relatively to specified in constructor folder.
@@ -51,7 +55,6 @@ protected:
 	QStringList pathsToRoot() const;
 
 	/// Replaces @@RANDOM_ID@@ occurences to some random c++ identifier.
-	/// Do not make \a templateString const&, replace() will be called on it.
 	QString addRandomIds(QString templateString) const;
 
 private:
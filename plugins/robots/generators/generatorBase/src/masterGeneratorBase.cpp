@@ -36,6 +36,67 @@
 using namespace generatorBase;
 using namespace qReal;
 
+namespace {
+
+/// Appends code to a string leaving at most one empty line in a row.
+class CodeBuilder
+{
+public:
+	explicit CodeBuilder(int capacity)
+	{
+		mCode.reserve(capacity);
+	}
+
+	void append(const QStringRef &code)
+	{
+		int chunkStart = 0;
+		for (int i = 0; i < code.length(); ++i) {
+			if (code.at(i) != '\n') {
+				mLineBreaks = 0;
+			} else if (mLineBreaks == 2) {
+				mCode.append(code.mid(chunkStart, i - chunkStart));
+				chunkStart = i + 1;
+			} else {
+				++mLineBreaks;
+			}
+		}
+
+		mCode.append(code.mid(chunkStart));
+	}
+
+	/// Appends code with the given indentation before each non-empty line, just like StringUtils::addIndent().
+	void appendIndented(const QString &code, const QStringRef &indent)
+	{
+		if (indent.isEmpty()) {
+			append(QStringRef(&code));
+			return;
+		}
+
+		bool first = true;
+		for (const QStringRef &line : code.splitRef('\n', QString::SkipEmptyParts)) {
+			if (!first) {
+				append(QStringRef(&mLineBreak));
+			}
+
+			append(indent);
+			append(line);
+			first = false;
+		}
+	}
+
+	const QString &code() const
+	{
+		return mCode;
+	}
+
+private:
+	const QString mLineBreak = "\n";
+	QString mCode;
+	int mLineBreaks = 0;
+};
+
+}
+
 MasterGeneratorBase::MasterGeneratorBase(const qrRepo::RepoApi &repo
 		, ErrorReporterInterface &errorReporter
 		, const kitBase::robotModel::RobotModelManagerInterface &robotModelManager
@@ -138,33 +199,30 @@ QString MasterGeneratorBase::generate(const QString &indentString)
 		return QString();
 	}
 
-	QString resultCode = readTemplate("main.t");
-	replaceWithAutoIndent(resultCode, "@@SUBPROGRAMS_FORWARDING@@"
-			, mCustomizer->factory()->subprograms()->forwardDeclarations());
-	replaceWithAutoIndent(resultCode, "@@SUBPROGRAMS@@"
-			, mCustomizer->factory()->subprograms()->implementations());
-	replaceWithAutoIndent(resultCode, "@@THREADS_FORWARDING@@"
-			, mCustomizer->factory()->threads().generateDeclarations());
-	replaceWithAutoIndent(resultCode, "@@THREADS@@"
-			, mCustomizer->factory()->threads().generateImplementations(indentString));
-	replaceWithAutoIndent(resultCode, "@@MAIN_CODE@@", mainCode);
-	replaceWithAutoIndent(resultCode, "@@INITHOOKS@@", utils::StringUtils::addIndent(
-			mCustomizer->factory()->initCode(), 1, indentString));
-	replaceWithAutoIndent(resultCode, "@@TERMINATEHOOKS@@", utils::StringUtils::addIndent(
-			mCustomizer->factory()->terminateCode(), 1, indentString));
-	replaceWithAutoIndent(resultCode, "@@USERISRHOOKS@@", utils::StringUtils::addIndent(
-			mCustomizer->factory()->isrHooksCode(), 1, indentString));
+	const QString mainTemplate = readTemplate("main.t");
+	QMap<QString, QString> code = {
+		{ "@@SUBPROGRAMS_FORWARDING@@", mCustomizer->factory()->subprograms()->forwardDeclarations() }
+		, { "@@SUBPROGRAMS@@", mCustomizer->factory()->subprograms()->implementations() }
+		, { "@@THREADS_FORWARDING@@", mCustomizer->factory()->threads().generateDeclarations() }
+		, { "@@THREADS@@", mCustomizer->factory()->threads().generateImplementations(indentString) }
+		, { "@@MAIN_CODE@@", mainCode }
+		, { "@@INITHOOKS@@", utils::StringUtils::addIndent(mCustomizer->factory()->initCode(), 1, indentString) }
+		, { "@@TERMINATEHOOKS@@"
+				, utils::StringUtils::addIndent(mCustomizer->factory()->terminateCode(), 1, indentString) }
+		, { "@@USERISRHOOKS@@"
+				, utils::StringUtils::addIndent(mCustomizer->factory()->isrHooksCode(), 1, indentString) }
+	};
+
 	const QString constantsString = mCustomizer->factory()->variables()->generateConstantsString();
 	const QString variablesString = mCustomizer->factory()->variables()->generateVariableString();
-	if (resultCode.contains("@@CONSTANTS@@")) {
-		replaceWithAutoIndent(resultCode, "@@CONSTANTS@@", constantsString);
-		replaceWithAutoIndent(resultCode, "@@VARIABLES@@", variablesString);
+	if (mainTemplate.contains("@@CONSTANTS@@")) {
+		code["@@CONSTANTS@@"] = constantsString;
+		code["@@VARIABLES@@"] = variablesString;
 	} else {
-		replaceWithAutoIndent(resultCode, "@@VARIABLES@@", constantsString + "\n" + variablesString);
+		code["@@VARIABLES@@"] = constantsString + "\n" + variablesString;
 	}
 
-	// This will remove too many empty lines
-	resultCode.replace(QRegExp("\n(\n)+"), "\n\n");
+	QString resultCode = fillMainTemplate(mainTemplate, code);
 
 	processGeneratedCode(resultCode);
 
@@ -269,6 +327,47 @@ void MasterGeneratorBase::outputCode(const QString &path, const QString &code)
 	out() << code;
 }
 
+QString MasterGeneratorBase::fillMainTemplate(const QString &mainTemplate, const QMap<QString, QString> &code)
+{
+	int capacity = mainTemplate.length();
+	for (const QString &part : code) {
+		capacity += part.length();
+	}
+
+	// Some more space for indentation.
+	CodeBuilder result(capacity + capacity / 8);
+
+	int lineStart = 0;
+	while (lineStart < mainTemplate.length()) {
+		int lineEnd = mainTemplate.indexOf('\n', lineStart);
+		if (lineEnd == -1) {
+			lineEnd = mainTemplate.length();
+		}
+
+		const QStringRef line = mainTemplate.midRef(lineStart, lineEnd - lineStart);
+		int indentLength = 0;
+		while (indentLength < line.length() && (line.at(indentLength) == ' ' || line.at(indentLength) == '\t')) {
+			++indentLength;
+		}
+
+		const QStringRef placeholder = line.mid(indentLength);
+		const auto part = placeholder.startsWith("@@") && placeholder.endsWith("@@")
+				? code.constFind(placeholder.toString())
+				: code.constEnd();
+
+		if (part == code.constEnd()) {
+			result.append(mainTemplate.midRef(lineStart, lineEnd + 1 - lineStart));
+		} else {
+			result.appendIndented(part.value(), line.left(indentLength));
+			result.append(mainTemplate.midRef(lineEnd, 1));
+		}
+
+		lineStart = lineEnd + 1;
+	}
+
+	return result.code();
+}
+
 void MasterGeneratorBase::replaceWithAutoIndent(QString &where, const QString &what, const QString &withWhat)
 {
 	const QRegularExpression regexp(QString("^(([ \\t]*)%1)$").arg(what), QRegularExpression::MultilineOption);
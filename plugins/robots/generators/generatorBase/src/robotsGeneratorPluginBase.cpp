@@ -200,6 +200,21 @@ QString RobotsGeneratorPluginBase::generateCode(bool openTab)
 	return generatedSrcPath;
 }
 
+QString RobotsGeneratorPluginBase::generateCodeInto(const QString &folder)
+{
+	mMainWindowInterface->errorReporter()->clearErrors();
+	mMainWindowInterface->errorReporter()->clear();
+
+	QScopedPointer<MasterGeneratorBase> generator(masterGenerator());
+	const QString projectName = NameNormalizer::normalizeStrongly(defaultProjectName(), false);
+
+	generator->initialize();
+	generator->setProjectDir(QFileInfo(folder + "/" + defaultFilePath(projectName)));
+
+	const QString generatedSrcPath = generator->generate(language().indent());
+	return mMainWindowInterface->errorReporter()->wereErrors() ? QString() : generatedSrcPath;
+}
+
 void RobotsGeneratorPluginBase::regenerateCode(const qReal::Id &diagram
 		, const QFileInfo &oldFileInfo
 		, const QFileInfo &newFileInfo)
@@ -33,6 +33,7 @@ Structurizator::Structurizator(QObject *parent)
 	, mVerticesNumber(1)
 	, mStartVertex(-1)
 	, mMaxPostOrderTime(-1)
+	, mHasDominatorTree(true)
 {
 }
 
@@ -48,6 +49,8 @@ IntermediateStructurizatorNode *Structurizator::performStructurization(const QSe
 		mVertices.insert(vertexNumber[id]);
 	}
 
+	mInitialVertices = mVertices;
+
 	mVerticesNumber = verticesNumber;
 	mStartVertex = startVertex;
 
@@ -68,7 +71,7 @@ IntermediateStructurizatorNode *Structurizator::performStructurization(const QSe
 
 		int t = 0;
 		while (t <= mMaxPostOrderTime && (mVertices.size() > 1 || !mFollowers[mStartVertex].isEmpty())) {
-			int v = mPostOrder.key(t);
+			int v = mVertexByTime[t];
 
 			QSet<int> reachUnder;
 			QSet<QPair<int, int>> edgesToRemove = {};
@@ -149,7 +152,7 @@ bool Structurizator::isBlock(int v, QSet<QPair<int, int>> &edgesToRemove, QMap<Q
 	}
 
 	int u = mFollowers[v].first();
-	if (outgoingEdgesNumber(u) <= 1 && incomingEdgesNumber(u) == 1 && u != v && mDominators[u].contains(v)) {
+	if (outgoingEdgesNumber(u) <= 1 && incomingEdgesNumber(u) == 1 && u != v && dominates(v, u)) {
 		verticesRoles["block1"] = v;
 		verticesRoles["block2"] = u;
 
@@ -168,8 +171,8 @@ bool Structurizator::isIfThenElse(int v, QSet<QPair<int, int>> &edgesToRemove, Q
 
 	int u1 = mFollowers[v].first();
 	int u2 = mFollowers[v].last();
-	if (incomingEdgesNumber(u1) != 1 || incomingEdgesNumber(u2) != 1 || mDominators[v].contains(u1)
-			|| mDominators[v].contains(u2)) {
+	if (incomingEdgesNumber(u1) != 1 || incomingEdgesNumber(u2) != 1 || dominates(u1, v)
+			|| dominates(u2, v)) {
 		return false;
 	}
 
@@ -211,7 +214,7 @@ bool Structurizator::isIfThen(int v, QSet<QPair<int, int>> &edgesToRemove, QMap<
 		elseNumber = u1;
 	}
 
-	if (thenNumber == -1 || elseNumber == v || mDominators[v].contains(thenNumber)) {
+	if (thenNumber == -1 || elseNumber == v || dominates(thenNumber, v)) {
 		return false;
 	}
 
@@ -255,7 +258,7 @@ bool Structurizator::isSwitch(int v, QSet<QPair<int, int>> &edgesToRemove, QMap<
 			vertices.insert(u);
 		}
 
-		if (u != exit && mDominators[v].contains(u)) {
+		if (u != exit && dominates(u, v)) {
 			return false;
 		}
 
@@ -315,7 +318,7 @@ bool Structurizator::isWhileLoop(int v, QSet<QPair<int, int>> &edgesToRemove, QM
 		return false;
 	}
 
-	if (mDominators[v].contains(bodyNumber)) {
+	if (dominates(bodyNumber, v)) {
 		return false;
 	}
 
@@ -366,7 +369,7 @@ bool Structurizator::isHeadOfCycle(int v, QSet<int> &reachUnder)
 	QQueue<int> queueForReachUnder;
 
 	for (const int u : mPredecessors[v]) {
-		if (mDominators[u].contains(v)) {
+		if (dominates(v, u)) {
 			queueForReachUnder.push_back(u);
 		}
 	}
@@ -376,7 +379,7 @@ bool Structurizator::isHeadOfCycle(int v, QSet<int> &reachUnder)
 		queueForReachUnder.pop_front();
 		reachUnder.insert(u);
 		for (const int w : mPredecessors[u]) {
-			if (mDominators[w].contains(v) && !reachUnder.contains(w)) {
+			if (dominates(v, w) && !reachUnder.contains(w)) {
 				queueForReachUnder.push_back(w);
 			}
 		}
@@ -587,10 +590,11 @@ void Structurizator::reduceConditionsWithBreaks(int &v, QMap<int, QSet<int>> &no
 
 		StructurizatorNodeWithBreaks *nodeWithBreaks = new StructurizatorNodeWithBreaks(mTrees[u]
 				, exitBranches, this);
-		replace(appendVertex(nodeWithBreaks), edgesToRemove, vertices);
+		const int newNodeNumber = appendVertex(nodeWithBreaks);
+		replace(newNodeNumber, edgesToRemove, vertices);
 
 		if (u == v) {
-			v = mTrees.key(nodeWithBreaks);
+			v = newNodeNumber;
 		}
 	}
 
@@ -605,8 +609,8 @@ void Structurizator::replace(int newNodeNumber, QSet<QPair<int, int>> &edgesToRe
 {
 	updateEdges(newNodeNumber, edgesToRemove, vertices);
 	updatePostOrder(newNodeNumber, vertices);
-	updateDominators(newNodeNumber, vertices);
 	updateVertices(newNodeNumber, vertices);
+	updateDominators(newNodeNumber, vertices);
 	removeNodesPreviouslyDetectedAsNodeWithExit(vertices);
 }
 
@@ -624,9 +628,21 @@ void Structurizator::updateEdges(int newNodeNumber, QSet<QPair<int, int>> &edges
 		mPredecessors[p.second].removeAll(p.first);
 	}
 
-	const QMap<int, QVector<int>> followers = mFollowers;
+	// only reduced vertices and their predecessors have edges to be replaced
+	QSet<int> affectedVertices = vertices;
+	for (const int v : vertices) {
+		for (const int u : mPredecessors[v]) {
+			affectedVertices.insert(u);
+		}
+	}
+
 	for (const int v : mVertices) {
-		for (const int u : followers[v]) {
+		if (!affectedVertices.contains(v)) {
+			continue;
+		}
+
+		const QVector<int> followers = mFollowers.value(v);
+		for (const int u : followers) {
 
 			int newV = vertices.contains(v) ? newNodeNumber : v;
 			int newU = vertices.contains(u) ? newNodeNumber : u;
@@ -655,44 +671,106 @@ void Structurizator::updatePostOrder(int newNodeNumber, QSet<int> &verteces)
 {
 	int maximum = -1;
 	for (int v : verteces) {
-		if (maximum == -1 || maximum < mPostOrder[v]) {
-			maximum = mPostOrder[v];
-		}
+		maximum = qMax(maximum, mPostOrder.value(v, -1));
+		mPostOrder.remove(v);
+	}
+
+	if (maximum == -1) {
+		return;
 	}
 
 	mPostOrder[newNodeNumber] = maximum;
+	mVertexByTime[maximum] = newNodeNumber;
+
+	// removing times of reduced vertices, order of the remaining ones is kept
+	int time = 0;
+	for (int i = 0; i < mVertexByTime.size(); i++) {
+		const int v = mVertexByTime[i];
+		if (mPostOrder.value(v, -1) == i) {
+			mVertexByTime[time] = v;
+			mPostOrder[v] = time;
+			time++;
+		}
+	}
 
-	for (int v : verteces) {
-		mPostOrder.remove(v);
+	mVertexByTime.resize(time);
+	mMaxPostOrderTime = time - 1;
+}
+
+void Structurizator::updateDominators(int newNodeNumber, QSet<int> &vertices)
+{
+	if (!mHasDominatorTree) {
+		updateDominatorSets(newNodeNumber, vertices);
+		return;
 	}
 
-	mMaxPostOrderTime = mMaxPostOrderTime - verteces.size() + 1;
+	// Reduced vertices usually form a subtree of dominator tree (the head of a pattern dominates all other its
+	// vertices), then new vertex takes place of the head and adopts children of all reduced vertices.
+	int head = -1;
+	for (const int v : vertices) {
+		if (mDominatorTreeEntry.value(v, -1) == -1) {
+			head = -1;
+			break;
+		}
 
-	QVector<int> times = mPostOrder.values().toVector();
-	std::sort(times.begin(), times.end());
+		if (!vertices.contains(mImmediateDominator[v])) {
+			if (head != -1) {
+				head = -1;
+				break;
+			}
 
-	for (int i = 0; i <= mMaxPostOrderTime; i++) {
-		int v = mPostOrder.key(times[i]);
-		mPostOrder[v] = i;
+			head = v;
+		}
+	}
+
+	if (head == -1) {
+		// Dominance relation updated this way is not a tree anymore, so it is kept as sets from now on. Recalculating
+		// it from the reduced graph would give different dominators and so different code than before.
+		convertDominatorTreeToSets(vertices);
+		updateDominatorSets(newNodeNumber, vertices);
+		return;
+	}
+
+	const int parent = mImmediateDominator[head];
+	if (parent != -1) {
+		QVector<int> &siblings = mDominatedVertices[parent];
+		siblings[siblings.indexOf(head)] = newNodeNumber;
+	}
+
+	mImmediateDominator[newNodeNumber] = parent;
+	mDominatorTreeEntry[newNodeNumber] = mDominatorTreeEntry[head];
+	mDominatorTreeExit[newNodeNumber] = mDominatorTreeExit[head];
+
+	for (const int v : vertices) {
+		for (const int u : mDominatedVertices[v]) {
+			if (!vertices.contains(u)) {
+				mDominatedVertices[newNodeNumber].append(u);
+				mImmediateDominator[u] = newNodeNumber;
+			}
+		}
+
+		mImmediateDominator[v] = -1;
+		mDominatedVertices[v].clear();
+		mDominatorTreeEntry[v] = -1;
+		mDominatorTreeExit[v] = -1;
 	}
 }
 
-void Structurizator::updateDominators(int newNodeNumber, QSet<int> &vertices)
+void Structurizator::updateDominatorSets(int newNodeNumber, QSet<int> &vertices)
 {
 	// others
-	for (int v : mPostOrder.keys()) {
-		QSet<int> tempSet = mDominators[v];
-		tempSet.intersect(vertices);
-		if (!tempSet.isEmpty()) {
-			mDominators[v].subtract(vertices);
-			mDominators[v].insert(newNodeNumber);
+	for (const int v : mPostOrder.keys()) {
+		QSet<int> &dominators = mDominators[v];
+		if (dominators.intersects(vertices)) {
+			dominators.subtract(vertices);
+			dominators.insert(newNodeNumber);
 		}
 	}
 
 	// new
 	QSet<int> doms = mVertices;
-	for (int v : vertices) {
-		doms.intersect(mDominators[v]);
+	for (const int v : vertices) {
+		doms.intersect(mDominators.value(v));
 	}
 
 	doms.subtract(vertices);
@@ -701,11 +779,30 @@ void Structurizator::updateDominators(int newNodeNumber, QSet<int> &vertices)
 	mDominators[newNodeNumber] = doms;
 
 	// old
-	for (int v : vertices) {
+	for (const int v : vertices) {
 		mDominators.remove(v);
 	}
 }
 
+void Structurizator::convertDominatorTreeToSets(const QSet<int> &reducedVertices)
+{
+	QSet<int> vertices = mVertices;
+	vertices.unite(reducedVertices);
+	for (const int v : vertices) {
+		QSet<int> &dominators = mDominators[v];
+		if (mDominatorTreeEntry.value(v, -1) == -1) {
+			dominators = mInitialVertices;
+			continue;
+		}
+
+		for (int u = v; u != -1; u = mImmediateDominator[u]) {
+			dominators.insert(u);
+		}
+	}
+
+	mHasDominatorTree = false;
+}
+
 void Structurizator::updateVertices(int newNodeNumber, QSet<int> &vertices)
 {
 	mStartVertex = vertices.contains(mStartVertex) ? newNodeNumber : mStartVertex;
@@ -722,36 +819,107 @@ void Structurizator::removeNodesPreviouslyDetectedAsNodeWithExit(QSet<int> &vert
 
 void Structurizator::calculateDominators()
 {
-	for (const int u : mVertices) {
-		mDominators[u] = mVertices;
+	// Cooper, Harvey, Kennedy, "A Simple, Fast Dominance Algorithm". Reachable vertices are numbered in postorder
+	// of depth-first search, so immediate dominator of a vertex always has greater number than the vertex itself.
+	mImmediateDominator.fill(-1, mVerticesNumber + 1);
+	mDominatedVertices.fill({}, mVerticesNumber + 1);
+	mDominatorTreeEntry.fill(-1, mVerticesNumber + 1);
+	mDominatorTreeExit.fill(-1, mVerticesNumber + 1);
+
+	if (!mVertices.contains(mStartVertex)) {
+		return;
+	}
+
+	QVector<int> order;
+	QVector<int> number(mVerticesNumber + 1, -1);
+	QVector<QPair<int, int>> stack = { qMakePair(mStartVertex, 0) };
+	number[mStartVertex] = 0;
+	while (!stack.isEmpty()) {
+		const int v = stack.last().first;
+		const QVector<int> followers = mFollowers.value(v);
+		if (stack.last().second < followers.size()) {
+			const int u = followers[stack.last().second++];
+			if (number[u] == -1) {
+				number[u] = 0;
+				stack.append(qMakePair(u, 0));
+			}
+		} else {
+			number[v] = order.size();
+			order.append(v);
+			stack.removeLast();
+		}
 	}
 
-	mDominators[mStartVertex] = { mStartVertex };
+	const int root = order.size() - 1;
+	QVector<QVector<int>> predecessors(order.size());
+	for (int i = 0; i < root; i++) {
+		for (const int u : mPredecessors.value(order[i])) {
+			if (number[u] != -1) {
+				predecessors[i].append(number[u]);
+			}
+		}
+	}
 
-	bool somethingChanged = true;
-	while (somethingChanged) {
-		somethingChanged = false;
+	QVector<int> dominators(order.size(), -1);
+	dominators[root] = root;
 
-		for (const int v : mVertices) {
-			if (v == mStartVertex) {
-				continue;
+	const auto intersect = [&dominators](int first, int second) {
+		while (first != second) {
+			while (first < second) {
+				first = dominators[first];
 			}
 
-			QSet<int> doms = mVertices;
-			for (const int u : mPredecessors[v]) {
-				doms = doms.intersect(mDominators[u]);
+			while (second < first) {
+				second = dominators[second];
 			}
+		}
 
-			doms.insert(v);
+		return first;
+	};
 
-			if (doms != mDominators[v]) {
-				mDominators[v] = doms;
+	bool somethingChanged = true;
+	while (somethingChanged) {
+		somethingChanged = false;
+
+		for (int i = root - 1; i >= 0; i--) {
+			int newDominator = -1;
+			for (const int u : predecessors[i]) {
+				if (dominators[u] != -1) {
+					newDominator = newDominator == -1 ? u : intersect(u, newDominator);
+				}
+			}
+
+			if (dominators[i] != newDominator) {
+				dominators[i] = newDominator;
 				somethingChanged = true;
 			}
 		}
 	}
 
+	for (int i = 0; i < root; i++) {
+		mImmediateDominator[order[i]] = order[dominators[i]];
+		mDominatedVertices[order[dominators[i]]].append(order[i]);
+	}
+
+	numberDominatorTree();
+}
 
+void Structurizator::numberDominatorTree()
+{
+	int time = 0;
+	QVector<QPair<int, int>> stack = { qMakePair(mStartVertex, 0) };
+	mDominatorTreeEntry[mStartVertex] = time++;
+	while (!stack.isEmpty()) {
+		const int v = stack.last().first;
+		if (stack.last().second < mDominatedVertices[v].size()) {
+			const int u = mDominatedVertices[v][stack.last().second++];
+			mDominatorTreeEntry[u] = time++;
+			stack.append(qMakePair(u, 0));
+		} else {
+			mDominatorTreeExit[v] = time++;
+			stack.removeLast();
+		}
+	}
 }
 
 void Structurizator::findStartVertex()
@@ -767,6 +935,7 @@ void Structurizator::findStartVertex()
 void Structurizator::calculatePostOrder()
 {
 	mPostOrder.clear();
+	mVertexByTime.clear();
 
 	QMap<int, bool> used;
 	for (const int v : mVertices) {
@@ -796,6 +965,7 @@ void Structurizator::dfs(int v, int &currentTime, QMap<int, bool> &used)
 	}
 
 	mPostOrder[v] = currentTime;
+	mVertexByTime.append(v);
 	currentTime++;
 }
 
@@ -812,9 +982,33 @@ int Structurizator::appendVertex(IntermediateStructurizatorNode *node)
 	mTrees[mVerticesNumber] = node;
 	mVertices.insert(mVerticesNumber);
 
+	mImmediateDominator.resize(mVerticesNumber + 1);
+	mImmediateDominator[mVerticesNumber] = -1;
+	mDominatedVertices.resize(mVerticesNumber + 1);
+	mDominatorTreeEntry.resize(mVerticesNumber + 1);
+	mDominatorTreeEntry[mVerticesNumber] = -1;
+	mDominatorTreeExit.resize(mVerticesNumber + 1);
+	mDominatorTreeExit[mVerticesNumber] = -1;
+
 	return mVerticesNumber;
 }
 
+bool Structurizator::dominates(int dominator, int v) const
+{
+	if (!mHasDominatorTree) {
+		return mDominators.value(v).contains(dominator);
+	}
+
+	if (mDominatorTreeEntry.value(v, -1) == -1) {
+		// unreachable vertices are dominated by every vertex of initial graph
+		return mInitialVertices.contains(dominator);
+	}
+
+	return mDominatorTreeEntry.value(dominator, -1) != -1
+			&& mDominatorTreeEntry[dominator] <= mDominatorTreeEntry[v]
+			&& mDominatorTreeExit[v] <= mDominatorTreeExit[dominator];
+}
+
 int Structurizator::outgoingEdgesNumber(int v) const
 {
 	return mFollowers[v].size();
@@ -16,6 +16,7 @@
 
 #include <QtCore/QSet>
 #include <QtCore/QMap>
+#include <QtCore/QVector>
 
 #include <qrkernel/ids.h>
 
@@ -110,10 +111,17 @@ private:
 	void updateEdges(int newNodeNumber, QSet<QPair<int, int>> &edgesToRemove, QSet<int> &vertices);
 	void updatePostOrder(int newNodeNumber, QSet<int> &vertices);
 	void updateDominators(int newNodeNumber, QSet<int> &vertices);
+	void updateDominatorSets(int newNodeNumber, QSet<int> &vertices);
 	void updateVertices(int newNodeNumber, QSet<int> &vertices);
 
+	/// Switches from dominator tree to sets of dominators for each vertex, used when reduced vertices do not form
+	/// a subtree of dominator tree.
+	void convertDominatorTreeToSets(const QSet<int> &reducedVertices);
+
 	/// methods used before structurization process
+	/// Calculates dominator tree using Cooper-Harvey-Kennedy algorithm.
 	void calculateDominators();
+	void numberDominatorTree();
 	void findStartVertex();
 	void calculatePostOrder();
 	void createInitialNodesForIds();
@@ -123,6 +131,9 @@ private:
 	void removeNodesPreviouslyDetectedAsNodeWithExit(QSet<int> &vertices);
 	int appendVertex(IntermediateStructurizatorNode *node);
 
+	/// Returns true if every path from start vertex to v goes through dominator.
+	bool dominates(int dominator, int v) const;
+
 	int outgoingEdgesNumber(int v) const;
 	int incomingEdgesNumber(int v) const;
 
@@ -130,13 +141,27 @@ private:
 	QSet<VertexNumber> mVertices;
 	QMap<VertexNumber, QVector<VertexNumber>> mFollowers;
 	QMap<VertexNumber, QVector<VertexNumber>> mPredecessors;
-	QMap<VertexNumber, QSet<VertexNumber>> mDominators;
 	QMap<VertexNumber, Time> mPostOrder;
+	QVector<VertexNumber> mVertexByTime;
+
+	/// Dominator tree in arrays indexed by vertex number: immediate dominator (-1 for start vertex and unreachable
+	/// ones), dominated children and times of entering and leaving a vertex during depth-first search over the tree.
+	/// A vertex dominates another one iff its time interval contains the interval of another one.
+	QVector<VertexNumber> mImmediateDominator;
+	QVector<QVector<VertexNumber>> mDominatedVertices;
+	QVector<Time> mDominatorTreeEntry;
+	QVector<Time> mDominatorTreeExit;
+
+	/// Dominators of each vertex, used instead of dominator tree after it can not be updated incrementally.
+	QMap<VertexNumber, QSet<VertexNumber>> mDominators;
+	bool mHasDominatorTree;
+
 	QMap<VertexNumber, VertexNumber> mWasPreviouslyDetectedAsNodeWithExit;
 
 	QMap<int, IntermediateStructurizatorNode *> mTrees;
 
 	QSet<qReal::Id> mInitialIds;
+	QSet<VertexNumber> mInitialVertices;
 	int mVerticesNumber;
 	int mStartVertex;
 	int mMaxPostOrderTime;
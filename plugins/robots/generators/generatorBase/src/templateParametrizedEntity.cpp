@@ -15,7 +15,13 @@
 #include "generatorBase/templateParametrizedEntity.h"
 
 #include <QtCore/QDebug>
+#include <QtCore/QFile>
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
+#include <QtCore/QSet>
+#include <QtCore/QSharedPointer>
 #include <QtCore/QUuid>
+#include <QtCore/QVector>
 
 #include <qrutils/inFile.h>
 #include <qrutils/nameNormalizer.h>
@@ -23,32 +29,186 @@
 
 using namespace generatorBase;
 
-TemplateParametrizedEntity::TemplateParametrizedEntity()
+namespace {
+
+/// Template contents split by @@RANDOM_ID@@ and @@RANDOM_ID_n@@ placeholders.
+struct ParsedTemplate
 {
-}
+	/// Text between placeholders, there is always one more segment than placeholders.
+	QStringList segments;
 
-TemplateParametrizedEntity::TemplateParametrizedEntity(const QStringList &pathsToTemplates)
-	: mPathsToRoot(pathsToTemplates)
+	/// Number of random identifier for each placeholder, 0 for @@RANDOM_ID@@ and n for @@RANDOM_ID_n@@.
+	QVector<int> randomIds;
+
+	/// Count of different random identifiers, i.e. the greatest number in randomIds plus one.
+	int randomIdsCount = 0;
+
+	/// Total length of segments.
+	int length = 0;
+};
+
+struct Placeholder
+{
+	int position;
+	int length;
+	int randomId;
+};
+
+ParsedTemplate parseTemplate(const QString &text)
 {
+	const QString prefix = "@@RANDOM_ID";
+	QList<Placeholder> placeholders;
+	QSet<int> usedIds;
+	int position = text.indexOf(prefix);
+	while (position != -1) {
+		int end = position + prefix.length();
+		int randomId = -1;
+		if (text.midRef(end, 2) == "@@") {
+			randomId = 0;
+		} else if (text.midRef(end, 1) == "_" && end + 1 < text.length() && text[end + 1] != '0') {
+			const int numberStart = end + 1;
+			end = numberStart;
+			while (end < text.length() && text[end].isDigit()) {
+				++end;
+			}
+
+			if (end > numberStart && text.midRef(end, 2) == "@@") {
+				randomId = text.midRef(numberStart, end - numberStart).toInt();
+			}
+		}
+
+		if (randomId == -1) {
+			position = text.indexOf(prefix, position + 1);
+			continue;
+		}
+
+		end += 2;
+		placeholders << Placeholder{position, end - position, randomId};
+		usedIds.insert(randomId);
+		position = text.indexOf(prefix, end);
+	}
+
+	// @@RANDOM_ID_n@@ are numbered consecutively from 1, placeholders after the first missing number are left as is.
+	int lastRandomId = 0;
+	while (usedIds.contains(lastRandomId + 1)) {
+		++lastRandomId;
+	}
+
+	ParsedTemplate result;
+	result.randomIdsCount = lastRandomId + 1;
+	int segmentStart = 0;
+	for (const Placeholder &placeholder : placeholders) {
+		if (placeholder.randomId <= lastRandomId) {
+			result.segments << text.mid(segmentStart, placeholder.position - segmentStart);
+			result.randomIds << placeholder.randomId;
+			segmentStart = placeholder.position + placeholder.length;
+		}
+	}
+
+	result.segments << text.mid(segmentStart);
+	for (const QString &segment : result.segments) {
+		result.length += segment.length();
+	}
+
+	return result;
 }
 
-TemplateParametrizedEntity::~TemplateParametrizedEntity()
+QString instantiateTemplate(const ParsedTemplate &parsed)
 {
+	if (parsed.randomIds.isEmpty()) {
+		return parsed.segments.first();
+	}
+
+	QVector<QString> randomIds(parsed.randomIdsCount);
+	QString result;
+	result.reserve(parsed.length + parsed.randomIds.size() * QUuid().toString().length());
+	for (int i = 0; i < parsed.randomIds.size(); ++i) {
+		QString &randomId = randomIds[parsed.randomIds[i]];
+		if (randomId.isNull()) {
+			randomId = utils::NameNormalizer::normalizeStrongly(QUuid::createUuid().toString(), false);
+		}
+
+		result.append(parsed.segments[i]);
+		result.append(randomId);
+	}
+
+	result.append(parsed.segments.last());
+	return result;
 }
 
-QString TemplateParametrizedEntity::readTemplate(const QString &pathFromRoot) const
+/// Process-wide cache of parsed templates, so each template file is read only once. Templates are compiled into
+/// resources of generator plugins, so they are not expected to change while the application is running.
+class TemplatesCache
 {
-	for (const QString &path: mPathsToRoot) {
-		const QString fullPath = path + '/' + pathFromRoot;
+public:
+	/// Returns parsed template from the file with the given path or null pointer if it can not be read.
+	QSharedPointer<const ParsedTemplate> find(const QString &fullPath)
+	{
+		QMutexLocker lock(&mMutex);
+		const auto cached = mTemplates.constFind(fullPath);
+		if (cached != mTemplates.constEnd()) {
+			return cached.value();
+		}
+
+		QSharedPointer<const ParsedTemplate> result;
 		if (QFile::exists(fullPath)) {
 			QString errorMessage;
-			const QString result = utils::InFile::readAll(fullPath, &errorMessage);
+			const QString contents = utils::InFile::readAll(fullPath, &errorMessage);
 			if (!errorMessage.isEmpty()) {
 				QLOG_ERROR() << "Reading from template while generating code failed";
 				qWarning() << "TemplateParametrizedEntity::readTemplate" << errorMessage;
+			} else {
+				result.reset(new ParsedTemplate(parseTemplate(contents)));
 			}
+		}
 
-			return addRandomIds(result);
+		mTemplates.insert(fullPath, result);
+		return result;
+	}
+
+	void clear()
+	{
+		QMutexLocker lock(&mMutex);
+		mTemplates.clear();
+	}
+
+private:
+	QMutex mMutex;
+	QHash<QString, QSharedPointer<const ParsedTemplate>> mTemplates;
+};
+
+TemplatesCache &templatesCache()
+{
+	static TemplatesCache cache;
+	return cache;
+}
+
+}
+
+TemplateParametrizedEntity::TemplateParametrizedEntity()
+{
+}
+
+TemplateParametrizedEntity::TemplateParametrizedEntity(const QStringList &pathsToTemplates)
+	: mPathsToRoot(pathsToTemplates)
+{
+}
+
+TemplateParametrizedEntity::~TemplateParametrizedEntity()
+{
+}
+
+void TemplateParametrizedEntity::clearTemplatesCache()
+{
+	templatesCache().clear();
+}
+
+QString TemplateParametrizedEntity::readTemplate(const QString &pathFromRoot) const
+{
+	for (const QString &path: mPathsToRoot) {
+		const QSharedPointer<const ParsedTemplate> parsed = templatesCache().find(path + '/' + pathFromRoot);
+		if (parsed) {
+			return instantiateTemplate(*parsed);
 		}
 	}
 
@@ -61,16 +221,9 @@ QString TemplateParametrizedEntity::readTemplate(const QString &pathFromRoot) co
 QString TemplateParametrizedEntity::readTemplateIfExists(const QString &pathFromRoot, const QString &fallback) const
 {
 	for (const QString &path: mPathsToRoot) {
-		const QString fullPath = path + '/' + pathFromRoot;
-		if (QFile::exists(fullPath)) {
-			QString errorMessage;
-			const QString result = utils::InFile::readAll(fullPath, &errorMessage);
-			if (!errorMessage.isEmpty()) {
-				QLOG_ERROR() << "Reading from template while generating code failed";
-				qWarning() << "TemplateParametrizedEntity::readTemplate" << errorMessage;
-			} else {
-				return addRandomIds(result);
-			}
+		const QSharedPointer<const ParsedTemplate> parsed = templatesCache().find(path + '/' + pathFromRoot);
+		if (parsed) {
+			return instantiateTemplate(*parsed);
 		}
 	}
 
@@ -84,20 +237,7 @@ QStringList TemplateParametrizedEntity::pathsToRoot() const
 
 QString TemplateParametrizedEntity::addRandomIds(QString templateString) const
 {
-	int index = 0;
-	QString randomId = utils::NameNormalizer::normalizeStrongly(QUuid::createUuid().toString(), false);
-	templateString.replace("@@RANDOM_ID@@", randomId);
-	while (true) {
-		const QString pattern = QString("@@RANDOM_ID_%1@@").arg(++index);
-		if (!templateString.contains(pattern)) {
-			break;
-		}
-
-		randomId = utils::NameNormalizer::normalizeStrongly(QUuid::createUuid().toString(), false);
-		templateString.replace(pattern, randomId);
-	}
-
-	return templateString;
+	return instantiateTemplate(parseTemplate(templateString));
 }
 
 void TemplateParametrizedEntity::setPathsToTemplates(const QStringList &pathsTemplates)
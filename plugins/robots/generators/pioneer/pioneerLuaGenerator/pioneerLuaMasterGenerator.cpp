@@ -148,36 +148,32 @@ QString PioneerLuaMasterGenerator::generate(const QString &indentString)
 		return QString();
 	}
 
-	QString resultCode = readTemplate("main.t");
-	replaceWithAutoIndent(resultCode, "@@SUBPROGRAMS_FORWARDING@@"
-			, mCustomizer->factory()->subprograms()->forwardDeclarations());
-	replaceWithAutoIndent(resultCode, "@@SUBPROGRAMS@@"
-			, mCustomizer->factory()->subprograms()->implementations());
-	replaceWithAutoIndent(resultCode, "@@THREADS_FORWARDING@@"
-			, mCustomizer->factory()->threads().generateDeclarations());
-	replaceWithAutoIndent(resultCode, "@@THREADS@@"
-			, mCustomizer->factory()->threads().generateImplementations(indentString));
-	replaceWithAutoIndent(resultCode, "@@MAIN_CODE@@", mainCode);
-	replaceWithAutoIndent(resultCode, "@@INITHOOKS@@", mCustomizer->factory()->initCode());
-	replaceWithAutoIndent(resultCode, "@@TERMINATEHOOKS@@", utils::StringUtils::addIndent(
-			mCustomizer->factory()->terminateCode(), 1, indentString));
-	replaceWithAutoIndent(resultCode, "@@USERISRHOOKS@@", utils::StringUtils::addIndent(
-			mCustomizer->factory()->isrHooksCode(), 1, indentString));
+	const QString mainTemplate = readTemplate("main.t");
+	QMap<QString, QString> code = {
+		{ "@@SUBPROGRAMS_FORWARDING@@", mCustomizer->factory()->subprograms()->forwardDeclarations() }
+		, { "@@SUBPROGRAMS@@", mCustomizer->factory()->subprograms()->implementations() }
+		, { "@@THREADS_FORWARDING@@", mCustomizer->factory()->threads().generateDeclarations() }
+		, { "@@THREADS@@", mCustomizer->factory()->threads().generateImplementations(indentString) }
+		, { "@@MAIN_CODE@@", mainCode }
+		, { "@@INITHOOKS@@", mCustomizer->factory()->initCode() }
+		, { "@@TERMINATEHOOKS@@"
+				, utils::StringUtils::addIndent(mCustomizer->factory()->terminateCode(), 1, indentString) }
+		, { "@@USERISRHOOKS@@"
+				, utils::StringUtils::addIndent(mCustomizer->factory()->isrHooksCode(), 1, indentString) }
+	};
+
 	const QString constantsString = mCustomizer->factory()->variables()->generateConstantsString();
 	const QString variablesString = mCustomizer->factory()->variables()->generateVariableString();
 
-	if (resultCode.contains("@@CONSTANTS@@")) {
-		replaceWithAutoIndent(resultCode, "@@CONSTANTS@@", constantsString);
-		replaceWithAutoIndent(resultCode, "@@VARIABLES@@", variablesString);
+	if (mainTemplate.contains("@@CONSTANTS@@")) {
+		code["@@CONSTANTS@@"] = constantsString;
+		code["@@VARIABLES@@"] = variablesString;
 	} else {
-		replaceWithAutoIndent(resultCode, "@@VARIABLES@@", constantsString + "\n" + variablesString);
+		code["@@VARIABLES@@"] = constantsString + "\n" + variablesString;
 	}
 
-	// This will remove too many empty lines
-	resultCode.replace(QRegExp("\n(\n)+"), "\n\n");
-
 	// This will remove leading and trailing whitespaces, line breaks and other unneeded stuff.
-	resultCode = resultCode.trimmed();
+	QString resultCode = fillMainTemplate(mainTemplate, code).trimmed();
 
 	processGeneratedCode(resultCode);
 
@@ -86,7 +86,8 @@ void Ev3KitInterpreterPlugin::init(const kitBase::KitPluginConfigurator &configu
 			, interpretersInterface
 			, configurator.qRealConfigurator().mainWindowDockInterface()
 			, configurator.qRealConfigurator().projectManager()
-			, configurator.interpreterControl());
+			, configurator.interpreterControl()
+			, configurator.headless());
 }
 
 void Ev3KitInterpreterPlugin::release()
@@ -14,9 +14,12 @@
 
 #pragma once
 
+#include <functional>
+
 #include <QtCore/QTimer>
 #include <QtCore/QObject>
 #include <QtCore/QScopedPointer>
+#include <QtCore/QSet>
 
 #include <kitBase/robotModel/robotModelManagerInterface.h>
 
@@ -31,6 +34,8 @@ namespace interpreter {
 namespace details {
 
 /// Keeps sensor variables available from math expressions in a program up to date, by querying robot model.
+/// Only sensors whose variables are demanded are polled: the ones mentioned in the program, referenced by code
+/// parsed by text language toolbox during the interpretation or watched by user.
 /// Expects that model does not change and sensors are not reconfigured when updating is active.
 class SensorVariablesUpdater : public QObject
 {
@@ -49,6 +54,14 @@ public:
 	/// Stops background polling process.
 	void suspend();
 
+	/// Sets a function that returns all identifiers mentioned in the program that is going to be interpreted.
+	/// It is called each time when polling starts. Without it only variables referenced by parsed code are polled.
+	void setProgramIdentifiersProvider(const std::function<QSet<QString>()> &provider);
+
+	/// Sets sensor variables that must be polled even if the program does not use them, for example the ones
+	/// shown to user by watchers.
+	void setWatchedVariables(const QStringList &variables);
+
 public slots:
 	/// Starts background polling process.
 	void run();
@@ -62,6 +75,9 @@ private slots:
 private:
 	int updateInterval() const;
 
+	/// Requests new values of sensors whose variables are demanded by someone.
+	void updateSensorsValues();
+
 	void updateScalarSensorVariables(const kitBase::robotModel::PortInfo &sensorPortInfo, int reading);
 	void updateScalarSensorVariable(const QString &variable, int reading);
 
@@ -75,6 +91,12 @@ private:
 	QScopedPointer<utils::AbstractTimer> mUpdateTimer;
 	const kitBase::robotModel::RobotModelManagerInterface &mRobotModelManager;
 	qrtext::DebuggerInterface &mParser;
+	std::function<QSet<QString>()> mProgramIdentifiersProvider;
+	QSet<QString> mProgramIdentifiers;
+	QSet<QString> mWatchedVariables;
+
+	/// Ports of sensors that have reserved variables and are ready to be polled.
+	QList<kitBase::robotModel::PortInfo> mSensorPorts;
 };
 
 }
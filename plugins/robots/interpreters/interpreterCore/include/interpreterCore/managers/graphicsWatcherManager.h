@@ -40,6 +40,9 @@ public:
 	/// Returns the graphics watcher widget itself for placing it into dock. Takes ownership over result.
 	QWidget *widget();
 
+	/// Returns a list of sensor variables which are shown on graphs.
+	QStringList trackedVariables() const;
+
 public slots:
 	/// Starts graphics watcher`s job even if user stopped it himself.
 	void forceStart();
@@ -57,6 +60,7 @@ private:
 
 	QScopedPointer<utils::sensorsGraph::SensorsGraph> mWatcher;
 	RobotModelManager &mRobotManager;
+	QStringList mTrackedVariables;
 };
 
 }
@@ -49,7 +49,9 @@ class RobotsPluginFacade : public QObject
 	Q_OBJECT
 
 public:
-	RobotsPluginFacade();
+	/// @param headless If true then kit plugins will be initialized without user interface, for example
+	/// 2D model windows will not be created.
+	explicit RobotsPluginFacade(bool headless = false);
 	~RobotsPluginFacade() override;
 
 	/// Inits all sybsytems of robots plugin infrastructure that somehow depend from engine`s parts.
@@ -67,6 +69,9 @@ public:
 	/// Returns an object of the class responsible for managing robot's models.
 	RobotModelManager &robotModelManager();
 
+	/// Returns an object that provides access to all loaded kit plugins.
+	const KitPluginManager &kitPluginManager() const;
+
 	/// A convenience method that travels around all loaded kit plugins,
 	/// collects all non-empty default settings file paths and returns them.
 	QStringList defaultSettingsFiles() const;
@@ -122,6 +127,7 @@ private:
 	/// Page with plugin settings. Created here, but then ownership is passed to a caller of preferencesPage().
 	ui::RobotsSettingsPage *mRobotSettingsPage {};  // Does not have ownership
 
+	const bool mHeadless;
 	KitPluginManager mKitPluginManager;
 	RobotModelManager mRobotModelManager;
 	ActionsManager mActionsManager;
@@ -34,11 +34,23 @@ SensorVariablesUpdater::~SensorVariablesUpdater()
 {
 }
 
+void SensorVariablesUpdater::setProgramIdentifiersProvider(const std::function<QSet<QString>()> &provider)
+{
+	mProgramIdentifiersProvider = provider;
+}
+
+void SensorVariablesUpdater::setWatchedVariables(const QStringList &variables)
+{
+	mWatchedVariables = variables.toSet();
+}
+
 void SensorVariablesUpdater::run()
 {
 	mUpdateTimer.reset(mRobotModelManager.model().timeline().produceTimer());
 	connect(mUpdateTimer.data(), &utils::AbstractTimer::timeout, this, &SensorVariablesUpdater::onTimerTimeout);
 	resetVariables();
+	mSensorPorts.clear();
+	mProgramIdentifiers = mProgramIdentifiersProvider ? mProgramIdentifiersProvider() : QSet<QString>();
 
 	for (robotParts::Device * const device : mRobotModelManager.model().configuration().devices()) {
 		robotParts::ScalarSensor * const scalarSensor = dynamic_cast<robotParts::ScalarSensor *>(device);
@@ -67,6 +79,7 @@ void SensorVariablesUpdater::run()
 					, Qt::UniqueConnection
 					);
 
+			mSensorPorts << scalarSensor->port();
 			continue;
 		}
 
@@ -96,11 +109,12 @@ void SensorVariablesUpdater::run()
 					, Qt::UniqueConnection
 					);
 
+			mSensorPorts << vectorSensor->port();
 			continue;
 		}
 	}
 
-	mRobotModelManager.model().updateSensorsValues();
+	updateSensorsValues();
 
 	mUpdateTimer->start(updateInterval());
 }
@@ -136,11 +150,28 @@ void SensorVariablesUpdater::onVectorSensorResponse(const QVector<int> &reading)
 
 void SensorVariablesUpdater::onTimerTimeout()
 {
-	mRobotModelManager.model().updateSensorsValues();
+	updateSensorsValues();
 
 	mUpdateTimer->start(updateInterval());
 }
 
+void SensorVariablesUpdater::updateSensorsValues()
+{
+	// Sensor readings may be expensive (in 2D model they render a part of the scene or cast rays), so sensors
+	// that nobody reads are not polled at all. Robot model is asked even with empty list since it may know readers
+	// we do not, like 2D model constraints.
+	QList<PortInfo> ports;
+	for (const PortInfo &port : mSensorPorts) {
+		const QString &variable = port.reservedVariable();
+		if (mProgramIdentifiers.contains(variable) || mWatchedVariables.contains(variable)
+				|| mParser.isReferenced(variable)) {
+			ports << port;
+		}
+	}
+
+	mRobotModelManager.model().updateSensorsValuesOnPorts(ports);
+}
+
 int SensorVariablesUpdater::updateInterval() const
 {
 	return mRobotModelManager.model().updateIntervalForInterpretation();
@@ -38,6 +38,11 @@ QWidget *GraphicsWatcherManager::widget()
 	return mWatcher.data();
 }
 
+QStringList GraphicsWatcherManager::trackedVariables() const
+{
+	return mTrackedVariables;
+}
+
 void GraphicsWatcherManager::forceStart()
 {
 	mWatcher->startJob();
@@ -63,6 +68,7 @@ void GraphicsWatcherManager::onDeviceConfigurationChanged(const QString &robotId
 void GraphicsWatcherManager::updateSensorsList(const QString &currentRobotModel)
 {
 	mWatcher->clearTrackingObjects();
+	mTrackedVariables.clear();
 	int index = 0;
 	for (const PortInfo &port : configuredPorts(currentRobotModel)) {
 		const DeviceInfo device = currentConfiguration(currentRobotModel, port);
@@ -71,6 +77,7 @@ void GraphicsWatcherManager::updateSensorsList(const QString &currentRobotModel)
 		if (!device.isNull() && !variableName.isEmpty()) {
 			mWatcher->addTrackingObject(index, variableName, QString("%1: %2").arg(port.name()
 					, device.friendlyName()));
+			mTrackedVariables << variableName;
 			++index;
 		}
 	}
@@ -14,11 +14,14 @@
 
 #include "interpreterCore/robotsPluginFacade.h"
 
+#include <QtCore/QRegularExpression>
+
 #include <qrkernel/settingsManager.h>
 #include <qrkernel/platformInfo.h>
 #include <qrutils/widgets/consoleDock.h>
 #include <qrutils/outFile.h>
 #include <kitBase/robotModel/portInfo.h>
+#include <kitBase/robotModel/robotParts/device.h>
 #include <twoDModel/engine/twoDModelEngineInterface.h>
 #include <twoDModel/engine/twoDModelGuiFacade.h>
 #include <twoDModel/robotModel/twoDRobotModel.h>
@@ -35,8 +38,9 @@
 
 using namespace interpreterCore;
 
-RobotsPluginFacade::RobotsPluginFacade()
-	: mKitPluginManager(qReal::PlatformInfo::invariantSettingsPath("pathToToolPlugins") + "/kitPlugins")
+RobotsPluginFacade::RobotsPluginFacade(bool headless)
+	: mHeadless(headless)
+	, mKitPluginManager(qReal::PlatformInfo::invariantSettingsPath("pathToToolPlugins") + "/kitPlugins")
 	, mActionsManager(mKitPluginManager, mRobotModelManager)
 	, mDockDevicesConfigurer(nullptr)
 	, mGraphicsWatcherManager(nullptr)
@@ -117,6 +121,31 @@ void RobotsPluginFacade::init(const qReal::PluginConfigurator &configurer)
 	mSensorVariablesUpdater.reset(
 		new interpreterCore::interpreter::details::SensorVariablesUpdater(mRobotModelManager, *mParser));
 
+	// Sensor variables that are mentioned nowhere in the program do not need to be polled.
+	const qrRepo::LogicalRepoApi &logicalRepoApi = configurer.logicalModelApi().logicalRepoApi();
+	mSensorVariablesUpdater->setProgramIdentifiersProvider([&logicalRepoApi]() {
+		const QRegularExpression identifierRegExp("[A-Za-z_][A-Za-z0-9_]*");
+		QSet<QString> identifiers;
+		qReal::IdList elements = logicalRepoApi.children(qReal::Id::rootId());
+		while (!elements.isEmpty()) {
+			const qReal::Id element = elements.takeLast();
+			elements << logicalRepoApi.children(element);
+			QMapIterator<QString, QVariant> properties = logicalRepoApi.propertiesIterator(element);
+			while (properties.hasNext()) {
+				if (properties.next().value().type() != QVariant::String) {
+					continue;
+				}
+
+				auto matches = identifierRegExp.globalMatch(properties.value().toString());
+				while (matches.hasNext()) {
+					identifiers << matches.next().captured();
+				}
+			}
+		}
+
+		return identifiers;
+	});
+
 	connect(&mRobotModelManager, &RobotModelManager::allDevicesConfigured,
 			mSensorVariablesUpdater.data(), &interpreter::details::SensorVariablesUpdater::run);
 
@@ -264,6 +293,11 @@ RobotModelManager &RobotsPluginFacade::robotModelManager()
 	return mRobotModelManager;
 }
 
+const KitPluginManager &RobotsPluginFacade::kitPluginManager() const
+{
+	return mKitPluginManager;
+}
+
 QObject *RobotsPluginFacade::guiScriptFacade() const
 {
 	const auto robotModel = dynamic_cast<twoDModel::robotModel::TwoDRobotModel *>(&mRobotModelManager.model());
@@ -391,6 +425,22 @@ void RobotsPluginFacade::initSensorWidgets()
 	connect(&mProxyInterpreter, &kitBase::InterpreterInterface::stopped
 			, &*mGraphicsWatcherManager, &GraphicsWatcherManager::forceStop);
 	connect(&mProxyInterpreter, &kitBase::InterpreterInterface::started, &*mGraphicsWatcherManager, [=]() {
+		// Sensors shown on graphs or in the watch window shall be polled even if the program does not read them.
+		QStringList watchedVariables = mGraphicsWatcherManager->widget()->isVisible()
+				? mGraphicsWatcherManager->trackedVariables() : QStringList();
+		if (mWatchListWindow->isVisible()) {
+			const QStringList hiddenVariables = mParser->hiddenVariables()
+					+ qReal::SettingsManager::value("HiddenVariables").toStringList();
+			for (const kitBase::robotModel::robotParts::Device *device
+					: mRobotModelManager.model().configuration().devices()) {
+				const QString &variable = device->port().reservedVariable();
+				if (!variable.isEmpty() && !hiddenVariables.contains(variable)) {
+					watchedVariables << variable;
+				}
+			}
+		}
+
+		mSensorVariablesUpdater->setWatchedVariables(watchedVariables);
 		mActionsManager.runAction().setVisible(false);
 		mActionsManager.stopRobotAction().setVisible(mRobotModelManager.model().interpretedModel());
 	});
@@ -430,7 +480,7 @@ void RobotsPluginFacade::initKitPlugins(const qReal::PluginConfigurator &configu
 	for (const QString &kitId : mKitPluginManager.kitIds()) {
 		for (kitBase::KitPluginInterface * const kit : mKitPluginManager.kitsById(kitId)) {
 			kit->init(kitBase::KitPluginConfigurator(configurer
-					, mRobotModelManager, *mParser, mEventsForKitPlugin, mProxyInterpreter));
+					, mRobotModelManager, *mParser, mEventsForKitPlugin, mProxyInterpreter, mHeadless));
 
 			for (const kitBase::robotModel::RobotModelInterface *model : kit->robotModels()) {
 				initFactoriesFor(kitId, model, configurer);
@@ -122,6 +122,7 @@ void RobotsSettingsPage::save()
 	SettingsManager::setValue("sensorUpdateInterval", mUi->sensorUpdateSpinBox->value());
 	SettingsManager::setValue("autoscalingInterval", mUi->autoScalingSpinBox->value());
 	SettingsManager::setValue("textUpdateInterval", mUi->textUpdaterSpinBox->value());
+	SettingsManager::setValue("interpreterFastMode", mUi->fastInterpretationCheckBox->isChecked());
 	if (mRobotModelManager.model().kitId().contains("nxt", Qt::CaseInsensitive)) {
 		SettingsManager::setValue("nxtFlashToolRunPolicy", mUi->runningAfterUploadingComboBox->currentIndex());
 	} else if (mRobotModelManager.model().kitId().contains("ev3", Qt::CaseInsensitive)) {
@@ -164,6 +165,7 @@ void RobotsSettingsPage::restoreSettings()
 	mUi->sensorUpdateSpinBox->setValue(SettingsManager::value("sensorUpdateInterval", sensorsUpdateDefault).toInt());
 	mUi->autoScalingSpinBox->setValue(SettingsManager::value("autoscalingInterval", autoscalingDefault).toInt());
 	mUi->textUpdaterSpinBox->setValue(SettingsManager::value("textUpdateInterval", textUpdateDefault).toInt());
+	mUi->fastInterpretationCheckBox->setChecked(SettingsManager::value("interpreterFastMode").toBool());
 
 	if (mRobotModelManager.model().kitId().contains("nxt", Qt::CaseInsensitive)) {
 		mUi->runningAfterUploadingComboBox->setCurrentIndex(SettingsManager::value("nxtFlashToolRunPolicy").toInt());
@@ -85,7 +85,8 @@ void NxtKitInterpreterPlugin::init(const kitBase::KitPluginConfigurator &configu
 			, interpretersInterface
 			, configurator.qRealConfigurator().mainWindowDockInterface()
 			, configurator.qRealConfigurator().projectManager()
-			, configurator.interpreterControl());
+			, configurator.interpreterControl()
+			, configurator.headless());
 }
 
 void NxtKitInterpreterPlugin::release()
@@ -46,7 +46,9 @@ void Shell::say(const QString &text)
 {
 	mLastPhrase = text;
 	if (mErrorReporter) {
-		mErrorReporter->sendBubblingMessage(text, 8000, mEngine.guiFacade().twoDModelSceneViewport()->parentWidget());
+		// There is no scene to show the message over when 2D model works in headless mode.
+		QWidget * const viewport = mEngine.guiFacade().twoDModelSceneViewport();
+		mErrorReporter->sendBubblingMessage(text, 8000, viewport ? viewport->parentWidget() : nullptr);
 	}
 
 	emit phraseTold(text);
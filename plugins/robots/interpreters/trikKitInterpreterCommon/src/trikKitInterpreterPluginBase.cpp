@@ -59,8 +59,6 @@ void TrikKitInterpreterPluginBase::initKitInterpreterPluginBase
 	mTwoDModel.reset(modelEngine);
 	mTwoDRobotModel->setEngine(modelEngine->engine());
 
-	connectDevicesConfigurationProvider(devicesConfigurationProvider()); // ... =(
-
 	mAdditionalPreferences = new TrikAdditionalPreferences({ mRealRobotModel->name() });
 
 	bool enablePython = false;
@@ -251,7 +249,11 @@ void TrikKitInterpreterPluginBase::init(const kitBase::KitPluginConfigurator &co
 			, interpretersInterface
 			, configurer.qRealConfigurator().mainWindowDockInterface()
 			, configurer.qRealConfigurator().projectManager()
-			, configurer.interpreterControl());
+			, configurer.interpreterControl()
+			, configurer.headless());
+
+	// 2D model window that provides devices configuration is created in init() of 2D model.
+	connectDevicesConfigurationProvider(devicesConfigurationProvider()); // ... =(
 
 	mRealRobotModel->setErrorReporter(*interpretersInterface.errorReporter());
 	mTwoDRobotModel->setErrorReporter(*interpretersInterface.errorReporter());
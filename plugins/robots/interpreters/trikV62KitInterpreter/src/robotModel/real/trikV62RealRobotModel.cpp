@@ -79,6 +79,13 @@ void RealRobotModel::updateSensorsValues() const
 	mRobotCommunicator.data()->requestData();
 }
 
+void RealRobotModel::updateSensorsValuesOnPorts(const QList<PortInfo> &ports) const
+{
+	Q_UNUSED(ports)
+	// All sensors are obtained from the robot by one request.
+	updateSensorsValues();
+}
+
 bool RealRobotModel::needsConnection() const
 {
 	return true;
@@ -79,6 +79,13 @@ void TrikV6RealRobotModel::updateSensorsValues() const
 	mRobotCommunicator.data()->requestData();
 }
 
+void TrikV6RealRobotModel::updateSensorsValuesOnPorts(const QList<PortInfo> &ports) const
+{
+	Q_UNUSED(ports)
+	// All sensors are obtained from the robot by one request.
+	updateSensorsValues();
+}
+
 bool TrikV6RealRobotModel::needsConnection() const
 {
 	return true;
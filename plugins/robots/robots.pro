@@ -28,4 +28,4 @@ utils.depends = thirdparty
 common.depends = thirdparty utils
 interpreters.depends = common thirdparty utils
 generators.depends = common utils
-checker.depends = interpreters
+checker.depends = interpreters generators
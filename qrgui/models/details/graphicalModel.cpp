@@ -48,6 +48,8 @@ void GraphicalModel::setAssistApi(GraphicalModelAssistApi * const graphicalAssis
 void GraphicalModel::init()
 {
 	mModelItems.insert(Id::rootId(), mRootItem);
+	mItemsByLogicalId.clear();
+	addToLogicalIdIndex(mRootItem);
 	mApi.setName(Id::rootId(), Id::rootId().toString());
 	// Turn off view notification while loading. Model can be inconsistent during a process,
 	// so views shall not update themselves before time. It is important for
@@ -89,6 +91,7 @@ GraphicalModelItem *GraphicalModel::loadElement(GraphicalModelItem *parentItem,
 	GraphicalModelItem *item = new GraphicalModelItem(id, logicalId, parentItem);
 	parentItem->addChild(item);
 	mModelItems.insert(id, item);
+	addToLogicalIdIndex(item);
 	endInsertRows();
 
 	return item;
@@ -106,12 +109,9 @@ AbstractModelItem *GraphicalModel::createModelItem(const Id &id, AbstractModelIt
 
 void GraphicalModel::updateElements(const Id &logicalId, const QString &name)
 {
-	for (AbstractModelItem *item :  mModelItems.values()) {
-		GraphicalModelItem *graphicalItem = static_cast<GraphicalModelItem *>(item);
-		if (graphicalItem->logicalId() == logicalId) {
-			setNewName(graphicalItem->id(), name);
-			emit dataChanged(index(graphicalItem), index(graphicalItem));
-		}
+	for (GraphicalModelItem * const graphicalItem : mItemsByLogicalId.values(logicalId)) {
+		setNewName(graphicalItem->id(), name);
+		emit dataChanged(index(graphicalItem), index(graphicalItem));
 	}
 }
 
@@ -236,6 +236,19 @@ void GraphicalModel::initializeElement(const ElementInfo &elementInfo
 	}
 
 	mModelItems.insert(elementInfo.id(), item);
+	addToLogicalIdIndex(item);
+}
+
+void GraphicalModel::addToLogicalIdIndex(AbstractModelItem *item)
+{
+	GraphicalModelItem * const graphicalItem = static_cast<GraphicalModelItem *>(item);
+	mItemsByLogicalId.insert(graphicalItem->logicalId(), graphicalItem);
+}
+
+void GraphicalModel::removeFromLogicalIdIndex(AbstractModelItem *item)
+{
+	GraphicalModelItem * const graphicalItem = static_cast<GraphicalModelItem *>(item);
+	mItemsByLogicalId.remove(graphicalItem->logicalId(), graphicalItem);
 }
 
 QVariant GraphicalModel::data(const QModelIndex &index, int role) const
@@ -406,6 +419,7 @@ bool GraphicalModel::removeRows(int row, int count, const QModelIndex &parent)
 			beginRemoveRows(parent, childRow, childRow);
 			child->parent()->removeChild(child);
 			mModelItems.remove(child->id());
+			removeFromLogicalIdIndex(child);
 			mApi.removeChild(parentItem->id(), child->id());
 			mApi.removeElement(child->id());
 			delete child;
@@ -418,6 +432,7 @@ bool GraphicalModel::removeRows(int row, int count, const QModelIndex &parent)
 void GraphicalModel::removeModelItemFromApi(details::modelsImplementation::AbstractModelItem *const root
 		, details::modelsImplementation::AbstractModelItem *child)
 {
+	removeFromLogicalIdIndex(child);
 	mApi.removeProperty(child->id(), "position");
 	mApi.removeProperty(child->id(), "configuration");
 	if (mModelItems.count(child->id()) == 0) {
@@ -429,10 +444,10 @@ void GraphicalModel::removeModelItemFromApi(details::modelsImplementation::Abstr
 QList<QPersistentModelIndex> GraphicalModel::indexesWithLogicalId(const Id &logicalId) const
 {
 	QList<QPersistentModelIndex> indexes;
-	for (AbstractModelItem *item : mModelItems.values()) {
-		if (static_cast<GraphicalModelItem *>(item)->logicalId() == logicalId)
-			indexes.append(index(item));
+	for (GraphicalModelItem * const item : mItemsByLogicalId.values(logicalId)) {
+		indexes.append(index(item));
 	}
+
 	return indexes;
 }
 
@@ -67,6 +67,9 @@ private:
 	qrRepo::GraphicalRepoApi &mApi;
 	GraphicalModelAssistApi *mGraphicalAssistApi;  // Has ownership.
 
+	/// Graphical items by ids of logical elements they depict, contains the same items as mModelItems.
+	QMultiHash<Id, modelsImplementation::GraphicalModelItem *> mItemsByLogicalId;
+
 	virtual void init() override;
 	void loadSubtreeFromClient(modelsImplementation::GraphicalModelItem * const parent);
 	modelsImplementation::GraphicalModelItem *loadElement(modelsImplementation::GraphicalModelItem *parentItem
@@ -76,6 +79,11 @@ private:
 	virtual modelsImplementation::AbstractModelItem *createModelItem(const Id &id
 			, modelsImplementation::AbstractModelItem *parentItem) const override;
 	void addTree(const Id &parent, const QMultiMap<Id, ElementInfo *> &childrenOfParents, QSet<Id> &visited);
+
+	/// Registers or unregisters given item in a logical ids index.
+	void addToLogicalIdIndex(modelsImplementation::AbstractModelItem *item);
+	void removeFromLogicalIdIndex(modelsImplementation::AbstractModelItem *item);
+
 	/// Adds entries to row model without inserting rows and notifying about that connected views.
 	/// @returns created model item.
 	modelsImplementation::AbstractModelItem *createElementWithoutCommit(ElementInfo &elementInfo
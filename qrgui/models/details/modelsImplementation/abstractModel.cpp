@@ -100,19 +100,12 @@ QModelIndex AbstractModel::parent(const QModelIndex &index) const
 
 QModelIndex AbstractModel::index(const AbstractModelItem * const item) const
 {
-	QList<int> rowCoords;
-
-	for (const AbstractModelItem *curItem = item; curItem != mRootItem; curItem = curItem->parent()) {
-		rowCoords.append(curItem->row());
-	}
-
-	QModelIndex result;
-
-	for (int i = rowCoords.size() - 1; i >= 0; --i) {
-		result = index(rowCoords[i], 0, result);
+	if (item == mRootItem) {
+		return QModelIndex();
 	}
 
-	return result;
+	// Index of an item is determined by its row and item itself, so there is no need to walk the path from root.
+	return createIndex(item->row(), 0, const_cast<AbstractModelItem *>(item));
 }
 
 QString AbstractModel::findPropertyName(const Id &id, const int role) const
@@ -154,8 +147,8 @@ QModelIndex AbstractModel::indexById(const Id &id) const
 
 Id AbstractModel::idByIndex(const QModelIndex &index) const
 {
-	AbstractModelItem *item = static_cast<AbstractModelItem*>(index.internalPointer());
-	return mModelItems.key(item);
+	const AbstractModelItem *item = static_cast<AbstractModelItem*>(index.internalPointer());
+	return item ? item->id() : Id();
 }
 
 Id AbstractModel::rootId() const
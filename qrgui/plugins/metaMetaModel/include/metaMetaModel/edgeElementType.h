@@ -72,11 +72,27 @@ public:
 	/// Sets the default type of this edges`s shape. This shape usually can then be changed by user.
 	void setShapeType(LinkShape shape);
 
+	/// Returns the style of the arrow at the beginning of this edge as it is named in metamodel
+	/// (for example "open_arrow" or "filled_rhomb"). Empty string means no arrow.
+	const QString &startArrowStyle() const;
+
+	/// Sets the style of the arrow at the beginning of this edge as it is named in metamodel.
+	void setStartArrowStyle(const QString &style);
+
+	/// Returns the style of the arrow at the end of this edge as it is named in metamodel
+	/// (for example "open_arrow" or "filled_rhomb"). Empty string means no arrow.
+	const QString &endArrowStyle() const;
+
+	/// Sets the style of the arrow at the end of this edge as it is named in metamodel.
+	void setEndArrowStyle(const QString &style);
+
 	/// Draws with a \painter the arrow from a begin. The arrow type is specified in a metamodel.
+	/// Default implementation draws the arrow of startArrowStyle().
 	/// @todo: This should be a part of an engine!
 	virtual void drawStartArrow(QPainter *painter) const;
 
 	/// Draws with a \painter the arrow from a begin. The arrow type is specified in a metamodel.
+	/// Default implementation draws the arrow of endArrowStyle().
 	/// @todo: This should be a part of an engine!
 	virtual void drawEndArrow(QPainter *painter) const;
 
@@ -90,6 +106,8 @@ private:
 	QStringList mFromPortTypes;
 	QStringList mToPortTypes;
 	LinkShape mShapeType;
+	QString mStartArrowStyle;
+	QString mEndArrowStyle;
 };
 
 }
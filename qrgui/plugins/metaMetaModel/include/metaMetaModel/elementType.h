@@ -35,6 +35,10 @@ class PatternType;
 /// (for example relation of generalization, relation of explosion, relation of containment, etc).
 /// Metamodel thus is ordered multigraph where nodes are types of elements.
 /// This fact is noted with inheriting ElementType from qrgraph::Node.
+///
+/// Type descriptors are lightweight when created: only names of type and its diagram, friendly name and
+/// description are assigned in constructor. Everything else (appearance, labels, ports, properties) is filled
+/// in initialize() that is called on first access to such data, so types that are never used cost nothing.
 class QRGUI_META_META_MODEL_EXPORT ElementType : public qrgraph::Node
 {
 public:
@@ -180,10 +184,21 @@ public:
 	/// Removes or restores this element from metamodel.
 	void setHidden(bool isHidden);
 
+	/// Returns true if initialize() was already called, i.e. the data of this type was needed by someone.
+	bool isInitialized() const;
+
 protected:
 	/// @param metamodel Metamodel that owns this element.
 	explicit ElementType(Metamodel &metamodel);
 
+	/// Can be overridden to fill the data of this type that is not needed until the type is used:
+	/// appearance, labels, ports, properties and so on. Will be called once before first access to such data.
+	/// Default implementation does nothing.
+	virtual void initialize();
+
+	/// Calls initialize() if it was not called yet. Must be called by all accessors to data filled in initialize().
+	void ensureInitialized() const;
+
 private:
 	QString mName;
 	QString mFriendlyName;
@@ -199,6 +214,7 @@ private:
 	QMap<QString, QString> mPropertyDescriptions;
 	QMap<QString, QString> mPropertyDisplayedNames;
 	bool mIsHidden;
+	mutable bool mInitialized;
 };
 
 }
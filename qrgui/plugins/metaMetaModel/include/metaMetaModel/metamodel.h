@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <QtCore/QHash>
 #include <QtCore/QtPlugin>
 #include <QtGui/QIcon>
 
@@ -56,10 +57,13 @@ public:
 	/// Appends \a diagramName to a list of diagrams identifiers.
 	void addDiagram(const QString &diagramName);
 
-	/// Returns a list of type descriptors of elements belonging to \a diagram. If metamodel does not contain
-	/// \a diagram empty list will be returned.
+	/// Returns a list of type descriptors of elements belonging to \a diagram sorted by their names.
+	/// If metamodel does not contain \a diagram empty list will be returned.
 	QList<ElementType *> elements(const QString &diagram) const;
 
+	/// Returns true if this metamodel contains \a element in \a diagram.
+	bool hasElement(const QString &diagram, const QString &element) const;
+
 	/// Can be called to append new entity into this metamodel.
 	/// @note Metamodel will take ownership on \a entity.
 	void addNode(qrgraph::Node *entity) override;
@@ -158,7 +162,10 @@ private:
 	QString mVersion;
 	QStringList mDiagrams;
 	QString mFriendlyName;
-	QMap<QString, QMap<QString, ElementType *>> mElements;
+	/// Type descriptors of elements of each diagram sorted by names.
+	QHash<QString, QList<ElementType *>> mElements;
+	/// Maps diagram names and element names to type descriptors for fast lookup.
+	QHash<QString, QHash<QString, ElementType *>> mElementsIndex;
 	QMap<QString, QList<QPair<QString, QString>>> mEnumValues;
 	QMap<QString, QString> mEnumDisplayedNames;
 	QMap<QString, bool> mEnumsEditability;
@@ -14,12 +14,129 @@
 
 #include "metaMetaModel/edgeElementType.h"
 
+#include <QtGui/QPainter>
 #include <QtXml/QDomDocument>
 
 #include "metaMetaModel/metamodel.h"
 
 using namespace qReal;
 
+/// Draws an arrow of the given style (as it is named in metamodels) pointing up to (0, 0) with \a painter.
+static void drawArrow(QPainter *painter, const QString &style)
+{
+	static const QStringList bpmnStyles = {"signal", "timer", "message", "error", "escalation", "cancel"
+			, "compensation", "conditional", "multiple", "parallel_multiple", "message_noninterrupting"
+			, "timer_noninterrupting", "escalation_noninterrupting", "conditional_noninterrupting"
+			, "signal_noninterrupting", "multiple_noninterrupting", "parallel_multiple_noninterrupting"};
+
+	if (style.isEmpty()) {
+		return;
+	}
+
+	const QBrush old = painter->brush();
+	QBrush brush;
+	brush.setStyle(Qt::SolidPattern);
+	if (style == "empty_arrow" || style == "empty_rhomb" || style == "complex_arrow" || style == "empty_circle"
+			|| bpmnStyles.contains(style)) {
+		brush.setColor(Qt::white);
+	}
+
+	if (style == "filled_arrow" || style == "filled_rhomb") {
+		brush.setColor(Qt::black);
+	}
+
+	painter->setBrush(brush);
+
+	if (style == "empty_arrow" || style == "filled_arrow") {
+		static const QPointF points[] = {QPointF(0, 0), QPointF(-5, 10), QPointF(5, 10)};
+		painter->drawPolygon(points, 3);
+	} else if (style == "empty_rhomb" || style == "filled_rhomb") {
+		static const QPointF points[] = {QPointF(0, 0), QPointF(-5, 10), QPointF(0, 20), QPointF(5, 10)};
+		painter->drawPolygon(points, 4);
+	} else if (style == "open_arrow") {
+		static const QPointF points[] = {QPointF(-5, 10), QPointF(0, 0), QPointF(5, 10)};
+		painter->drawPolyline(points, 3);
+	} else if (style == "complex_arrow") {
+		static const QPointF points[] = {QPointF(-15, 30), QPointF(-10, 10), QPointF(0, 0), QPointF(10, 10)
+				, QPointF(15, 30), QPointF(0, 23), QPointF(-15, 30)};
+		painter->drawPolyline(points, 7);
+	} else if (style == "crossed_line") {
+		const QPen oldPen = painter->pen();
+		QPen newPen = oldPen;
+		newPen.setWidth(2);
+		painter->setPen(newPen);
+		painter->drawLine(5, 5, -5, 15);
+		painter->setPen(oldPen);
+	} else if (style == "empty_circle") {
+		painter->drawEllipse(-5, 0, 10, 10);
+	} else if (bpmnStyles.contains(style)) {
+		painter->save();
+		QString event = style;
+		if (event.endsWith("_noninterrupting")) {
+			QPen dashPen = painter->pen();
+			dashPen.setStyle(Qt::DashLine);
+			painter->setPen(dashPen);
+			event.chop(QString("_noninterrupting").length());
+		}
+
+		painter->drawEllipse(-20, 0, 40, 40);
+		painter->drawEllipse(-15, 5, 30, 30);
+
+		QPen solidPen = painter->pen();
+		solidPen.setStyle(Qt::SolidLine);
+		painter->setPen(solidPen);
+
+		if (event == "signal") {
+			static const QPointF points[] = {QPointF(0, 10), QPointF(-10, 27), QPointF(10, 27), QPointF(0, 10)};
+			painter->drawPolyline(points, 4);
+		} else if (event == "timer") {
+			painter->drawEllipse(-10, 10, 20, 20);
+			painter->drawLine(0, 20, 0, 15);
+			painter->drawLine(0, 20, 10, 20);
+		} else if (event == "message") {
+			painter->drawRect(-10, 15, 20, 11);
+			painter->drawLine(-9, 16, -1, 19);
+			painter->drawLine(9, 16, 1, 19);
+		} else if (event == "error") {
+			static const QPointF points[] = {QPointF(-10, 28), QPointF(-4, 10), QPointF(3, 20), QPointF(10, 12)
+					, QPointF(4, 30), QPointF(-3, 20), QPointF(-10, 28)};
+			painter->drawPolyline(points, 7);
+		} else if (event == "escalation") {
+			static const QPointF points[] = {QPointF(0, 22), QPointF(-6, 30), QPointF(0, 10), QPointF(6, 30)
+					, QPointF(0, 22)};
+			painter->drawPolyline(points, 5);
+		} else if (event == "cancel") {
+			static const QPointF points[] = {QPointF(-12, 12), QPointF(-8, 8), QPointF(0, 17), QPointF(8, 8)
+					, QPointF(12, 12), QPointF(3, 20), QPointF(12, 28), QPointF(8, 32), QPointF(0, 23)
+					, QPointF(-8, 32), QPointF(-12, 28), QPointF(-3, 20), QPointF(-12, 12)};
+			painter->drawPolyline(points, 13);
+		} else if (event == "compensation") {
+			static const QPointF points1[] = {QPointF(-12, 20), QPointF(-2, 10), QPointF(-2, 30), QPointF(-12, 20)};
+			painter->drawPolyline(points1, 4);
+			static const QPointF points2[] = {QPointF(-2, 20), QPointF(8, 10), QPointF(8, 30), QPointF(-2, 20)};
+			painter->drawPolyline(points2, 4);
+		} else if (event == "conditional") {
+			painter->drawRect(-8, 10, 16, 20);
+			painter->drawLine(-6, 14, 6, 14);
+			painter->drawLine(-6, 20, 6, 20);
+			painter->drawLine(-6, 26, 6, 26);
+		} else if (event == "multiple") {
+			static const QPointF points[] = {QPointF(0, 11), QPointF(10, 17), QPointF(7, 29), QPointF(-7, 29)
+					, QPointF(-10, 17), QPointF(0, 11)};
+			painter->drawPolyline(points, 6);
+		} else if (event == "parallel_multiple") {
+			static const QPointF points[] = {QPointF(-12, 17), QPointF(-3, 17), QPointF(-3, 8), QPointF(3, 8)
+					, QPointF(3, 17), QPointF(12, 17), QPointF(12, 23), QPointF(3, 23), QPointF(3, 32)
+					, QPointF(-3, 32), QPointF(-3, 23), QPointF(-12, 23), QPointF(-12, 17)};
+			painter->drawPolyline(points, 13);
+		}
+
+		painter->restore();
+	}
+
+	painter->setBrush(old);
+}
+
 EdgeElementType::EdgeElementType(Metamodel &metamodel)
 	: ElementType(metamodel)
 	, mPenStyle(Qt::NoPen)
@@ -36,84 +153,122 @@ ElementType::Type EdgeElementType::type() const
 
 Qt::PenStyle EdgeElementType::penStyle() const
 {
+	ensureInitialized();
 	return mPenStyle;
 }
 
 void EdgeElementType::setPenStyle(Qt::PenStyle style)
 {
+	ensureInitialized();
 	mPenStyle = style;
 	updateSdf();
 }
 
 int EdgeElementType::penWidth() const
 {
+	ensureInitialized();
 	return mPenWidth;
 }
 
 void EdgeElementType::setPenWidth(int width)
 {
+	ensureInitialized();
 	mPenWidth = width;
 }
 
 QColor EdgeElementType::penColor() const
 {
+	ensureInitialized();
 	return mPenColor;
 }
 
 void EdgeElementType::setPenColor(const QColor &color)
 {
+	ensureInitialized();
 	mPenColor = color;
 	updateSdf();
 }
 
 bool EdgeElementType::isDividable() const
 {
+	ensureInitialized();
 	return mIsDividable;
 }
 
 void EdgeElementType::setDividable(bool isDividable)
 {
+	ensureInitialized();
 	mIsDividable = isDividable;
 }
 
 const QStringList &EdgeElementType::fromPortTypes() const
 {
+	ensureInitialized();
 	return mFromPortTypes;
 }
 
 void EdgeElementType::setFromPortTypes(const QStringList &portTypes)
 {
+	ensureInitialized();
 	mFromPortTypes = portTypes;
 }
 
 const QStringList &EdgeElementType::toPortTypes() const
 {
+	ensureInitialized();
 	return mToPortTypes;
 }
 
 void EdgeElementType::setToPortTypes(const QStringList &portTypes)
 {
+	ensureInitialized();
 	mToPortTypes = portTypes;
 }
 
 LinkShape EdgeElementType::shapeType() const
 {
+	ensureInitialized();
 	return mShapeType;
 }
 
 void EdgeElementType::setShapeType(LinkShape shape)
 {
+	ensureInitialized();
 	mShapeType = shape;
 }
 
+const QString &EdgeElementType::startArrowStyle() const
+{
+	ensureInitialized();
+	return mStartArrowStyle;
+}
+
+void EdgeElementType::setStartArrowStyle(const QString &style)
+{
+	ensureInitialized();
+	mStartArrowStyle = style;
+}
+
+const QString &EdgeElementType::endArrowStyle() const
+{
+	ensureInitialized();
+	return mEndArrowStyle;
+}
+
+void EdgeElementType::setEndArrowStyle(const QString &style)
+{
+	ensureInitialized();
+	mEndArrowStyle = style;
+}
+
 void EdgeElementType::drawStartArrow(QPainter *painter) const
 {
-	Q_UNUSED(painter)
+	drawArrow(painter, startArrowStyle());
 }
 
 void EdgeElementType::drawEndArrow(QPainter *painter) const
 {
-	Q_UNUSED(painter)
+	drawArrow(painter, endArrowStyle());
 }
 
 void EdgeElementType::updateSdf()
@@ -29,6 +29,7 @@ ElementType::ElementType(Metamodel &metamodel)
 	: qrgraph::Node(metamodel)
 	, mSdf(new QDomDocument)
 	, mIsHidden(false)
+	, mInitialized(false)
 {
 }
 
@@ -170,11 +171,13 @@ void ElementType::setDiagram(const QString &diagramName)
 
 QDomElement ElementType::sdf() const
 {
+	ensureInitialized();
 	return mSdf->isNull() ? QDomElement() : mSdf->documentElement();
 }
 
 void ElementType::loadSdf(const QDomElement &picture)
 {
+	ensureInitialized();
 	if (mSdf->isNull()) {
 		mSdf->appendChild(mSdf->importNode(picture, true));
 		return;
@@ -188,47 +191,56 @@ void ElementType::loadSdf(const QDomElement &picture)
 
 const QList<QSharedPointer<LabelProperties>> &ElementType::labels() const
 {
+	ensureInitialized();
 	return mLabels;
 }
 
 void ElementType::addLabel(const QSharedPointer<LabelProperties> &label)
 {
+	ensureInitialized();
 	mLabels << label;
 }
 
 const QStringList &ElementType::propertyNames() const
 {
+	ensureInitialized();
 	return mPropertyNames;
 }
 
 const QStringList &ElementType::referenceProperties() const
 {
+	ensureInitialized();
 	return mReferenceProperties;
 }
 
 QString ElementType::propertyType(const QString &name) const
 {
+	ensureInitialized();
 	return mPropertyTypes[name];
 }
 
 QString ElementType::propertyDefaultValue(const QString &property) const
 {
+	ensureInitialized();
 	return mPropertyDefaultValues[property];
 }
 
 QString ElementType::propertyDescription(const QString &property) const
 {
+	ensureInitialized();
 	return mPropertyDescriptions[property];
 }
 
 QString ElementType::propertyDisplayedName(const QString &property) const
 {
+	ensureInitialized();
 	return mPropertyDisplayedNames[property];
 }
 
 void ElementType::addProperty(const QString &name, const QString &type, const QString &defaultValue
 		, const QString &displayedName, const QString &description, bool isReference)
 {
+	ensureInitialized();
 	if (!mPropertyNames.contains(name)) {
 		mPropertyNames << name;
 	}
@@ -252,3 +264,21 @@ void ElementType::setHidden(bool isHidden)
 {
 	mIsHidden = isHidden;
 }
+
+bool ElementType::isInitialized() const
+{
+	return mInitialized;
+}
+
+void ElementType::initialize()
+{
+}
+
+void ElementType::ensureInitialized() const
+{
+	if (!mInitialized) {
+		// The flag is raised before initialization since initialize() fills the data using the same accessors.
+		mInitialized = true;
+		const_cast<ElementType *>(this)->initialize();
+	}
+}
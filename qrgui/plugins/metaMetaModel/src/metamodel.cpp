@@ -13,6 +13,9 @@
  * limitations under the License. */
 
 #include "metaMetaModel/metamodel.h"
+
+#include <algorithm>
+
 #include <qrkernel/exception/exception.h>
 
 using namespace qReal;
@@ -60,7 +63,13 @@ void Metamodel::addDiagram(const QString &diagramName)
 
 QList<ElementType *> Metamodel::elements(const QString &diagram) const
 {
-	return mElements[diagram].values();
+	return mElements.value(diagram);
+}
+
+bool Metamodel::hasElement(const QString &diagram, const QString &element) const
+{
+	const auto diagramElements = mElementsIndex.constFind(diagram);
+	return diagramElements != mElementsIndex.constEnd() && diagramElements->contains(element);
 }
 
 ElementType &Metamodel::elementType(const Id &id) const
@@ -70,10 +79,16 @@ ElementType &Metamodel::elementType(const Id &id) const
 
 ElementType &Metamodel::elementType(const QString &diagram, const QString &element) const
 {
-	if(!mElements.contains(diagram) || !mElements[diagram].contains(element)) {
+	const auto diagramElements = mElementsIndex.constFind(diagram);
+	if (diagramElements == mElementsIndex.constEnd()) {
+		throw qReal::Exception(QObject::tr("Unknown element %1").arg(element));
+	}
+
+	ElementType * const result = diagramElements->value(element);
+	if (!result) {
 		throw qReal::Exception(QObject::tr("Unknown element %1").arg(element));
 	}
-	ElementType * const result = mElements[diagram][element];
+
 	Q_ASSERT_X(result, Q_FUNC_INFO, "No such entity in metamodel!");
 	return *result;
 }
@@ -193,11 +208,22 @@ void Metamodel::addNode(qrgraph::Node *entity)
 
 	const QString diagram = type->diagram();
 	const QString element = type->name();
-	if (auto && elem = mElements[diagram][element]) {
+	ElementType *&indexed = mElementsIndex[diagram][element];
+	if (indexed) {
 		auto err = QString("Duplicate enitity %1 for %2 in metamodel").arg(element).arg(diagram);
-		Q_ASSERT_X(!elem, Q_FUNC_INFO, err.toLocal8Bit().data());
+		Q_ASSERT_X(!indexed, Q_FUNC_INFO, err.toLocal8Bit().data());
 	}
-	mElements[diagram][element] = type;
+
+	QList<ElementType *> &diagramElements = mElements[diagram];
+	const auto position = std::lower_bound(diagramElements.begin(), diagramElements.end(), element
+			, [](const ElementType *type, const QString &name) { return type->name() < name; });
+	if (indexed) {
+		*position = type;
+	} else {
+		diagramElements.insert(position, type);
+	}
+
+	indexed = type;
 	Multigraph::addNode(entity);
 }
 
@@ -39,158 +39,189 @@ ElementType::Type NodeElementType::type() const
 
 QSizeF NodeElementType::size() const
 {
+	ensureInitialized();
 	return mSize;
 }
 
 void NodeElementType::setSize(const QSizeF &size)
 {
+	ensureInitialized();
 	mSize = size;
 }
 
 bool NodeElementType::isResizable() const
 {
+	ensureInitialized();
 	return mIsResizable;
 }
 
 void NodeElementType::setResizable(bool resizable)
 {
+	ensureInitialized();
 	mIsResizable = resizable;
 }
 
 const QList<qreal> &NodeElementType::border() const
 {
+	ensureInitialized();
 	return mBorder;
 }
 
 void NodeElementType::setBorder(const QList<qreal> &border)
 {
+	ensureInitialized();
 	mBorder = border;
 }
 
 const QList<PointPortInfo> &NodeElementType::pointPorts() const
 {
+	ensureInitialized();
 	return mPointPorts;
 }
 
 void NodeElementType::addPointPort(const PointPortInfo &port)
 {
+	ensureInitialized();
 	mPointPorts << port;
 	mPortTypes << port.type;
 }
 
 const QList<LinePortInfo> &NodeElementType::linePorts() const
 {
+	ensureInitialized();
 	return mLinePorts;
 }
 
 void NodeElementType::addLinePort(const LinePortInfo &port)
 {
+	ensureInitialized();
 	mLinePorts << port;
 	mPortTypes << port.type;
 }
 
 const QList<CircularPortInfo> &NodeElementType::circularPorts() const
 {
+	ensureInitialized();
 	return mCircularPorts;
 }
 
 void NodeElementType::addCircularPort(const CircularPortInfo &port)
 {
+	ensureInitialized();
 	mCircularPorts << port;
 	mPortTypes << port.type;
 }
 
 const QStringList &NodeElementType::portTypes() const
 {
+	ensureInitialized();
 	return mPortTypes;
 }
 
 QString NodeElementType::mouseGesture() const
 {
+	ensureInitialized();
 	return mMouseGesture;
 }
 
 void NodeElementType::setMouseGesture(const QString &gesture)
 {
+	ensureInitialized();
 	mMouseGesture = gesture;
 }
 
 bool NodeElementType::isContainer() const
 {
+	ensureInitialized();
 	return mIsContainer;
 }
 
 void NodeElementType::setContainer(bool isContainer)
 {
+	ensureInitialized();
 	mIsContainer = isContainer;
 }
 
 bool NodeElementType::isSortingContainer() const
 {
+	ensureInitialized();
 	return mIsSortingContainer;
 }
 
 void NodeElementType::setSortingContainer(bool isSortingContainer)
 {
+	ensureInitialized();
 	mIsSortingContainer = isSortingContainer;
 }
 
 const QVector<int> &NodeElementType::sizeOfForestalling() const
 {
+	ensureInitialized();
 	return mSizeOfForestalling;
 }
 
 void NodeElementType::setSizeOfForestalling(const QVector<int> &margins)
 {
+	ensureInitialized();
 	mSizeOfForestalling = margins;
 }
 
 int NodeElementType::sizeOfChildrenForestalling() const
 {
+	ensureInitialized();
 	return mSizeOfChildrenForestalling;
 }
 
 void NodeElementType::setSizeOfChildrenForestalling(int padding)
 {
+	ensureInitialized();
 	mSizeOfChildrenForestalling = padding;
 }
 
 bool NodeElementType::hasMovableChildren() const
 {
+	ensureInitialized();
 	return mHasMovableChildren;
 }
 
 void NodeElementType::setChildrenMovable(bool movable)
 {
+	ensureInitialized();
 	mHasMovableChildren = movable;
 }
 
 bool NodeElementType::minimizesToChildren() const
 {
+	ensureInitialized();
 	return mMinimizesToChildren;
 }
 
 void NodeElementType::setMinimizesToChildren(bool minimizes)
 {
+	ensureInitialized();
 	mMinimizesToChildren = minimizes;
 }
 
 bool NodeElementType::maximizesChildren() const
 {
+	ensureInitialized();
 	return mMaximizesChildren;
 }
 
 void NodeElementType::setMaximizesChildren(bool maximizes)
 {
+	ensureInitialized();
 	mMaximizesChildren = maximizes;
 }
 
 bool NodeElementType::createChildrenFromMenu() const
 {
+	ensureInitialized();
 	return mCreateChildrenFromMenu;
 }
 
 void NodeElementType::setCreateChildrenFromMenu(bool canCreate)
 {
+	ensureInitialized();
 	mCreateChildrenFromMenu = canCreate;
 }
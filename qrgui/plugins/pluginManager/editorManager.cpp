@@ -30,11 +30,19 @@
 
 #include "qrgui/plugins/pluginManager/sdfRenderer.h"
 #include "qrgui/plugins/pluginManager/qrsMetamodelSaver.h"
+#include "qrgui/plugins/pluginManager/metamodelCache.h"
 
 using namespace qReal;
 
 EditorManager::EditorManager(const QString &path)
-	: mPluginManager(path)
+	: EditorManager(path, PlatformInfo::invariantSettingsPath("pathToMetamodelCache"))
+{
+}
+
+EditorManager::EditorManager(const QString &path, const QString &metamodelCacheDirectory)
+	: mPluginsDir(path)
+	, mPluginManager(path)
+	, mMetamodelCacheDirectory(metamodelCacheDirectory)
 	, mInterterpretationMode(false)
 {
 	init();
@@ -42,7 +50,9 @@ EditorManager::EditorManager(const QString &path)
 
 EditorManager::EditorManager(QObject *parent)
 	: QObject(parent)
+	, mPluginsDir(PlatformInfo::invariantSettingsPath("pathToEditorPlugins"))
 	, mPluginManager(PlatformInfo::invariantSettingsPath("pathToEditorPlugins"))
+	, mMetamodelCacheDirectory(PlatformInfo::invariantSettingsPath("pathToMetamodelCache"))
 	, mInterterpretationMode(false)
 {
 	init();
@@ -55,6 +65,24 @@ EditorManager::~EditorManager()
 
 void EditorManager::init()
 {
+	// Metamodels of compiled editor plugins are read from cache while plugin binaries remain the same,
+	// so plugins are not loaded at all then.
+	QStringList pluginFiles;
+	for (const QFileInfo &pluginFile : mPluginsDir.entryInfoList(QDir::Files, QDir::Name)) {
+		pluginFiles << pluginFile.absoluteFilePath();
+	}
+
+	const MetamodelCache cache(mMetamodelCacheDirectory);
+	QList<QSharedPointer<Metamodel>> cachedMetamodels;
+	if (!pluginFiles.isEmpty() && cache.load(pluginFiles, cachedMetamodels)) {
+		for (const QSharedPointer<Metamodel> &metamodel : cachedMetamodels) {
+			mMetamodels[metamodel->id()] = metamodel;
+			mCachedMetamodels << metamodel->id();
+		}
+
+		return;
+	}
+
 	auto pluginsList = mPluginManager.loadAllPlugins<MetamodelLoaderInterface>().toSet();
 	pluginsList.remove(nullptr);
 
@@ -66,6 +94,15 @@ void EditorManager::init()
 			}
 		}
 	}
+
+	// Saving initializes all types, so they are replaced with cached ones that are lazy like on later launches.
+	if (!mMetamodels.isEmpty() && cache.save(pluginFiles, mMetamodels.values())
+			&& cache.load(pluginFiles, cachedMetamodels)) {
+		mMetamodels.clear();
+		for (const QSharedPointer<Metamodel> &metamodel : cachedMetamodels) {
+			mMetamodels[metamodel->id()] = metamodel;
+		}
+	}
 }
 
 QString EditorManager::loadPlugin(const QString &pluginName)
@@ -103,6 +140,7 @@ bool EditorManager::registerPlugin(MetamodelLoaderInterface * const loader)
 							  : mMetamodels[extendedMetamodel];
 	loader->load(*metamodel);
 	mPluginFileNames[metamodel->id()] << pluginName;
+	mCachedMetamodels.remove(metamodel->id());
 	mMetamodels[metamodel->id()] = metamodel;
 	return true;
 }
@@ -110,7 +148,10 @@ bool EditorManager::registerPlugin(MetamodelLoaderInterface * const loader)
 QString EditorManager::unloadPlugin(const QString &metamodelName)
 {
 	QString resultOfUnloading;
-	if (!mPluginFileNames[metamodelName].isEmpty()) {
+	if (mCachedMetamodels.contains(metamodelName)) {
+		// Metamodel was read from cache and its plugin was never loaded, so only the metamodel is removed.
+		mCachedMetamodels.remove(metamodelName);
+	} else if (!mPluginFileNames[metamodelName].isEmpty()) {
 		for (const QString &pathToPlugin : mPluginFileNames[metamodelName]) {
 			resultOfUnloading += mPluginManager.unloadPlugin(pathToPlugin);
 		}
@@ -390,25 +431,15 @@ bool EditorManager::hasElement(const Id &elementId) const
 	Q_ASSERT(elementId.idSize() == 3);
 	if (!mMetamodels.contains(elementId.editor()))
 		return false;
-	auto &editor = mMetamodels[elementId.editor()];
-	for (const QString &diagram : editor->diagrams()) {
-		for (const ElementType *element : editor->elements(diagram)) {
-			if (elementId.diagram() == diagram && elementId.element() == element->name()) {
-				return true;
-			}
-		}
-	}
-	return false;
+	return mMetamodels[elementId.editor()]->hasElement(elementId.diagram(), elementId.element());
 }
 
 Id EditorManager::findElementByType(const QString &type) const
 {
 	for (auto &&editor : mMetamodels.values()) {
 		for (const QString &diagram : editor->diagrams()) {
-			for (const ElementType *element : editor->elements(diagram)) {
-				if (type == element->name()) {
-					return Id(editor->id(), diagram, element->name());
-				}
+			if (editor->hasElement(diagram, type)) {
+				return Id(editor->id(), diagram, type);
 			}
 		}
 	}
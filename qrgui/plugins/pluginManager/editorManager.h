@@ -17,6 +17,7 @@
 #include <QtCore/QDir>
 #include <QtCore/QStringList>
 #include <QtCore/QMap>
+#include <QtCore/QSet>
 #include <QtCore/QPluginLoader>
 #include <QtGui/QIcon>
 
@@ -47,6 +48,11 @@ class QRGUI_PLUGINS_MANAGER_EXPORT EditorManager : public QObject, public Editor
 
 public:
 	explicit EditorManager(const QString &path);
+
+	/// Loads editor plugins from \a path keeping their metamodel cache in \a metamodelCacheDirectory,
+	/// empty directory disables the cache.
+	EditorManager(const QString &path, const QString &metamodelCacheDirectory);
+
 	explicit EditorManager(QObject *parent = nullptr);
 	~EditorManager() override;
 
@@ -151,13 +157,23 @@ public:
 private:
 	Metamodel *metamodel(const QString &editor) const;
 
+	/// Loads metamodels of editor plugins from the plugins folder. While plugin files stay the same, metamodels are
+	/// read from MetamodelCache and plugins are not loaded at all. MetamodelLoaderInterface instances do not exist
+	/// then, so dependencies() and load() are not called, Qt resources compiled into plugins are not registered,
+	/// and element types are plain data: virtual methods overridden by generated element classes are not used.
+	/// Data filled by generated initialize() is cached, including SDF pictures read from plugin resources.
 	void init();
+
 	bool registerPlugin(MetamodelLoaderInterface * const loader);
 
 	bool isParentOf(const Metamodel *plugin, const QString &childDiagram, const QString &child
 			, const QString &parentDiagram, const QString &parent) const;
 
 	QMap<QString, QStringList> mPluginFileNames;
+
+	/// Ids of metamodels read from cache, their plugins were not loaded, so there is nothing to unload for them.
+	QSet<QString> mCachedMetamodels;
+
 	QMap<QString, Pattern> mGroups;
 	QMap<QString, QSharedPointer<Metamodel>> mMetamodels;
 
@@ -166,6 +182,8 @@ private:
 	/// Common part of plugin loaders
 	PluginManager mPluginManager;
 
+	const QString mMetamodelCacheDirectory;
+
 	QSet<Id> mDisabledElements;
 
 	bool mInterterpretationMode;
@@ -0,0 +1,587 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include "metamodelCache.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDataStream>
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+#include <QtCore/QLocale>
+#include <QtCore/QSaveFile>
+#include <QtCore/QSysInfo>
+#include <QtCore/QTextStream>
+#include <QtGui/QColor>
+#include <QtXml/QDomDocument>
+
+#include <qrkernel/logging.h>
+#include <qrkernel/exception/exception.h>
+#include <metaMetaModel/metamodel.h>
+#include <metaMetaModel/nodeElementType.h>
+#include <metaMetaModel/edgeElementType.h>
+#include <metaMetaModel/patternType.h>
+
+using namespace qReal;
+
+/// Identifies metamodel cache files.
+const QByteArray magic = "QRMMC";
+/// Must be incremented on every change of the format below, cache files of other versions are ignored.
+const quint32 formatVersion = 2;
+const int streamVersion = QDataStream::Qt_5_0;
+
+/// Returns the hash of \a sourceFiles names and contents or empty array if some of them can not be read.
+/// Application version and build are hashed too since metamodel loaders may change from version to version,
+/// and so is the current locale since compiled editor plugins translate type names when loaded.
+static QByteArray sourceKey(const QStringList &sourceFiles)
+{
+	QCryptographicHash hash(QCryptographicHash::Sha1);
+	hash.addData(QByteArray(TRIK_STUDIO_VERSION));
+	hash.addData(qVersion());
+	hash.addData(QSysInfo::buildAbi().toUtf8());
+	hash.addData(QLocale().name().toUtf8());
+	for (const QString &sourceFile : sourceFiles) {
+		QFile file(sourceFile);
+		if (!file.open(QIODevice::ReadOnly)) {
+			return QByteArray();
+		}
+
+		hash.addData(QFileInfo(sourceFile).fileName().toUtf8());
+		hash.addData(&file);
+	}
+
+	return hash.result();
+}
+
+static void writeLabel(QDataStream &stream, const LabelProperties &label)
+{
+	const QString roleProperty = label.nameForRoleProperty();
+	stream << label.index() << label.x() << label.y() << label.text() << label.binding() << label.roleName()
+			<< roleProperty.mid(label.roleName().length() + 1) << label.isReadOnly() << label.isPlainTextMode()
+			<< label.rotation() << label.background() << label.scalingX() << label.scalingY() << label.isHard()
+			<< label.prefix() << label.suffix();
+}
+
+static QSharedPointer<LabelProperties> readLabel(QDataStream &stream)
+{
+	int index = 0;
+	qreal x = 0;
+	qreal y = 0;
+	QString text;
+	QString binding;
+	QString roleName;
+	QString roleProperty;
+	bool isReadOnly = false;
+	bool isPlainText = false;
+	qreal rotation = 0;
+	QColor background;
+	bool scalingX = false;
+	bool scalingY = false;
+	bool isHard = false;
+	QString prefix;
+	QString suffix;
+	stream >> index >> x >> y >> text >> binding >> roleName >> roleProperty >> isReadOnly >> isPlainText
+			>> rotation >> background >> scalingX >> scalingY >> isHard >> prefix >> suffix;
+
+	QSharedPointer<LabelProperties> label(new LabelProperties(index, x, y, binding, roleName, roleProperty
+			, isReadOnly, rotation));
+	label->setText(text);
+	label->setPlainTextMode(isPlainText);
+	label->setBackground(background);
+	label->setScalingX(scalingX);
+	label->setScalingY(scalingY);
+	label->setHard(isHard);
+	label->setPrefix(prefix);
+	label->setSuffix(suffix);
+	return label;
+}
+
+static void writeNode(QDataStream &stream, const NodeElementType &node)
+{
+	QString sdf;
+	if (!node.sdf().isNull()) {
+		QTextStream sdfStream(&sdf);
+		node.sdf().save(sdfStream, -1);
+	}
+
+	stream << sdf << node.size() << node.isResizable() << node.border() << node.mouseGesture();
+
+	stream << node.pointPorts().size();
+	for (const PointPortInfo &port : node.pointPorts()) {
+		stream << port.point << port.scalesX << port.scalesY << port.initWidth << port.initHeight << port.type;
+	}
+
+	stream << node.linePorts().size();
+	for (const LinePortInfo &port : node.linePorts()) {
+		stream << port.line << port.scalesX1 << port.scalesY1 << port.scalesX2 << port.scalesY2
+				<< port.initWidth << port.initHeight << port.type;
+	}
+
+	stream << node.circularPorts().size();
+	for (const CircularPortInfo &port : node.circularPorts()) {
+		stream << port.center << port.radius << port.scalesX << port.scalesY
+				<< port.initWidth << port.initHeight << port.type;
+	}
+
+	stream << node.isContainer() << node.isSortingContainer() << node.sizeOfForestalling()
+			<< node.sizeOfChildrenForestalling() << node.hasMovableChildren() << node.minimizesToChildren()
+			<< node.maximizesChildren() << node.createChildrenFromMenu();
+}
+
+static void readNode(QDataStream &stream, NodeElementType &node)
+{
+	QString sdf;
+	QSizeF size;
+	bool isResizable = false;
+	QList<qreal> border;
+	QString mouseGesture;
+	stream >> sdf >> size >> isResizable >> border >> mouseGesture;
+	if (!sdf.isEmpty()) {
+		QDomDocument sdfDocument;
+		sdfDocument.setContent(sdf);
+		node.loadSdf(sdfDocument.documentElement());
+	}
+
+	node.setSize(size);
+	node.setResizable(isResizable);
+	node.setBorder(border);
+	node.setMouseGesture(mouseGesture);
+
+	int count = 0;
+	stream >> count;
+	for (int i = 0; i < count && stream.status() == QDataStream::Ok; ++i) {
+		PointPortInfo port(QPointF(), false, false, 0, 0, QString());
+		stream >> port.point >> port.scalesX >> port.scalesY >> port.initWidth >> port.initHeight >> port.type;
+		node.addPointPort(port);
+	}
+
+	stream >> count;
+	for (int i = 0; i < count && stream.status() == QDataStream::Ok; ++i) {
+		LinePortInfo port(QLineF(), false, false, false, false, 0, 0, QString());
+		stream >> port.line >> port.scalesX1 >> port.scalesY1 >> port.scalesX2 >> port.scalesY2
+				>> port.initWidth >> port.initHeight >> port.type;
+		node.addLinePort(port);
+	}
+
+	stream >> count;
+	for (int i = 0; i < count && stream.status() == QDataStream::Ok; ++i) {
+		CircularPortInfo port(QPointF(), 0, false, false, 0, 0, QString());
+		stream >> port.center >> port.radius >> port.scalesX >> port.scalesY
+				>> port.initWidth >> port.initHeight >> port.type;
+		node.addCircularPort(port);
+	}
+
+	bool isContainer = false;
+	bool isSortingContainer = false;
+	QVector<int> sizeOfForestalling;
+	int sizeOfChildrenForestalling = 0;
+	bool hasMovableChildren = false;
+	bool minimizesToChildren = false;
+	bool maximizesChildren = false;
+	bool createChildrenFromMenu = false;
+	stream >> isContainer >> isSortingContainer >> sizeOfForestalling >> sizeOfChildrenForestalling
+			>> hasMovableChildren >> minimizesToChildren >> maximizesChildren >> createChildrenFromMenu;
+	node.setContainer(isContainer);
+	node.setSortingContainer(isSortingContainer);
+	node.setSizeOfForestalling(sizeOfForestalling);
+	node.setSizeOfChildrenForestalling(sizeOfChildrenForestalling);
+	node.setChildrenMovable(hasMovableChildren);
+	node.setMinimizesToChildren(minimizesToChildren);
+	node.setMaximizesChildren(maximizesChildren);
+	node.setCreateChildrenFromMenu(createChildrenFromMenu);
+}
+
+static void writeEdge(QDataStream &stream, const EdgeElementType &edge)
+{
+	stream << static_cast<int>(edge.penStyle()) << edge.penWidth() << edge.penColor() << edge.isDividable()
+			<< edge.fromPortTypes() << edge.toPortTypes() << static_cast<int>(edge.shapeType())
+			<< edge.startArrowStyle() << edge.endArrowStyle();
+}
+
+static void readEdge(QDataStream &stream, EdgeElementType &edge)
+{
+	int penStyle = 0;
+	int penWidth = 0;
+	QColor penColor;
+	bool isDividable = false;
+	QStringList fromPortTypes;
+	QStringList toPortTypes;
+	int shapeType = 0;
+	QString startArrowStyle;
+	QString endArrowStyle;
+	stream >> penStyle >> penWidth >> penColor >> isDividable >> fromPortTypes >> toPortTypes >> shapeType
+			>> startArrowStyle >> endArrowStyle;
+
+	// Edge picture is produced by pen setters in the same order as metamodel loaders call them.
+	edge.setPenWidth(penWidth);
+	edge.setPenColor(penColor);
+	edge.setPenStyle(static_cast<Qt::PenStyle>(penStyle));
+	edge.setDividable(isDividable);
+	edge.setFromPortTypes(fromPortTypes);
+	edge.setToPortTypes(toPortTypes);
+	edge.setShapeType(static_cast<LinkShape>(shapeType));
+	edge.setStartArrowStyle(startArrowStyle);
+	edge.setEndArrowStyle(endArrowStyle);
+}
+
+/// Returns the data of \a element that is filled in ElementType::initialize(): labels, properties and
+/// the data specific to nodes and edges.
+static QByteArray elementDetails(const ElementType &element)
+{
+	QByteArray result;
+	QDataStream stream(&result, QIODevice::WriteOnly);
+	stream.setVersion(streamVersion);
+
+	stream << element.labels().size();
+	for (const QSharedPointer<LabelProperties> &label : element.labels()) {
+		writeLabel(stream, *label);
+	}
+
+	stream << element.propertyNames().size();
+	for (const QString &property : element.propertyNames()) {
+		stream << property << element.propertyType(property) << element.propertyDefaultValue(property)
+				<< element.propertyDisplayedName(property) << element.propertyDescription(property)
+				<< element.referenceProperties().contains(property);
+	}
+
+	if (element.type() == ElementType::Type::node) {
+		writeNode(stream, element.toNode());
+	} else if (element.type() == ElementType::Type::edge) {
+		writeEdge(stream, element.toEdge());
+	}
+
+	return result;
+}
+
+/// Fills \a element with \a details written by elementDetails().
+static void readElementDetails(const QByteArray &details, ElementType &element)
+{
+	QDataStream stream(details);
+	stream.setVersion(streamVersion);
+
+	int count = 0;
+	stream >> count;
+	for (int i = 0; i < count && stream.status() == QDataStream::Ok; ++i) {
+		element.addLabel(readLabel(stream));
+	}
+
+	stream >> count;
+	for (int i = 0; i < count && stream.status() == QDataStream::Ok; ++i) {
+		QString property;
+		QString propertyType;
+		QString defaultValue;
+		QString displayedName;
+		QString propertyDescription;
+		bool isReference = false;
+		stream >> property >> propertyType >> defaultValue >> displayedName >> propertyDescription >> isReference;
+		element.addProperty(property, propertyType, defaultValue, displayedName, propertyDescription, isReference);
+	}
+
+	if (element.type() == ElementType::Type::node) {
+		readNode(stream, element.toNode());
+	} else if (element.type() == ElementType::Type::edge) {
+		readEdge(stream, element.toEdge());
+	}
+
+	if (stream.status() != QDataStream::Ok) {
+		QLOG_ERROR() << "Cached data of" << element.diagram() << element.name() << "is corrupted";
+	}
+}
+
+/// Node or edge type read from cache. Like types of compiled editor plugins it is lightweight until used,
+/// its details are parsed from cached bytes on first access.
+template<typename BaseType>
+class CachedElementType : public BaseType
+{
+public:
+	CachedElementType(Metamodel &metamodel, const QByteArray &details)
+		: BaseType(metamodel)
+		, mDetails(details)
+	{
+	}
+
+protected:
+	void initialize() override
+	{
+		readElementDetails(mDetails, *this);
+		mDetails.clear();
+	}
+
+private:
+	QByteArray mDetails;
+};
+
+static void writeElement(QDataStream &stream, const ElementType &element)
+{
+	stream << static_cast<int>(element.type()) << element.name() << element.friendlyName() << element.description()
+			<< element.diagram() << element.isHidden();
+
+	stream << elementDetails(element);
+	if (element.type() == ElementType::Type::pattern) {
+		stream << element.toPattern().xml();
+	}
+}
+
+/// Reads element type and appends it to \a metamodel. Returns false if stream contains unknown element type.
+static bool readElement(QDataStream &stream, Metamodel &metamodel)
+{
+	int type = 0;
+	QString name;
+	QString friendlyName;
+	QString description;
+	QString diagram;
+	bool isHidden = false;
+	QByteArray details;
+	stream >> type >> name >> friendlyName >> description >> diagram >> isHidden >> details;
+
+	QScopedPointer<ElementType> element;
+	switch (static_cast<ElementType::Type>(type)) {
+	case ElementType::Type::node:
+		element.reset(new CachedElementType<NodeElementType>(metamodel, details));
+		break;
+	case ElementType::Type::edge:
+		element.reset(new CachedElementType<EdgeElementType>(metamodel, details));
+		break;
+	case ElementType::Type::pattern: {
+		QString xml;
+		stream >> xml;
+		element.reset(new PatternType(metamodel));
+		element->toPattern().setXml(xml);
+		break;
+	}
+	default:
+		return false;
+	}
+
+	element->setName(name);
+	element->setFriendlyName(friendlyName);
+	element->setDescription(description);
+	element->setDiagram(diagram);
+	element->setHidden(isHidden);
+	if (element->type() == ElementType::Type::pattern) {
+		// Patterns are few and are parsed at once anyway, so they are read eagerly.
+		readElementDetails(details, *element);
+	}
+
+	if (stream.status() != QDataStream::Ok || metamodel.hasElement(diagram, name)) {
+		return false;
+	}
+
+	metamodel.addElement(*element.take());
+	return true;
+}
+
+static void writeMetamodel(QDataStream &stream, const Metamodel &metamodel)
+{
+	stream << metamodel.id() << metamodel.version() << metamodel.friendlyName() << metamodel.diagrams();
+	for (const QString &diagram : metamodel.diagrams()) {
+		const ElementType * const diagramNode = metamodel.diagramNode(diagram);
+		stream << metamodel.diagramFriendlyName(diagram) << (diagramNode ? diagramNode->name() : QString())
+				<< metamodel.shallPaletteBeSorted(diagram) << metamodel.diagramPaletteGroups(diagram);
+		for (const QString &group : metamodel.diagramPaletteGroups(diagram)) {
+			stream << metamodel.diagramPaletteGroupList(diagram, group)
+					<< metamodel.diagramPaletteGroupDescription(diagram, group);
+		}
+	}
+
+	stream << metamodel.enumNames();
+	for (const QString &enumName : metamodel.enumNames()) {
+		stream << metamodel.enumValues(enumName) << metamodel.isEnumEditable(enumName);
+	}
+
+	stream << metamodel.vertices().size();
+	for (const qrgraph::Node * const vertex : metamodel.vertices()) {
+		writeElement(stream, *static_cast<const ElementType *>(vertex));
+	}
+
+	// Relations between types: generalizations, containment and explosions.
+	QList<const qrgraph::Edge *> relations;
+	for (const qrgraph::Node * const vertex : metamodel.vertices()) {
+		for (const qrgraph::Edge * const edge : vertex->outgoingEdges()) {
+			if (edge->end()) {
+				relations << edge;
+			}
+		}
+	}
+
+	stream << relations.size();
+	for (const qrgraph::Edge * const relation : relations) {
+		const ElementType * const source = static_cast<const ElementType *>(relation->begin());
+		const ElementType * const target = static_cast<const ElementType *>(relation->end());
+		const Explosion * const explosion = dynamic_cast<const Explosion *>(relation);
+		stream << source->diagram() << source->name() << target->diagram() << target->name() << relation->type()
+				<< (explosion && explosion->isReusable()) << (explosion && explosion->requiresImmediateLinkage());
+	}
+}
+
+static QSharedPointer<Metamodel> readMetamodel(QDataStream &stream)
+{
+	QSharedPointer<Metamodel> metamodel(new Metamodel);
+	QString id;
+	QString version;
+	QString friendlyName;
+	QStringList diagrams;
+	stream >> id >> version >> friendlyName >> diagrams;
+	metamodel->setId(id);
+	metamodel->setVersion(version);
+	metamodel->setFriendlyName(friendlyName);
+	metamodel->setDiagrams(diagrams);
+	for (const QString &diagram : diagrams) {
+		QString diagramFriendlyName;
+		QString diagramNode;
+		bool isPaletteSorted = false;
+		QStringList groups;
+		stream >> diagramFriendlyName >> diagramNode >> isPaletteSorted >> groups;
+		metamodel->setDiagramFriendlyName(diagram, diagramFriendlyName);
+		metamodel->setDiagramNode(diagram, diagramNode);
+		metamodel->setPaletteSorted(diagram, isPaletteSorted);
+		for (const QString &group : groups) {
+			QStringList groupElements;
+			QString groupDescription;
+			stream >> groupElements >> groupDescription;
+			metamodel->appendDiagramPaletteGroup(diagram, group);
+			for (const QString &element : groupElements) {
+				metamodel->addElementToDiagramPaletteGroup(diagram, group, element);
+			}
+
+			metamodel->setDiagramPaletteGroupDescription(diagram, group, groupDescription);
+		}
+	}
+
+	QStringList enumNames;
+	stream >> enumNames;
+	for (const QString &enumName : enumNames) {
+		QList<QPair<QString, QString>> values;
+		bool isEditable = false;
+		stream >> values >> isEditable;
+		metamodel->addEnum(enumName, values);
+		metamodel->setEnumEditable(enumName, isEditable);
+	}
+
+	int count = 0;
+	stream >> count;
+	for (int i = 0; i < count && stream.status() == QDataStream::Ok; ++i) {
+		if (!readElement(stream, *metamodel)) {
+			return QSharedPointer<Metamodel>();
+		}
+	}
+
+	stream >> count;
+	for (int i = 0; i < count && stream.status() == QDataStream::Ok; ++i) {
+		QString sourceDiagram;
+		QString source;
+		QString targetDiagram;
+		QString target;
+		uint type = 0;
+		bool isReusable = false;
+		bool requiresImmediateLinkage = false;
+		stream >> sourceDiagram >> source >> targetDiagram >> target >> type >> isReusable >> requiresImmediateLinkage;
+
+		// Throws if cache refers to unknown type.
+		ElementType &sourceType = metamodel->elementType(sourceDiagram, source);
+		ElementType &targetType = metamodel->elementType(targetDiagram, target);
+		if (type == ElementType::explosionLinkType) {
+			metamodel->addExplosion(sourceType, targetType, isReusable, requiresImmediateLinkage);
+		} else {
+			metamodel->produceEdge(sourceType, targetType, type);
+		}
+	}
+
+	return stream.status() == QDataStream::Ok ? metamodel : QSharedPointer<Metamodel>();
+}
+
+MetamodelCache::MetamodelCache(const QString &cacheDirectory)
+	: mCacheDirectory(cacheDirectory)
+{
+}
+
+bool MetamodelCache::load(const QStringList &sourceFiles, QList<QSharedPointer<Metamodel>> &metamodels) const
+{
+	if (mCacheDirectory.isEmpty()) {
+		return false;
+	}
+
+	QFile file(cacheFile(sourceFiles));
+	if (!file.open(QIODevice::ReadOnly)) {
+		return false;
+	}
+
+	QDataStream stream(&file);
+	stream.setVersion(streamVersion);
+	QByteArray fileMagic;
+	quint32 version = 0;
+	QByteArray key;
+	stream >> fileMagic >> version >> key;
+	if (fileMagic != magic || version != formatVersion || key.isEmpty() || key != sourceKey(sourceFiles)) {
+		return false;
+	}
+
+	QList<QSharedPointer<Metamodel>> result;
+	int count = 0;
+	stream >> count;
+	try {
+		for (int i = 0; i < count && stream.status() == QDataStream::Ok; ++i) {
+			const QSharedPointer<Metamodel> metamodel = readMetamodel(stream);
+			if (!metamodel) {
+				break;
+			}
+
+			result << metamodel;
+		}
+	} catch (const qReal::Exception &) {
+		result.clear();
+	}
+
+	if (result.size() != count || stream.status() != QDataStream::Ok) {
+		QLOG_WARN() << "Metamodel cache" << file.fileName() << "for" << sourceFiles << "is corrupted, ignoring it";
+		return false;
+	}
+
+	metamodels = result;
+	return true;
+}
+
+bool MetamodelCache::save(const QStringList &sourceFiles, const QList<QSharedPointer<Metamodel>> &metamodels) const
+{
+	const QByteArray key = sourceKey(sourceFiles);
+	if (mCacheDirectory.isEmpty() || key.isEmpty() || !QDir().mkpath(mCacheDirectory)) {
+		return false;
+	}
+
+	// Several processes may write the same cache simultaneously, so the file is replaced atomically.
+	QSaveFile file(cacheFile(sourceFiles));
+	if (!file.open(QIODevice::WriteOnly)) {
+		QLOG_WARN() << "Can not write metamodel cache" << file.fileName() << ":" << file.errorString();
+		return false;
+	}
+
+	QDataStream stream(&file);
+	stream.setVersion(streamVersion);
+	stream << magic << formatVersion << key << metamodels.size();
+	for (const QSharedPointer<Metamodel> &metamodel : metamodels) {
+		writeMetamodel(stream, *metamodel);
+	}
+
+	return stream.status() == QDataStream::Ok && file.commit();
+}
+
+QString MetamodelCache::cacheFile(const QStringList &sourceFiles) const
+{
+	QCryptographicHash hash(QCryptographicHash::Sha1);
+	for (const QString &sourceFile : sourceFiles) {
+		hash.addData(QFileInfo(sourceFile).absoluteFilePath().toUtf8());
+	}
+
+	return QDir(mCacheDirectory).filePath(hash.result().toHex() + ".cache");
+}
@@ -0,0 +1,57 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#pragma once
+
+#include <QtCore/QList>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+
+#include "pluginsManagerDeclSpec.h"
+
+namespace qReal {
+
+class Metamodel;
+
+/// Keeps fully resolved metamodels loaded from some source files (.qrs save with metamodel or compiled editor
+/// plugins) in binary cache files, so that later launches read them instead of parsing the sources or loading
+/// plugins again. A cache file is keyed by the hash of source files contents, application version and current
+/// locale, so any change of them invalidates it. Element types read from cache are lazy: their details are
+/// parsed on first access, see ElementType::initialize().
+/// @note Edge pictures are not stored, they are rebuilt from the pen settings of edge types.
+class QRGUI_PLUGINS_MANAGER_EXPORT MetamodelCache
+{
+public:
+	/// @param cacheDirectory A folder where cache files are kept, will be created when needed.
+	/// If empty then caching is disabled.
+	explicit MetamodelCache(const QString &cacheDirectory);
+
+	/// Reads metamodels cached for current contents of \a sourceFiles into \a metamodels.
+	/// @returns false if there is no cache for \a sourceFiles, it is outdated or can not be read.
+	/// \a metamodels are not modified then.
+	bool load(const QStringList &sourceFiles, QList<QSharedPointer<Metamodel>> &metamodels) const;
+
+	/// Writes \a metamodels into cache for current contents of \a sourceFiles.
+	/// @returns false if cache file could not be written.
+	bool save(const QStringList &sourceFiles, const QList<QSharedPointer<Metamodel>> &metamodels) const;
+
+private:
+	QString cacheFile(const QStringList &sourceFiles) const;
+
+	const QString mCacheDirectory;
+};
+
+}
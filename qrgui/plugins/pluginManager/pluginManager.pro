@@ -25,6 +25,7 @@ links(qrkernel qrgraph qrutils qrrepo qrgui-tool-plugin-interface qrgui-meta-met
 includes(qrgui qrgraph qrgui/plugins/metaMetaModel)
 
 DEFINES += QRGUI_PLUGINS_MANAGER_LIBRARY
+DEFINES += TRIK_STUDIO_VERSION=$$shell_quote('"'$$TRIK_STUDIO_VERSION'"')
 
 TRANSLATIONS = \
 	$$PWD/../../../qrtranslations/ru/qrgui_pluginsManager_ru.ts \
@@ -39,6 +40,7 @@ HEADERS += \
 	$$PWD/sdfRenderer.h \
 	$$PWD/qrsMetamodelLoader.h \
 	$$PWD/qrsMetamodelSaver.h \
+	$$PWD/metamodelCache.h \
 	$$PWD/details/patternParser.h \
 
 SOURCES += \
@@ -48,6 +50,7 @@ SOURCES += \
 	$$PWD/sdfRenderer.cpp \
 	$$PWD/qrsMetamodelLoader.cpp \
 	$$PWD/qrsMetamodelSaver.cpp \
+	$$PWD/metamodelCache.cpp \
 	$$PWD/details/patternParser.cpp \
 
 RESOURCES += \
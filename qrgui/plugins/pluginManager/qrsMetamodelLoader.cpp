@@ -16,6 +16,7 @@
 
 #include <QtXml/QDomDocument>
 
+#include <qrkernel/platformInfo.h>
 #include <qrutils/scalableItem.h>
 #include <qrrepo/repoApi.h>
 #include <metaMetaModel/metamodel.h>
@@ -23,6 +24,8 @@
 #include <metaMetaModel/edgeElementType.h>
 #include <metaMetaModel/patternType.h>
 
+#include "metamodelCache.h"
+
 using namespace qReal;
 
 const Id metamodelRootDiagramType = Id("MetaEditor", "MetaEditor", "MetamodelDiagram");
@@ -47,17 +50,32 @@ const Id metamodelPropertiesAsContainerType = Id("MetaEditor", "MetaEditor", "Me
 QList<QSharedPointer<Metamodel> > QrsMetamodelLoader::load(const QString &pathToQrs)
 {
 	QList<QSharedPointer<Metamodel>> result;
+	const MetamodelCache cache(PlatformInfo::invariantSettingsPath("pathToMetamodelCache"));
+	if (cache.load({pathToQrs}, result)) {
+		return result;
+	}
+
 	const qrRepo::RepoApi repo(pathToQrs);
 	if (!repo.exist(Id::rootId())) {
 		return result;
 	}
 
+	// Metamodels with errors are not cached so that the errors are reported on each loading.
+	bool hasErrors = false;
+	const QMetaObject::Connection errorsConnection = connect(this, &QrsMetamodelLoader::errorOccured
+			, [&hasErrors]() { hasErrors = true; });
+
 	for (const Id &id : repo.children(Id::rootId())) {
 		if (id.type() == metamodelRootDiagramType && repo.isLogicalElement(id)) {
 			result << QSharedPointer<Metamodel>(parseMetamodel(repo, id));
 		}
 	}
 
+	disconnect(errorsConnection);
+	if (!hasErrors) {
+		cache.save({pathToQrs}, result);
+	}
+
 	return result;
 }
 
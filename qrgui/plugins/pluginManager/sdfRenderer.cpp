@@ -18,6 +18,7 @@
 #include <QtCore/QTime>
 #include <QtCore/QDebug>
 #include <QtCore/QRegExp>
+#include <QtCore/QHash>
 #include <QtCore/QFileInfo>
 #include <QtCore/QDir>
 #include <QtWidgets/QApplication>
@@ -68,6 +69,7 @@ bool SdfRenderer::load(const QString &filename)
 	}
 	file.close();
 
+	mCompiled = false;
 	QDomElement docElem = doc.documentElement();
 	first_size_x = docElem.attribute("sizex").toInt();
 	first_size_y = docElem.attribute("sizey").toInt();
@@ -78,6 +80,7 @@ bool SdfRenderer::load(const QString &filename)
 bool SdfRenderer::load(const QDomDocument &document)
 {
 	doc = document;
+	mCompiled = false;
 	const QDomElement docElem = doc.firstChildElement("picture");
 	first_size_x = docElem.attribute("sizex").toInt();
 	first_size_y = docElem.attribute("sizey").toInt();
@@ -88,6 +91,7 @@ bool SdfRenderer::load(const QDomDocument &document)
 bool SdfRenderer::load(const QDomElement &picture)
 {
 	doc.appendChild(doc.importNode(picture, true));
+	mCompiled = false;
 	const QDomElement docElem = doc.firstChildElement("picture");
 	first_size_x = docElem.attribute("sizex").toInt();
 	first_size_y = docElem.attribute("sizey").toInt();
@@ -107,101 +111,309 @@ void SdfRenderer::setZoom(qreal zoomFactor)
 
 void SdfRenderer::render(QPainter *painter, const QRectF &bounds, bool isIcon)
 {
+	if (!mCompiled) {
+		compile();
+	}
+
 	current_size_x = static_cast<int>(bounds.width());
 	current_size_y = static_cast<int>(bounds.height());
 	mStartX = static_cast<int>(bounds.x());
 	mStartY = static_cast<int>(bounds.y());
 	this->painter = painter;
-	QDomElement docElem = doc.documentElement();
-	QDomNode node = docElem.firstChild();
-	while(!node.isNull())
-	{
-		QDomElement elem = node.toElement();
-		if(!elem.isNull())
-		{
-			if (!checkShowConditions(elem, isIcon)) {
-				node = node.nextSibling();
-				continue;
-			}
-			if (elem.tagName()=="line")
-			{
-				line(elem);
-			}
-			else if(elem.tagName()=="ellipse")
-			{
-				ellipse(elem);
-			}
-			else if (elem.tagName() == "arc") {
-				arc(elem);
-			}
-			else if(elem.tagName()=="background")
-			{
-				background(elem);
-			}
-			else if(elem.tagName()=="text")
-			{
-				draw_text(elem);
-			}
-			else if (elem.tagName()=="rectangle")
-			{
-				rectangle(elem);
-			}
-			else if (elem.tagName()=="polygon")
-			{
-				polygon(elem);
-			}
-			else if (elem.tagName()=="point")
-			{
-				point(elem);
-			}
-			else if(elem.tagName()=="path")
-			{
-				path_draw(elem);
-			}
-			else if(elem.tagName()=="stylus")
-			{
-				stylus_draw(elem);
-			}
-			else if(elem.tagName()=="curve")
-			{
-				curve_draw(elem);
-			}
-			else if(elem.tagName()=="image")
+	for (const Shape &shape : mShapes) {
+		if (checkShowConditions(shape.conditions, isIcon)) {
+			draw(shape);
+		}
+	}
+
+	this->painter = 0;
+}
+
+void SdfRenderer::compile()
+{
+	mShapes.clear();
+	const QDomElement docElem = doc.documentElement();
+	for (QDomElement elem = docElem.firstChildElement(); !elem.isNull(); elem = elem.nextSiblingElement()) {
+		const QList<Condition> conditions = compileConditions(elem);
+		const QString tagName = elem.tagName();
+		if (tagName == "line") {
+			compileShape(elem, Shape::line, conditions);
+		} else if (tagName == "ellipse") {
+			compileShape(elem, Shape::ellipse, conditions);
+		} else if (tagName == "arc") {
+			compileShape(elem, Shape::arc, conditions);
+		} else if (tagName == "background") {
+			compileShape(elem, Shape::background, conditions);
+		} else if (tagName == "text") {
+			compileShape(elem, Shape::text, conditions);
+		} else if (tagName == "rectangle") {
+			compileShape(elem, Shape::rectangle, conditions);
+		} else if (tagName == "polygon") {
+			compileShape(elem, Shape::polygon, conditions);
+		} else if (tagName == "point") {
+			compileShape(elem, Shape::point, conditions);
+		} else if (tagName == "path") {
+			compileShape(elem, Shape::path, conditions);
+		} else if (tagName == "stylus") {
+			// Stylus is just a group of lines shown or hidden together.
+			for (QDomElement line = elem.firstChildElement("line"); !line.isNull()
+					; line = line.nextSiblingElement("line"))
 			{
-				image_draw(elem);
+				compileShape(line, Shape::line, conditions);
 			}
+		} else if (tagName == "curve") {
+			compileShape(elem, Shape::curve, conditions);
+		} else if (tagName == "image") {
+			compileShape(elem, Shape::image, conditions);
 		}
-		node = node.nextSibling();
 	}
-	this->painter = 0;
+
+	mCompiled = true;
 }
 
-bool SdfRenderer::checkShowConditions(const QDomElement &element, bool isIcon) const
+void SdfRenderer::compileShape(const QDomElement &element, Shape::Type type, const QList<Condition> &conditions)
+{
+	Shape shape;
+	shape.type = type;
+	shape.conditions = conditions;
+	shape.style = compileStyle(element);
+
+	switch (type) {
+	case Shape::polygon: {
+		const int n = element.attribute("n").toInt();
+		for (int i = 1; i <= n; ++i) {
+			shape.coordinates << compileCoordinate(element.attribute("x" + QString::number(i)))
+					<< compileCoordinate(element.attribute("y" + QString::number(i)));
+		}
+
+		break;
+	}
+	case Shape::text: {
+		QString str = element.text();
+
+		// delete "\n" from the beginning and from the end of the string
+		if (str.startsWith('\n')) {
+			str.remove(0, 1);
+		}
+
+		if (str.endsWith('\n')) {
+			str.chop(1);
+		}
+
+		shape.textLines = str.split('\n');
+		break;
+	}
+	case Shape::path:
+		shape.painterPath = compilePath(element.attribute("d").remove(0, 1));
+		break;
+	case Shape::curve: {
+		const QDomElement start = element.firstChildElement("start");
+		const QDomElement end = element.firstChildElement("end");
+		const QDomElement control = element.firstChildElement("ctrl");
+		shape.curveStart = QPointF(start.attribute("startx").toDouble(), start.attribute("starty").toDouble());
+		shape.curveEnd = QPointF(end.attribute("endx").toDouble(), end.attribute("endy").toDouble());
+		shape.curveControl = QPointF(control.attribute("x").toDouble(), control.attribute("y").toDouble());
+		break;
+	}
+	case Shape::image:
+		shape.imageName = element.attribute("name", "default");
+		break;
+	default:
+		break;
+	}
+
+	if (type != Shape::polygon) {
+		shape.coordinates << compileCoordinate(element.attribute("x1"))
+				<< compileCoordinate(element.attribute("y1"))
+				<< compileCoordinate(element.attribute("x2"))
+				<< compileCoordinate(element.attribute("y2"));
+	}
+
+	if (type == Shape::arc) {
+		shape.startAngle = element.attribute("startAngle").toInt();
+		shape.spanAngle = element.attribute("spanAngle").toInt();
+	}
+
+	mShapes << shape;
+}
+
+QList<SdfRenderer::Condition> SdfRenderer::compileConditions(const QDomElement &element)
+{
+	QList<Condition> conditions;
+	const QDomNodeList showConditions = element.elementsByTagName("showIf");
+	for (int i = 0; i < showConditions.length(); ++i) {
+		const QDomElement condition = showConditions.at(i).toElement();
+		const QString sign = condition.attribute("sign");
+		const QString value = condition.attribute("value");
+		conditions << Condition{condition.attribute("property"), sign, value
+				, sign == "=~" ? QRegExp(value) : QRegExp()};
+	}
+
+	return conditions;
+}
+
+SdfRenderer::Style SdfRenderer::compileStyle(const QDomElement &elem)
+{
+	Style style;
+	if (elem.hasAttribute("stroke-width")) {
+		style.hasStrokeWidth = true;
+		style.strokeWidth = elem.attribute("stroke-width").toInt();
+	}
+
+	if (elem.hasAttribute("fill")) {
+		style.hasFill = true;
+		style.fill = QColor(elem.attribute("fill"));
+	}
+
+	if (elem.hasAttribute("stroke")) {
+		style.hasStroke = true;
+		style.stroke = QColor(elem.attribute("stroke"));
+	}
+
+	if (elem.hasAttribute("stroke-style")) {
+		const QHash<QString, Qt::PenStyle> penStyles = {
+			{ "solid", Qt::SolidLine }
+			, { "dot", Qt::DotLine }
+			, { "dash", Qt::DashLine }
+			, { "dashdot", Qt::DashDotLine }
+			, { "dashdotdot", Qt::DashDotDotLine }
+			, { "none", Qt::NoPen }
+		};
+
+		const QString strokeStyle = elem.attribute("stroke-style");
+		if (penStyles.contains(strokeStyle)) {
+			style.hasStrokeStyle = true;
+			style.strokeStyle = penStyles[strokeStyle];
+		}
+	}
+
+	if (elem.hasAttribute("fill-style")) {
+		if (elem.attribute("fill-style") == "none") {
+			style.hasFillStyle = true;
+			style.fillStyle = Qt::NoBrush;
+		} else if (elem.attribute("fill-style") == "solid") {
+			style.hasFillStyle = true;
+			style.fillStyle = Qt::SolidPattern;
+		}
+	}
+
+	if (elem.hasAttribute("font-fill")) {
+		style.hasFontFill = true;
+		style.fontFill = QColor(elem.attribute("font-fill"));
+	}
+
+	if (elem.hasAttribute("font-size")) {
+		QString fontSize = elem.attribute("font-size");
+		style.hasFontSize = true;
+		if (fontSize.endsWith("%")) {
+			fontSize.chop(1);
+			style.fontSizeUnit = Coordinate::percent;
+		} else if (fontSize.endsWith("a")) {
+			fontSize.chop(1);
+			style.fontSizeUnit = Coordinate::absolute;
+		}
+
+		style.fontSize = fontSize.toInt();
+	}
+
+	if (elem.hasAttribute("font-name")) {
+		style.hasFontName = true;
+		style.fontName = elem.attribute("font-name");
+	}
+
+	if (elem.hasAttribute("b")) {
+		style.hasBold = true;
+		style.bold = elem.attribute("b").toInt();
+	}
+
+	if (elem.hasAttribute("i")) {
+		style.hasItalic = true;
+		style.italic = elem.attribute("i").toInt();
+	}
+
+	if (elem.hasAttribute("u")) {
+		style.hasUnderline = true;
+		style.underline = elem.attribute("u").toInt();
+	}
+
+	return style;
+}
+
+SdfRenderer::Coordinate SdfRenderer::compileCoordinate(const QString &coordinate)
+{
+	Coordinate result;
+	QString value = coordinate;
+	if (value.endsWith("%")) {
+		value.chop(1);
+		result.unit = Coordinate::percent;
+	} else if (value.endsWith("a")) {
+		value.chop(1);
+		result.unit = Coordinate::absolute;
+	}
+
+	result.value = value.toFloat();
+	return result;
+}
+
+QPainterPath SdfRenderer::compilePath(const QString &description)
+{
+	// Description is a sequence of space-separated commands "M x y", "L x y", "C x1 y1 x2 y2 x y" and "Z". If there
+	// are several coordinate groups after a command only the last one is taken.
+	const QStringList tokens = description.split(' ', QString::SkipEmptyParts);
+	QPainterPath path;
+	int i = 0;
+	while (i < tokens.size()) {
+		const QString command = tokens[i];
+		++i;
+		QList<QPointF> points;
+		while (i + 1 < tokens.size() && !QString("MLCZ").contains(tokens[i])) {
+			points << QPointF(tokens[i].toFloat(), tokens[i + 1].toFloat());
+			i += 2;
+		}
+
+		if (command == "M" && !points.isEmpty()) {
+			path.moveTo(points.last());
+		} else if (command == "L" && !points.isEmpty()) {
+			path.lineTo(points.last());
+		} else if (command == "C" && points.size() >= 3) {
+			const int last = points.size() - points.size() % 3 - 1;
+			path.cubicTo(points[last - 2], points[last - 1], points[last]);
+		} else if (command == "Z") {
+			path.closeSubpath();
+		}
+	}
+
+	return path;
+}
+
+bool SdfRenderer::checkShowConditions(const QList<Condition> &conditions, bool isIcon) const
 {
-	QDomNodeList showConditions = element.elementsByTagName("showIf");
 	// a hack, need to be removed when there is another version of icons
-	if (!showConditions.isEmpty() && isIcon) {
+	if (!conditions.isEmpty() && isIcon) {
 		return false;
 	}
-	if (showConditions.isEmpty() || !mElementRepo) {
+
+	if (conditions.isEmpty() || !mElementRepo) {
 		return true;
 	}
-	for (int i = 0; i < showConditions.length(); ++i) {
-		if (!checkCondition(showConditions.at(i).toElement())) {
+
+	for (const Condition &condition : conditions) {
+		if (!checkCondition(condition)) {
 			return false;
 		}
 	}
+
 	return true;
 }
 
-bool SdfRenderer::checkCondition(const QDomElement &condition) const
+bool SdfRenderer::checkCondition(const Condition &condition) const
 {
-	QString sign = condition.attribute("sign");
-	QString realValue = mElementRepo->logicalProperty(condition.attribute("property"));
-	QString conditionValue = condition.attribute("value");
+	const QString &sign = condition.sign;
+	const QString realValue = mElementRepo->logicalProperty(condition.property);
+	const QString &conditionValue = condition.value;
 
 	if (sign == "=~") {
-		return QRegExp(conditionValue).exactMatch(realValue);
+		return condition.regExp.exactMatch(realValue);
 	} else if (sign == ">") {
 		return realValue.toInt() > conditionValue.toInt();
 	} else if (sign == "<") {
@@ -220,192 +432,161 @@ bool SdfRenderer::checkCondition(const QDomElement &condition) const
 	}
 }
 
-void SdfRenderer::line(QDomElement &element)
+void SdfRenderer::draw(const Shape &shape)
+{
+	switch (shape.type) {
+	case Shape::line:
+		line(shape);
+		break;
+	case Shape::ellipse:
+		ellipse(shape);
+		break;
+	case Shape::arc:
+		arc(shape);
+		break;
+	case Shape::background:
+		background(shape);
+		break;
+	case Shape::text:
+		draw_text(shape);
+		break;
+	case Shape::rectangle:
+		rectangle(shape);
+		break;
+	case Shape::polygon:
+		polygon(shape);
+		break;
+	case Shape::point:
+		point(shape);
+		break;
+	case Shape::path:
+		path_draw(shape);
+		break;
+	case Shape::curve:
+		curve_draw(shape);
+		break;
+	case Shape::image:
+		image_draw(shape);
+		break;
+	}
+}
+
+void SdfRenderer::line(const Shape &shape)
 {
-	float x1 = x1_def(element);
-	float y1 = y1_def(element);
-	float x2 = x2_def(element);
-	float y2 = y2_def(element);
+	float x1 = x_def(shape.coordinates[0]);
+	float y1 = y_def(shape.coordinates[1]);
+	float x2 = x_def(shape.coordinates[2]);
+	float y2 = y_def(shape.coordinates[3]);
 	QLineF line (x1,y1,x2,y2);
 
-	parsestyle(element);
+	parsestyle(shape.style);
 	painter->drawLine(line);
 }
 
-void SdfRenderer::ellipse(QDomElement &element)
+void SdfRenderer::ellipse(const Shape &shape)
 {
-	float x1 = x1_def(element);
-	float y1 = y1_def(element);
-	float x2 = x2_def(element);
-	float y2 = y2_def(element);
+	float x1 = x_def(shape.coordinates[0]);
+	float y1 = y_def(shape.coordinates[1]);
+	float x2 = x_def(shape.coordinates[2]);
+	float y2 = y_def(shape.coordinates[3]);
 
 	QRectF rect(x1, y1, x2-x1, y2-y1);
-	parsestyle(element);
+	parsestyle(shape.style);
 	painter->drawEllipse(rect);
 }
 
-void SdfRenderer::arc(QDomElement &element)
+void SdfRenderer::arc(const Shape &shape)
 {
-	float x1 = x1_def(element);
-	float y1 = y1_def(element);
-	float x2 = x2_def(element);
-	float y2 = y2_def(element);
-	int startAngle = element.attribute("startAngle").toInt();
-	int spanAngle = element.attribute("spanAngle").toInt();
+	float x1 = x_def(shape.coordinates[0]);
+	float y1 = y_def(shape.coordinates[1]);
+	float x2 = x_def(shape.coordinates[2]);
+	float y2 = y_def(shape.coordinates[3]);
 
 	QRectF rect(x1, y1, x2-x1, y2-y1);
-	parsestyle(element);
-	painter->drawArc(rect, startAngle, spanAngle);
+	parsestyle(shape.style);
+	painter->drawArc(rect, shape.startAngle, shape.spanAngle);
 }
 
-void SdfRenderer::background(QDomElement &element)
+void SdfRenderer::background(const Shape &shape)
 {
-	parsestyle(element);
+	parsestyle(shape.style);
 	painter->setPen(brush.color());
 	painter->drawRect(painter->window());
 	defaultstyle();
 }
 
-void SdfRenderer::draw_text(QDomElement &element)
+void SdfRenderer::draw_text(const Shape &shape)
 {
-	parsestyle(element);
+	parsestyle(shape.style);
 	pen.setStyle(Qt::SolidLine);
 	painter->setPen(pen);
-	float x1 = x1_def(element);
-	float y1 = y1_def(element);
-	QString str = element.text();
-
-	// delete "\n" from the beginning of the string
-	if (str[0] == '\n')
-		str.remove(0, 1);
-
-	// delete "\n" from the end of the string
-	if (str[str.length() - 1] == '\n')
-		str.remove(str.length() - 1, 1);
+	float x1 = x_def(shape.coordinates[0]);
+	float y1 = y_def(shape.coordinates[1]);
 
-	while (str.contains('\n'))
-	{
-		int i = str.indexOf('\n');
-		QString temp = str.left(i);
-		str.remove(0, i + 1);
-		painter->drawText(static_cast<int>(x1), static_cast<int>(y1), temp);
-		y1 += painter->font().pixelSize() ;
+	for (int i = 0; i < shape.textLines.size() - 1; ++i) {
+		painter->drawText(static_cast<int>(x1), static_cast<int>(y1), shape.textLines[i]);
+		y1 += painter->font().pixelSize();
 	}
+
 	QPointF point(x1, y1);
-	painter->drawText(point, str);
+	painter->drawText(point, shape.textLines.last());
 	defaultstyle();
 }
 
-void SdfRenderer::rectangle(QDomElement &element)
+void SdfRenderer::rectangle(const Shape &shape)
 {
-	float x1 = x1_def(element);
-	float y1 = y1_def(element);
-	float x2 = x2_def(element);
-	float y2 = y2_def(element);
+	float x1 = x_def(shape.coordinates[0]);
+	float y1 = y_def(shape.coordinates[1]);
+	float x2 = x_def(shape.coordinates[2]);
+	float y2 = y_def(shape.coordinates[3]);
 
 	QRectF rect;
 	rect.adjust(x1, y1, x2, y2);
-	parsestyle(element);
+	parsestyle(shape.style);
 	painter->drawRect(rect);
 	defaultstyle();
 }
 
-void SdfRenderer::polygon(QDomElement &element)
+void SdfRenderer::polygon(const Shape &shape)
 {
-	parsestyle(element);
-	// FIXME: init points array here
-	QPoint *points = nullptr;
-	int n = element.attribute("n").toInt();
-	if (!element.isNull())
-	{
-		points = getpoints(element, n);
+	parsestyle(shape.style);
+	const int n = shape.coordinates.size() / 2;
+	QVector<QPoint> points(n);
+	for (int i = 0; i < n; ++i) {
+		points[i] = QPoint(static_cast<int>(x_def(shape.coordinates[2 * i]))
+				, static_cast<int>(y_def(shape.coordinates[2 * i + 1])));
 	}
-	if (points != nullptr)
-	{
-		painter->drawConvexPolygon(points, n);
-		delete[] points;
+
+	if (n > 0) {
+		painter->drawConvexPolygon(points.constData(), n);
 	}
+
 	defaultstyle();
 }
 
-void SdfRenderer::image_draw(QDomElement &element)
+void SdfRenderer::image_draw(const Shape &shape)
 {
-	float const x1 = x1_def(element);
-	float const y1 = y1_def(element);
-	float const x2 = x2_def(element);
-	float const y2 = y2_def(element);
+	float const x1 = x_def(shape.coordinates[0]);
+	float const y1 = y_def(shape.coordinates[1]);
+	float const x2 = x_def(shape.coordinates[2]);
+	float const y2 = y_def(shape.coordinates[3]);
 
-	const QString fileName = SettingsManager::value("pathToImages").toString() + "/"
-			+ element.attribute("name", "default");
+	const QString fileName = SettingsManager::value("pathToImages").toString() + "/" + shape.imageName;
 
 	const QRect rect(x1, y1, x2 - x1, y2 - y1);
 	mImagesCache->drawImage(fileName, *painter, rect, mZoom);
 }
 
-void SdfRenderer::point(QDomElement &element)
+void SdfRenderer::point(const Shape &shape)
 {
-	parsestyle(element);
-	float x = x1_def(element);
-	float y = y1_def(element);
+	parsestyle(shape.style);
+	float x = x_def(shape.coordinates[0]);
+	float y = y_def(shape.coordinates[1]);
 	QPointF pointf(x,y);
 	painter->drawLine(QPointF(pointf.x()-0.1, pointf.y()-0.1), QPointF(pointf.x()+0.1, pointf.y()+0.1));
 	defaultstyle();
 }
 
-QPoint *SdfRenderer::getpoints(QDomElement &element, int n)
-{
-	QPoint *array = new QPoint[n];
-	float x = 0;
-	float y = 0;
-	for (int i = 0; i < n; i++)
-	{
-		QString str;
-		str.setNum(i + 1);
-		QDomElement const &elem = element;
-		QString xnum = elem.attribute(QString("x").append(str));
-		if (xnum.endsWith("%"))
-		{
-			xnum.chop(1);
-			x = current_size_x * xnum.toFloat() / 100 + mStartX;
-		}
-		else if (xnum.endsWith("a") && mNeedScale)
-		{
-			xnum.chop(1);
-			x = xnum.toFloat() + mStartX;
-		}
-		else if (xnum.endsWith("a") && !mNeedScale)
-		{
-			xnum.chop(1);
-			x = xnum.toFloat() * current_size_x / first_size_x + mStartX;
-		}
-		else
-			x = xnum.toFloat() * current_size_x / first_size_x + mStartX;
-
-		QString ynum = elem.attribute(QString("y").append(str));
-		if (ynum.endsWith("%"))
-		{
-			ynum.chop(1);
-			y = current_size_y * ynum.toFloat() / 100 + mStartY;
-		}
-		else if (ynum.endsWith("a") && mNeedScale)
-		{
-			ynum.chop(1);
-			y = ynum.toFloat() + mStartY;
-		}
-		else if (ynum.endsWith("a") && !mNeedScale)
-		{
-			ynum.chop(1);
-			y = ynum.toFloat() * current_size_y / first_size_y + mStartY;
-		}
-		else
-			y = ynum.toFloat() * current_size_y / first_size_y + mStartY;
-
-		array[i].setX(static_cast<int>(x));
-		array[i].setY(static_cast<int>(y));
-	}
-	return array;
-}
-
 void SdfRenderer::defaultstyle()
 {
 	pen.setColor(QColor(0,0,0));
@@ -415,379 +596,111 @@ void SdfRenderer::defaultstyle()
 	pen.setWidth(1);
 }
 
-bool SdfRenderer::isNotLCMZ(QString str, int i)
-{
-	return (str[i] != 'L') && (str[i] != 'C') && (str[i] != 'M')
-		&& (str[i] != 'Z') && (i != str.length());
-}
-
-void SdfRenderer::path_draw(QDomElement &element)
+void SdfRenderer::path_draw(const Shape &shape)
 {
-	QPointF end_point;
-	QPointF c1;
-	QPointF c2;
-	QDomElement elem = element;
-	QPainterPath path;
-
-	if (!elem.isNull())
-	{
-		QString d_cont;
-		d_cont = elem.attribute("d").remove(0, 1);
-		d_cont.append(" Z");
-
-		for (i = 0; i < d_cont.length() - 1;)
-		{
-			if (d_cont[i] == 'M')
-			{
-				j = i + 2;
-				while (isNotLCMZ(d_cont, j))
-				{
-					while (d_cont[j] != ' ')
-					{
-						s1.append(d_cont[j]);
-						++j;
-					}
-
-					end_point.setX(s1.toFloat() * current_size_x / first_size_x + mStartX);
-					s1.clear();
-					++j;
-
-					while (d_cont[j] != ' ')
-					{
-						s1.append(d_cont[j]);
-						++j;
-					}
-
-					end_point.setY(s1.toFloat() * current_size_y / first_size_y + mStartY);
-					++j;
-					s1.clear();
-				}
-
-				path.moveTo(end_point);
-				i = j;
-			}
-			else if (d_cont[i] == 'L')
-			{
-				j = i + 2;
-				while (isNotLCMZ(d_cont, j))
-				{
-					while (d_cont[j] != ' ')
-					{
-						s1.append(d_cont[j]);
-						++j;
-					}
-
-					end_point.setX(s1.toFloat() * current_size_x / first_size_x + mStartX);
-					s1.clear();
-					++j;
-
-					while (d_cont[j] != ' ')
-					{
-						s1.append(d_cont[j]);
-						++j;
-					}
-					end_point.setY(s1.toFloat() * current_size_y / first_size_y + mStartY);
-					++j;
-					s1.clear();
-				}
-
-				 path.lineTo(end_point);
-				 i = j;
-			}
-			 else if (d_cont[i] == 'C')
-			{
-				j = i + 2;
-				while(isNotLCMZ(d_cont, j))
-				{
-					while (!(d_cont[j] == ' '))
-					{
-						s1.append(d_cont[j]);
-						++j;
-					}
-
-					c1.setX(s1.toFloat() * current_size_x / first_size_x + mStartX);
-					s1.clear();
-					++j;
-
-					while (d_cont[j] != ' ')
-					{
-						s1.append(d_cont[j]);
-						++j;
-					}
-
-					c1.setY(s1.toFloat() * current_size_y / first_size_y + mStartY);
-					s1.clear();
-					++j;
-
-					while (d_cont[j] != ' ')
-					{
-						s1.append(d_cont[j]);
-						++j;
-					}
-
-					c2.setX(s1.toFloat() * current_size_x / first_size_x + mStartX);
-					s1.clear();
-					++j;
-
-					while (d_cont[j] != ' ')
-					{
-						s1.append(d_cont[j]);
-						++j;
-					}
-
-					c2.setY(s1.toFloat() * current_size_y / first_size_y + mStartY);
-					s1.clear();
-					++j;
-
-					while (d_cont[j] != ' ')
-					{
-						s1.append(d_cont[j]);
-						++j;
-					}
-
-					end_point.setX(s1.toFloat() * current_size_x / first_size_x + mStartX);
-					s1.clear();
-					++j;
-
-					while (d_cont[j] != ' ')
-					{
-						s1.append(d_cont[j]);
-						++j;
-					}
-
-					end_point.setY(s1.toFloat() * current_size_y / first_size_y + mStartY);
-					s1.clear();
-					++j;
-				}
-
-				path.cubicTo(c1, c2, end_point);
-				i = j;
-
-			} else if (d_cont[i] == 'Z')
-			{
-				path.closeSubpath();
-				logger ("loggerZ.txt", "DONE");
-			}
-		}
-	}
+	// Path is compiled in picture coordinates, so it is only scaled and moved to current bounds.
+	const QTransform transform(static_cast<qreal>(current_size_x) / first_size_x, 0
+			, 0, static_cast<qreal>(current_size_y) / first_size_y
+			, mStartX, mStartY);
 
-	parsestyle(element);
-	painter->drawPath(path);
+	parsestyle(shape.style);
+	painter->drawPath(transform.map(shape.painterPath));
 }
 
-void SdfRenderer::stylus_draw(QDomElement &element)
+void SdfRenderer::curve_draw(const Shape &shape)
 {
-	QDomNode node = element.firstChild();
-	while(!node.isNull())
-	{
-		QDomElement elem = node.toElement();
-		if(!elem.isNull())
-		{
-			if (elem.tagName()=="line")
-			{
-				line(elem);
-			}
-		}
-		node = node.nextSibling();
-	}
-}
-
-void SdfRenderer::curve_draw(QDomElement &element)
-{
-	QDomNode node = element.firstChild();
-	QPointF start(0, 0);
-	QPointF end(0, 0);
-	QPoint c1(0, 0);
-	while(!node.isNull())
-	{
-		QDomElement elem = node.toElement();
-		if(!elem.isNull())
-		{
-			if (elem.tagName() == "start")
-			{
-				start.setX(elem.attribute("startx").toDouble() * current_size_x / first_size_x);
-				start.setY(elem.attribute("starty").toDouble() * current_size_y / first_size_y);
-			}
-			else if (elem.tagName() == "end")
-			{
-				end.setX(elem.attribute("endx").toDouble() * current_size_x / first_size_x);
-				end.setY(elem.attribute("endy").toDouble() * current_size_y / first_size_y);
-			}
-			else if (elem.tagName() == "ctrl")
-			{
-				c1.setX(elem.attribute("x").toDouble() * current_size_x / first_size_x);
-				c1.setY(elem.attribute("y").toDouble() * current_size_y / first_size_y);
-			}
-		}
-		node = node.nextSibling();
-	}
+	const QPointF start(shape.curveStart.x() * current_size_x / first_size_x
+			, shape.curveStart.y() * current_size_y / first_size_y);
+	const QPointF end(shape.curveEnd.x() * current_size_x / first_size_x
+			, shape.curveEnd.y() * current_size_y / first_size_y);
+	const QPoint c1(static_cast<int>(shape.curveControl.x() * current_size_x / first_size_x)
+			, static_cast<int>(shape.curveControl.y() * current_size_y / first_size_y));
 
 	QPainterPath path(start);
 	path.quadTo(c1, end);
-	parsestyle(element);
+	parsestyle(shape.style);
 	painter->drawPath(path);
 }
 
-void SdfRenderer::parsestyle(QDomElement &element)
+void SdfRenderer::parsestyle(const Style &style)
 {
-	QDomElement const &elem = element;
-	if(!elem.isNull())
-	{
-		if (elem.hasAttribute("stroke-width"))
-		{
-			if (mNeedScale)
-				pen.setWidth(elem.attribute("stroke-width").toInt());
-			else  // for painting icons. width of all lines should be set to 1
-				pen.setWidth(1);
-		}
-
-		if (elem.hasAttribute("fill"))
-		{
-			QColor color = elem.attribute("fill");
-			brush.setStyle(Qt::SolidPattern);
-			brush.setColor(color);
-		}
+	if (style.hasStrokeWidth) {
+		// for painting icons width of all lines should be set to 1
+		pen.setWidth(mNeedScale ? style.strokeWidth : 1);
+	}
 
-		if (elem.hasAttribute("stroke"))
-		{
-			QColor color = elem.attribute("stroke");
-			pen.setColor(color);
-		}
+	if (style.hasFill) {
+		brush.setStyle(Qt::SolidPattern);
+		brush.setColor(style.fill);
+	}
 
-		if (elem.hasAttribute("stroke-style"))
-		{
-			if (elem.attribute("stroke-style") == "solid")
-				pen.setStyle(Qt::SolidLine);
-			if (elem.attribute("stroke-style") == "dot")
-				pen.setStyle(Qt::DotLine);
-			if (elem.attribute("stroke-style") == "dash")
-				pen.setStyle(Qt::DashLine);
-			if (elem.attribute("stroke-style") == "dashdot")
-				pen.setStyle(Qt::DashDotLine);
-			if (elem.attribute("stroke-style") == "dashdotdot")
-				pen.setStyle(Qt::DashDotDotLine);
-			if (elem.attribute("stroke-style") == "none")
-				pen.setStyle(Qt::NoPen);
-		}
+	if (style.hasStroke) {
+		pen.setColor(style.stroke);
+	}
 
-		if (elem.hasAttribute("fill-style"))
-		{
-			if (elem.attribute("fill-style")=="none")
-				brush.setStyle(Qt::NoBrush);
-			else if(elem.attribute("fill-style")=="solid")
-				brush.setStyle(Qt::SolidPattern);
-		}
+	if (style.hasStrokeStyle) {
+		pen.setStyle(style.strokeStyle);
+	}
 
-		if (elem.hasAttribute("font-fill"))
-		{
-			QColor color = elem.attribute("font-fill");
-			pen.setColor(color);
-		}
+	if (style.hasFillStyle) {
+		brush.setStyle(style.fillStyle);
+	}
 
-		if (elem.hasAttribute("font-size"))
-		{
-			QString fontsize = elem.attribute("font-size");
-			if (fontsize.endsWith("%"))
-			{
-				fontsize.chop(1);
-				font.setPixelSize(current_size_y * fontsize.toInt() / 100);
-			}
-			else if (fontsize.endsWith("a") && mNeedScale)
-			{
-				fontsize.chop(1);
-				font.setPixelSize(fontsize.toInt());
-			}
-			else if (fontsize.endsWith("a") && !mNeedScale)
-			{
-				fontsize.chop(1);
-				font.setPixelSize(fontsize.toInt() * current_size_y / first_size_y);
-			}
-			else
-				font.setPixelSize(fontsize.toInt() * current_size_y / first_size_y);
-		}
+	if (style.hasFontFill) {
+		pen.setColor(style.fontFill);
+	}
 
-		if (elem.hasAttribute("font-name"))
-		{
-			font.setFamily(elem.attribute("font-name"));
+	if (style.hasFontSize) {
+		if (style.fontSizeUnit == Coordinate::percent) {
+			font.setPixelSize(current_size_y * style.fontSize / 100);
+		} else if (style.fontSizeUnit == Coordinate::absolute && mNeedScale) {
+			font.setPixelSize(style.fontSize);
+		} else {
+			font.setPixelSize(style.fontSize * current_size_y / first_size_y);
 		}
+	}
 
-		if (elem.hasAttribute("b"))
-		{
-			font.setBold(elem.attribute("b").toInt());
-		}
+	if (style.hasFontName) {
+		font.setFamily(style.fontName);
+	}
 
-		if (elem.hasAttribute("i"))
-		{
-			font.setItalic(elem.attribute("i").toInt());
-		}
+	if (style.hasBold) {
+		font.setBold(style.bold);
+	}
 
-		if (elem.hasAttribute("u"))
-		{
-			font.setUnderline(elem.attribute("u").toInt());
-		}
+	if (style.hasItalic) {
+		font.setItalic(style.italic);
+	}
 
-		painter->setFont(font);
+	if (style.hasUnderline) {
+		font.setUnderline(style.underline);
 	}
+
+	painter->setFont(font);
 	painter->setPen(pen);
 	painter->setBrush(brush);
 }
 
-float SdfRenderer::coord_def(QDomElement &element, QString const &coordName, int current_size, int first_size)
+float SdfRenderer::coord_def(const Coordinate &coordinate, int current_size, int first_size) const
 {
-	float coord = 0;
-	QString coordStr = element.attribute(coordName);
-
-	if (coordStr.endsWith("%"))
-	{
-		coordStr.chop(1);
-		coord = current_size * coordStr.toFloat() / 100;
-		return coord;
-	}
-	else if (coordStr.endsWith("a") && mNeedScale)
-	{
-		coordStr.chop(1);
-		coord = coordStr.toFloat();
-		return coord;
-	}
-	else if (coordStr.endsWith("a") && !mNeedScale)
-	{
-		coordStr.chop(1);
-		coord = coordStr.toFloat() * current_size / first_size;
-		return coord;
-	}
-	else
-	{
-		coord = coordStr.toFloat() * current_size / first_size;
-		return coord;
+	switch (coordinate.unit) {
+	case Coordinate::percent:
+		return current_size * coordinate.value / 100;
+	case Coordinate::absolute:
+		return mNeedScale ? coordinate.value : coordinate.value * current_size / first_size;
+	default:
+		return coordinate.value * current_size / first_size;
 	}
 }
 
-float SdfRenderer::x1_def(QDomElement &element)
+float SdfRenderer::x_def(const Coordinate &coordinate) const
 {
-	return coord_def(element, "x1", current_size_x, first_size_x) + mStartX;
+	return coord_def(coordinate, current_size_x, first_size_x) + mStartX;
 }
 
-float SdfRenderer::y1_def(QDomElement &element)
+float SdfRenderer::y_def(const Coordinate &coordinate) const
 {
-	return coord_def(element, "y1", current_size_y, first_size_y) + mStartY;
-}
-
-float SdfRenderer::x2_def(QDomElement &element)
-{
-	return coord_def(element, "x2", current_size_x, first_size_x) + mStartX;
-}
-
-float SdfRenderer::y2_def(QDomElement &element)
-{
-	return coord_def(element, "y2", current_size_y, first_size_y) + mStartY;
-}
-
-void SdfRenderer::logger(const QString &path, const QString &string)
-{	log.setFileName(path);
-	log.open(QIODevice::Append | QIODevice::Text);
-	logtext.setDevice(&log);
-	logtext << string << "\n";
-	log.close();
+	return coord_def(coordinate, current_size_y, first_size_y) + mStartY;
 }
 
 void SdfRenderer::noScale()
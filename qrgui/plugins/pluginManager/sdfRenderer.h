@@ -18,9 +18,12 @@
 #include <QtXml/QDomDocument>
 #include <QtGui/QPainter>
 #include <QtGui/QFont>
+#include <QtGui/QPainterPath>
 #include <QtCore/QFile>
 #include <QtCore/QTextStream>
 #include <QtCore/QFileInfo>
+#include <QtCore/QRegExp>
+#include <QtCore/QVector>
 #include <QtCore/QSharedPointer>
 #include <QtGui/QIconEngine>
 #include <QtSvg/QSvgRenderer>
@@ -62,6 +65,101 @@ public slots:
 	void setZoom(qreal zoomFactor);
 
 private:
+	/// Coordinate of a picture element as it is written in sdf: in picture coordinates that are scaled to current
+	/// size, in percents of current size ("%" suffix) or absolute ("a" suffix).
+	struct Coordinate
+	{
+		enum Unit
+		{
+			scaled
+			, percent
+			, absolute
+		};
+
+		float value = 0;
+		Unit unit = scaled;
+	};
+
+	/// Condition on a logical property of an element that shall hold for a picture element to be shown.
+	struct Condition
+	{
+		QString property;
+		QString sign;
+		QString value;
+		QRegExp regExp;
+	};
+
+	/// Pen, brush and font changes made by attributes of a picture element, unset attributes leave current values.
+	struct Style
+	{
+		bool hasStrokeWidth = false;
+		int strokeWidth = 1;
+		bool hasFill = false;
+		QColor fill;
+		bool hasStroke = false;
+		QColor stroke;
+		bool hasStrokeStyle = false;
+		Qt::PenStyle strokeStyle = Qt::SolidLine;
+		bool hasFillStyle = false;
+		Qt::BrushStyle fillStyle = Qt::NoBrush;
+		bool hasFontFill = false;
+		QColor fontFill;
+		bool hasFontSize = false;
+		int fontSize = 0;
+		Coordinate::Unit fontSizeUnit = Coordinate::scaled;
+		bool hasFontName = false;
+		QString fontName;
+		bool hasBold = false;
+		bool bold = false;
+		bool hasItalic = false;
+		bool italic = false;
+		bool hasUnderline = false;
+		bool underline = false;
+	};
+
+	/// Picture element compiled from sdf, so nothing has to be parsed when it is drawn.
+	struct Shape
+	{
+		enum Type
+		{
+			line
+			, ellipse
+			, arc
+			, background
+			, text
+			, rectangle
+			, polygon
+			, point
+			, path
+			, curve
+			, image
+		};
+
+		Type type;
+		Style style;
+		QList<Condition> conditions;
+
+		/// Coordinates in order of attributes x1, y1, x2, y2, ... (pairs for polygon vertices).
+		QVector<Coordinate> coordinates;
+
+		int startAngle = 0;
+		int spanAngle = 0;
+
+		/// Lines of a text.
+		QStringList textLines;
+
+		/// Path in picture coordinates.
+		QPainterPath painterPath;
+
+		/// Points of a curve in picture coordinates.
+		QPointF curveStart;
+		QPointF curveEnd;
+		QPointF curveControl;
+
+		/// Name of an image file in images folder.
+		QString imageName;
+	};
+
 	QString mWorkingDirName;
 	const QSharedPointer<utils::ImagesCache> mImagesCache;
 
@@ -71,19 +169,16 @@ private:
 	int current_size_y {-1};
 	int mStartX { 0 };
 	int mStartY { 0 };
-	int i {-1};
-	int j {-1};
-	int sep {-1};
 	QPainter *painter {};
 	QPen pen;
 	QBrush brush;
-	QString s1;
-	QString s2;
 	QFont font;
-	QFile log;
-	QTextStream logtext;
 	QDomDocument doc;
 
+	/// Picture compiled from doc, valid when mCompiled is true.
+	QList<Shape> mShapes;
+	bool mCompiled = false;
+
 	/** @brief is false if we don't need to scale according to absolute
 	 * coords, is useful for rendering icons. default is true
 	**/
@@ -91,34 +186,34 @@ private:
 	qreal mZoom = 1.0;
 	ElementRepoInterface *mElementRepo {};
 
-	bool checkShowConditions(const QDomElement &element, bool isIcon) const;
-	bool checkCondition(const QDomElement &condition) const;
-
-	void line(QDomElement &element);
-	void ellipse(QDomElement &element);
-	void arc(QDomElement &element);
-	void parsestyle(QDomElement &element);
-	void background(QDomElement &element);
-	void draw_text(QDomElement &element);
-	void rectangle(QDomElement &element);
-	void polygon(QDomElement &element);
-	QPoint *getpoints(QDomElement &element, int n);
-	void point (QDomElement &element);
+	/// Compiles current document into a list of shapes.
+	void compile();
+	void compileShape(const QDomElement &element, Shape::Type type, const QList<Condition> &conditions);
+	static QList<Condition> compileConditions(const QDomElement &element);
+	static Style compileStyle(const QDomElement &element);
+	static Coordinate compileCoordinate(const QString &coordinate);
+	static QPainterPath compilePath(const QString &description);
+
+	bool checkShowConditions(const QList<Condition> &conditions, bool isIcon) const;
+	bool checkCondition(const Condition &condition) const;
+
+	void draw(const Shape &shape);
+	void line(const Shape &shape);
+	void ellipse(const Shape &shape);
+	void arc(const Shape &shape);
+	void parsestyle(const Style &style);
+	void background(const Shape &shape);
+	void draw_text(const Shape &shape);
+	void rectangle(const Shape &shape);
+	void polygon(const Shape &shape);
+	void point(const Shape &shape);
 	void defaultstyle();
-	void path_draw(QDomElement &element);
-	void stylus_draw(QDomElement &element);
-	void curve_draw(QDomElement &element);
-	void image_draw(QDomElement &element);
-	float x1_def(QDomElement &element);
-	float y1_def(QDomElement &element);
-	float x2_def(QDomElement &element);
-	float y2_def(QDomElement &element);
-	float coord_def(QDomElement &element, const QString &coordName, int current_size, int first_size);
-	void logger(const QString &path, const QString &string);
-
-	/// checks that str[i] is not L, C, M or Z
-	/// @todo Not so helpful comment
-	bool isNotLCMZ(QString str, int i);
+	void path_draw(const Shape &shape);
+	void curve_draw(const Shape &shape);
+	void image_draw(const Shape &shape);
+	float x_def(const Coordinate &coordinate) const;
+	float y_def(const Coordinate &coordinate) const;
+	float coord_def(const Coordinate &coordinate, int current_size, int first_size) const;
 };
 
 /// Constructs QIcon instance by a given sdf description
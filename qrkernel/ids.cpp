@@ -14,11 +14,63 @@
 
 #include "ids.h"
 
+#include <algorithm>
+
 #include <QtCore/QVariant>
 #include <QtCore/QUuid>
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
 
 using namespace qReal;
 
+namespace qReal {
+namespace details {
+
+/// Interned editor, diagram and element parts of Ids. Type descriptors are never deleted, so Ids may keep pointers to
+/// them, and there is exactly one descriptor for each combination of parts, so pointers may be compared instead of
+/// strings.
+struct IdType
+{
+	QString editor;
+	QString diagram;
+	QString element;
+
+	/// Returns descriptor for given parts creating it if needed, or nullptr if all parts are empty.
+	static const IdType *intern(const QString &editor, const QString &diagram, const QString &element)
+	{
+		if (editor.isEmpty() && diagram.isEmpty() && element.isEmpty()) {
+			return nullptr;
+		}
+
+		static QMutex mutex;
+		static QHash<QString, const IdType *> types;
+
+		const QString key = editor + "/" + diagram + "/" + element;
+		QMutexLocker lock(&mutex);
+		const IdType *&type = types[key];
+		if (!type) {
+			type = new IdType{editor, diagram, element};
+		}
+
+		return type;
+	}
+};
+
+}
+}
+
+/// Returns UUID if given string is a UUID in the same format as produced by QUuid::toString(), null UUID otherwise.
+static QUuid parseUuid(const QString &string)
+{
+	const int uuidStringLength = 38;
+	if (string.length() != uuidStringLength || !string.startsWith('{')) {
+		return QUuid();
+	}
+
+	const QUuid uuid(string);
+	return !uuid.isNull() && uuid.toString() == string ? uuid : QUuid();
+}
+
 Id Id::loadFromString(const QString &string)
 {
 	const QStringList path = string.split('/');
@@ -26,111 +78,115 @@ Id Id::loadFromString(const QString &string)
 	Q_ASSERT(path[0] == "qrm:");
 
 	Id result;
-	switch (path.count()) {
-	case 5: result.mId = path[4];
-		// Fall-thru
-	case 4: result.mElement = path[3];
-		// Fall-thru
-	case 3: result.mDiagram = path[2];
-		// Fall-thru
-	case 2: result.mEditor = path[1];
-		// Fall-thru
-	}
+	result.setParts(path.value(1), path.value(2), path.value(3), path.value(4));
 	Q_ASSERT(string == result.toString());
 	return result;
 }
 
 Id Id::createElementId(const QString &editor, const QString &diagram, const QString &element)
 {
-	return Id(editor, diagram, element, QUuid::createUuid().toString());
+	Id result(editor, diagram, element);
+	result.mUuid = QUuid::createUuid();
+	return result;
 }
 
 Id Id::rootId()
 {
-	return Id("ROOT_ID", "ROOT_ID", "ROOT_ID", "ROOT_ID");
+	static const Id root("ROOT_ID", "ROOT_ID", "ROOT_ID", "ROOT_ID");
+	return root;
 }
 
 Id::Id(const QString &editor, QString  const &diagram, QString  const &element, QString  const &id)
-		: mEditor(editor)
-		, mDiagram(diagram)
-		, mElement(element)
-		, mId(id)
 {
+	setParts(editor, diagram, element, id);
 	Q_ASSERT(checkIntegrity());
 }
 
 Id::Id(const Id &base, const QString &additional)
-		: mEditor(base.mEditor)
-		, mDiagram(base.mDiagram)
-		, mElement(base.mElement)
-		, mId(base.mId)
 {
+	QString editor = base.editor();
+	QString diagram = base.diagram();
+	QString element = base.element();
+	QString id = base.id();
+
 	const unsigned baseSize = base.idSize();
 	switch (baseSize) {
 	case 0:
-		mEditor = additional;
+		editor = additional;
 		break;
 	case 1:
-		mDiagram = additional;
+		diagram = additional;
 		break;
 	case 2:
-		mElement = additional;
+		element = additional;
 		break;
 	case 3:
-		mId = additional;
+		id = additional;
 		break;
 	default:
 		Q_ASSERT(!"Can not add a part to Id, it will be too long");
 	}
+
+	setParts(editor, diagram, element, id);
 	Q_ASSERT(checkIntegrity());
 }
 
+void Id::setParts(const QString &editor, const QString &diagram, const QString &element, const QString &id)
+{
+	mType = details::IdType::intern(editor, diagram, element);
+	mUuid = parseUuid(id);
+	mId = mUuid.isNull() && !id.isEmpty() ? id : QString();
+}
 
 bool Id::isNull() const
 {
-	return mEditor.isEmpty() && mDiagram.isEmpty()
-			&& mElement.isEmpty() && mId.isEmpty();
+	return !mType && mUuid.isNull() && mId.isEmpty();
 }
 
 QString Id::editor() const
 {
-	return mEditor;
+	return mType ? mType->editor : QString();
 }
 
 QString Id::diagram() const
 {
-	return mDiagram;
+	return mType ? mType->diagram : QString();
 }
 
 QString Id::element() const
 {
-	return mElement;
+	return mType ? mType->element : QString();
 }
 
 QString Id::id() const
 {
-	return mId;
+	return mUuid.isNull() ? mId : mUuid.toString();
 }
 
 Id Id::type() const
 {
-	return Id(mEditor, mDiagram, mElement);
+	Id result;
+	result.mType = mType;
+	return result;
 }
 
 Id Id::sameTypeId() const
 {
-	return Id(mEditor, mDiagram, mElement, QUuid::createUuid().toString());
+	Id result;
+	result.mType = mType;
+	result.mUuid = QUuid::createUuid();
+	return result;
 }
 
 unsigned Id::idSize() const
 {
-	if (!mId.isEmpty()) {
+	if (!mUuid.isNull() || !mId.isEmpty()) {
 		return 4;
-	} if (!mElement.isEmpty()) {
+	} if (!element().isEmpty()) {
 		return 3;
-	} if (!mDiagram.isEmpty()) {
+	} if (!diagram().isEmpty()) {
 		return 2;
-	} if (!mEditor.isEmpty()) {
+	} if (!editor().isEmpty()) {
 		return 1;
 	}
 	return 0;
@@ -143,13 +199,16 @@ QUrl Id::toUrl() const
 
 QString Id::toString() const
 {
-	QString path = "qrm:/" + mEditor;
-	if (mDiagram != "") {
-		path += "/" + mDiagram;
-	} if (mElement != "") {
-		path += "/" + mElement;
-	} if (mId != "") {
-		path += "/" + mId;
+	QString path = "qrm:/" + editor();
+	const QString diagram = this->diagram();
+	const QString element = this->element();
+	const QString id = this->id();
+	if (diagram != "") {
+		path += "/" + diagram;
+	} if (element != "") {
+		path += "/" + element;
+	} if (id != "") {
+		path += "/" + id;
 	}
 	return path;
 }
@@ -158,29 +217,62 @@ bool Id::checkIntegrity() const
 {
 	bool emptyPartsAllowed = true;
 
-	if (!mId.isEmpty()) {
+	if (!id().isEmpty()) {
 		emptyPartsAllowed = false;
 	}
 
-	if (!mElement.isEmpty()) {
+	if (!element().isEmpty()) {
 		emptyPartsAllowed = false;
 	} else if (!emptyPartsAllowed) {
 		return false;
 	}
 
-	if (!mDiagram.isEmpty()) {
+	if (!diagram().isEmpty()) {
 		emptyPartsAllowed = false;
 	} else if (!emptyPartsAllowed) {
 		return false;
 	}
 
-	if (mEditor.isEmpty() && !emptyPartsAllowed) {
+	if (editor().isEmpty() && !emptyPartsAllowed) {
 		return false;
 	}
 
 	return true;
 }
 
+/// Compares UUIDs in the same order as their strings, QUuid::operator<() takes variant into account first.
+static bool uuidLess(const QUuid &uuid1, const QUuid &uuid2)
+{
+	if (uuid1.data1 != uuid2.data1) {
+		return uuid1.data1 < uuid2.data1;
+	}
+
+	if (uuid1.data2 != uuid2.data2) {
+		return uuid1.data2 < uuid2.data2;
+	}
+
+	if (uuid1.data3 != uuid2.data3) {
+		return uuid1.data3 < uuid2.data3;
+	}
+
+	return std::lexicographical_compare(uuid1.data4, uuid1.data4 + 8, uuid2.data4, uuid2.data4 + 8);
+}
+
+bool qReal::operator<(const Id &i1, const Id &i2)
+{
+	if (i1.mType != i2.mType) {
+		return i1.editor() != i2.editor() ? i1.editor() < i2.editor()
+				: i1.diagram() != i2.diagram() ? i1.diagram() < i2.diagram()
+				: i1.element() < i2.element();
+	}
+
+	if (!i1.mUuid.isNull() && !i2.mUuid.isNull()) {
+		return uuidLess(i1.mUuid, i2.mUuid);
+	}
+
+	return i1.id() < i2.id();
+}
+
 QVariant Id::toVariant() const
 {
 	QVariant result;
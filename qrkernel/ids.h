@@ -15,16 +15,26 @@
 #pragma once
 
 #include <QtCore/QUrl>
+#include <QtCore/QUuid>
 #include <QtCore/QDebug>
 
 #include "kernelDeclSpec.h"
 
 namespace qReal {
 
+namespace details {
+struct IdType;
+}
+
 /// Identifier of model element or element type. Consists of four parts ---
 /// editor (metamodel to which our element belongs to), diagram in that editor
 /// (a tab in palette where this element will appear), element (type of
 /// an element, actually), id (id of an element).
+///
+/// First three parts are interned: all ids with the same editor, diagram and element share one type descriptor,
+/// so Id keeps only a pointer to it. Id part is kept as 128-bit UUID when it is a UUID in QUuid::toString() format
+/// (as ids created by createElementId() are), or as a string otherwise. So ids are cheap to copy, hash and compare,
+/// and string parts are built only when requested.
 class QRKERNEL_EXPORT Id
 {
 public:
@@ -110,25 +120,31 @@ public:
 
 	// default destructor and copy constuctor are OK
 private:
+	/// Sets all parts of an Id without checking integrity.
+	void setParts(const QString &editor, const QString &diagram, const QString &element, const QString &id);
+
 	/// Used only for debug. Checks that Id is correct.
 	bool checkIntegrity() const;
 
-	QString mEditor;
-	QString mDiagram;
-	QString mElement;
+	/// Interned editor, diagram and element parts, nullptr if all of them are empty.
+	const details::IdType *mType = nullptr;
+
+	/// Id part if it is a UUID, null otherwise.
+	QUuid mUuid;
+
+	/// Id part if it is not a UUID, null otherwise.
 	QString mId;
 
 	friend bool operator==(const Id &i1, const Id &i2);
-	friend bool operator<(const Id &i1, const Id &i2);
+	friend QRKERNEL_EXPORT bool operator<(const Id &i1, const Id &i2);
 	friend uint qHash(const Id &key);
 };
 
 /// Id equality operator. Ids are equal when all their parts are equal.
 inline bool operator==(const Id &i1, const Id &i2)
 {
-	return i1.mEditor == i2.mEditor
-			&& i1.mDiagram == i2.mDiagram
-			&& i1.mElement == i2.mElement
+	return i1.mType == i2.mType
+			&& i1.mUuid == i2.mUuid
 			&& i1.mId == i2.mId;
 }
 
@@ -138,20 +154,13 @@ inline bool operator!=(const Id &i1, const Id &i2)
 	return !(i1 == i2);
 }
 
-/// Comparison operator for using Id in maps
-inline bool operator<(const Id &i1, const Id &i2)
-{
-	// Faster implementation then just comapring toString().
-	return i1.mEditor != i2.mEditor ? i1.mEditor < i2.mEditor
-			: i1.mDiagram != i2.mDiagram ? i1.mDiagram < i2.mDiagram
-			: i1.mElement != i2.mElement ? i1.mElement < i2.mElement
-			: i1.mId < i2.mId;
-}
+/// Comparison operator for using Id in maps. Ids are ordered the same way as their parts as strings.
+QRKERNEL_EXPORT bool operator<(const Id &i1, const Id &i2);
 
 /// Hash function for Id for using it in QHash.
 inline uint qHash(const Id &key)
 {
-	return qHash(key.mEditor) ^ qHash(key.mDiagram) ^ qHash(key.mElement) ^ qHash(key.mId);
+	return ::qHash(key.mType) ^ qHash(key.mUuid) ^ qHash(key.mId);
 }
 
 /// Operator for printing Id in QDebug.
@@ -14,7 +14,11 @@
 
 #include "folderCompressor.h"
 
+#include <QtCore/QBuffer>
 #include <QtCore/QDataStream>
+#include <QtCore/QSet>
+
+#include <zlib.h>
 
 #include "exceptions/corruptSavefileException.h"
 #include "exceptions/couldNotCreateDestinationFolderException.h"
@@ -27,8 +31,12 @@
 
 #ifdef TS_USE_SYSTEM_QUAZIP
 #include "quazip5/JlCompress.h"
+#include "quazip5/quazip.h"
+#include "quazip5/quazipfile.h"
 #else
 #include "quazip/JlCompress.h"
+#include "quazip/quazip.h"
+#include "quazip/quazipfile.h"
 #endif
 
 using namespace qrRepo;
@@ -65,35 +73,160 @@ void FolderCompressor::decompressFolder(const QString &sourceFile, const QString
 	}
 }
 
-void FolderCompressor::decompressFolderOld(const QString &sourceFile, const QString &destinationFolder)
+void FolderCompressor::compressFiles(const QMap<QString, QByteArray> &files, const QString &destinationFile)
 {
-	QDir dir;
-	if (!dir.mkpath(destinationFolder)) {
-		throw CouldNotCreateDestinationFolderException(destinationFolder);
+	QMap<QString, CompressedFile> compressedFiles;
+	for (auto file = files.cbegin(); file != files.cend(); ++file) {
+		compressedFiles[file.key()] = compress(file.value());
+	}
+
+	compressFiles(compressedFiles, destinationFile);
+}
+
+void FolderCompressor::compressFiles(const QMap<QString, CompressedFile> &files, const QString &destinationFile)
+{
+	// The archive is assembled in memory and then written to disk at once.
+	QBuffer buffer;
+	QuaZip zip(&buffer);
+	if (!zip.open(QuaZip::mdCreate)) {
+		throw CouldNotCreateOutFileException(destinationFile);
+	}
+
+	QSet<QString> directories;
+	QuaZipFile zipFile(&zip);
+	const auto closeEntry = [&zipFile, &destinationFile]() {
+		zipFile.close();
+		if (zipFile.getZipError() != ZIP_OK) {
+			throw CouldNotCreateOutFileException(destinationFile);
+		}
+	};
+
+	for (auto file = files.cbegin(); file != files.cend(); ++file) {
+		// JlCompress::compressDir() stores separate entries for subfolders, doing the same for compatibility.
+		for (int separator = file.key().indexOf('/'); separator > 0
+				; separator = file.key().indexOf('/', separator + 1))
+		{
+			const QString directory = file.key().left(separator + 1);
+			if (!directories.contains(directory)) {
+				directories.insert(directory);
+				if (!zipFile.open(QIODevice::WriteOnly, QuaZipNewInfo(directory))) {
+					throw CouldNotCreateOutFileException(destinationFile);
+				}
+
+				closeEntry();
+			}
+		}
+
+		// Data is already deflated, so it is written in raw mode.
+		QuaZipNewInfo info(file.key());
+		info.uncompressedSize = file->size;
+		if (!zipFile.open(QIODevice::WriteOnly, info, nullptr, file->crc, Z_DEFLATED, Z_DEFAULT_COMPRESSION, true)
+				|| zipFile.write(file->data) != file->data.size()) {
+			throw CouldNotCreateOutFileException(destinationFile);
+		}
+
+		closeEntry();
+	}
+
+	zip.close();
+	if (zip.getZipError() != ZIP_OK) {
+		throw CouldNotCreateOutFileException(destinationFile);
 	}
 
+	QFile outFile(destinationFile);
+	if (!outFile.open(QIODevice::WriteOnly) || outFile.write(buffer.data()) != buffer.data().size()) {
+		throw CouldNotCreateOutFileException(destinationFile);
+	}
+}
+
+FolderCompressor::CompressedFile FolderCompressor::compress(const QByteArray &data)
+{
+	CompressedFile result;
+	result.size = static_cast<quint32>(data.size());
+	result.crc = static_cast<quint32>(crc32(0, reinterpret_cast<const Bytef *>(data.constData()), result.size));
+
+	// Zip archives store raw deflate streams without zlib header, hence negative window bits.
+	z_stream stream {};
+	if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+		throw QrRepoException("Could not compress file contents");
+	}
+
+	result.data.resize(static_cast<int>(deflateBound(&stream, result.size)));
+	stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data.constData()));
+	stream.avail_in = result.size;
+	stream.next_out = reinterpret_cast<Bytef *>(result.data.data());
+	stream.avail_out = static_cast<uInt>(result.data.size());
+	const int status = deflate(&stream, Z_FINISH);
+	result.data.resize(static_cast<int>(stream.total_out));
+	deflateEnd(&stream);
+	if (status != Z_STREAM_END) {
+		throw QrRepoException("Could not compress file contents");
+	}
+
+	return result;
+}
+
+QMap<QString, QByteArray> FolderCompressor::decompressFiles(const QString &sourceFile)
+{
 	QFile file(sourceFile);
+	if (!file.exists()) {
+		throw SaveFileNotFoundException(sourceFile);
+	}
+
 	if (!file.open(QIODevice::ReadOnly)) {
 		throw SaveFileNotReadableException(sourceFile);
 	}
 
-	QDataStream dataStream(&file);
+	QBuffer buffer;
+	buffer.setData(file.readAll());
+	file.close();
 
-	if (dataStream.atEnd()) {
-		throw CorruptSaveFileException(sourceFile);
+	QuaZip zip(&buffer);
+	if (!zip.open(QuaZip::mdUnzip) || zip.getEntriesCount() <= 0) {
+		return decompressFilesOld(buffer.data(), sourceFile);
 	}
 
-	while (!dataStream.atEnd()) {
-		QString fileName;
-		QByteArray data;
+	QMap<QString, QByteArray> result;
+	QuaZipFile zipFile(&zip);
+	for (bool hasNext = zip.goToFirstFile(); hasNext; hasNext = zip.goToNextFile()) {
+		const QString name = zip.getCurrentFileName();
+		if (name.endsWith('/')) {
+			// Entry for a folder, nothing to read here.
+			continue;
+		}
 
-		dataStream >> fileName >> data; // extract file name and data in order
+		if (!zipFile.open(QIODevice::ReadOnly)) {
+			throw SaveFileNotReadableException(sourceFile);
+		}
 
-		if (dataStream.status() != QDataStream::Ok) {
-			// file is in wrong format, metadata is corrupt
-			file.close();
+		result[name] = zipFile.readAll();
+		zipFile.close();
+		if (zipFile.getZipError() != UNZ_OK) {
 			throw CorruptSaveFileException(sourceFile);
 		}
+	}
+
+	zip.close();
+	return result;
+}
+
+void FolderCompressor::decompressFolderOld(const QString &sourceFile, const QString &destinationFolder)
+{
+	QDir dir;
+	if (!dir.mkpath(destinationFolder)) {
+		throw CouldNotCreateDestinationFolderException(destinationFolder);
+	}
+
+	QFile file(sourceFile);
+	if (!file.open(QIODevice::ReadOnly)) {
+		throw SaveFileNotReadableException(sourceFile);
+	}
+
+	const QMap<QString, QByteArray> files = decompressFilesOld(file.readAll(), sourceFile);
+	file.close();
+
+	for (auto it = files.cbegin(); it != files.cend(); ++it) {
+		const QString &fileName = it.key();
 
 		// create any needed folder
 		for (int i = fileName.length() - 1; i > 0; --i) {
@@ -106,20 +239,41 @@ void FolderCompressor::decompressFolderOld(const QString &sourceFile, const QStr
 
 		QFile outFile(destinationFolder + "/" + fileName);
 		if (!outFile.open(QIODevice::WriteOnly)) {
-			file.close();
 			throw CouldNotCreateOutFileException(outFile.fileName());
 		}
 
+		outFile.write(it.value());
+		outFile.close();
+	}
+}
+
+QMap<QString, QByteArray> FolderCompressor::decompressFilesOld(const QByteArray &archive, const QString &sourceFile)
+{
+	QDataStream dataStream(archive);
+
+	if (dataStream.atEnd()) {
+		throw CorruptSaveFileException(sourceFile);
+	}
+
+	QMap<QString, QByteArray> result;
+	while (!dataStream.atEnd()) {
+		QString fileName;
+		QByteArray data;
+
+		dataStream >> fileName >> data; // extract file name and data in order
+
+		if (dataStream.status() != QDataStream::Ok) {
+			// file is in wrong format, metadata is corrupt
+			throw CorruptSaveFileException(sourceFile);
+		}
+
 		const QByteArray uncompressedData = qUncompress(data);
 		if (uncompressedData.isEmpty()) {
-			file.close();
 			throw CorruptSaveFileException(sourceFile);
 		}
 
-		outFile.write(uncompressedData);
-		outFile.close();
+		result[QString(fileName).replace('\\', '/')] = uncompressedData;
 	}
 
-	file.close();
+	return result;
 }
-
@@ -16,6 +16,7 @@
 
 #include <QtCore/QFile>
 #include <QtCore/QDir>
+#include <QtCore/QMap>
 
 namespace qrRepo {
 namespace details {
@@ -24,6 +25,14 @@ namespace details {
 class FolderCompressor
 {
 public:
+	/// Contents of a single file compressed by compress() that can be stored into an archive as is.
+	struct CompressedFile
+	{
+		QByteArray data;
+		quint32 crc = 0;
+		quint32 size = 0;
+	};
+
 	/// A recursive function that scans all files inside the source folder
 	/// and serializes all files in a row of file names and compressed
 	/// binary data in a single file
@@ -35,11 +44,29 @@ public:
 	/// @returns true if operation was successful.
 	static void decompressFolder(const QString &sourceFile, const QString &destinationFolder);
 
+	/// Writes the given files into an archive of the same format as compressFolder() produces, but takes
+	/// their contents from memory, so nothing except the resulting archive is created on disk.
+	/// @param files Maps paths of files relative to archive root (separated by '/') to their contents.
+	static void compressFiles(const QMap<QString, QByteArray> &files, const QString &destinationFile);
+
+	/// Same as previous, but takes already compressed files, so they can be compressed once and then stored into
+	/// many archives.
+	static void compressFiles(const QMap<QString, CompressedFile> &files, const QString &destinationFile);
+
+	/// Compresses contents of a file for storing it into an archive by compressFiles().
+	static CompressedFile compress(const QByteArray &data);
+
+	/// Reads all files from the given archive into memory without extracting them on disk.
+	/// Archives in old format are supported too.
+	/// @returns a map from paths of files relative to archive root (separated by '/') to their contents.
+	static QMap<QString, QByteArray> decompressFiles(const QString &sourceFile);
+
 private:
 	/// Creating is prohibited, utility class instances can not be created.
 	FolderCompressor() = delete;
 
 	static void decompressFolderOld(const QString &sourceFile, const QString &destinationFolder);
+	static QMap<QString, QByteArray> decompressFilesOld(const QByteArray &archive, const QString &sourceFile);
 };
 
 }
@@ -21,6 +21,20 @@ using namespace qReal;
 using namespace qrRepo;
 using namespace qrRepo::details;
 
+/// Name of the property indexed by value to speed up search by name.
+static const QString nameProperty = "name";
+
+static void removeFromIndex(QHash<QString, QSet<Id>> &index, const QString &key, const Id &id)
+{
+	auto it = index.find(key);
+	if (it != index.end()) {
+		it->remove(id);
+		if (it->isEmpty()) {
+			index.erase(it);
+		}
+	}
+}
+
 Repository::Repository(const QString &workingFile)
 		: mWorkingFile(workingFile)
 		, mSerializer(workingFile)
@@ -33,7 +47,9 @@ void Repository::resetToEmpty()
 	qDeleteAll(mObjects);
 	mObjects.clear();
 	mObjects.insert(Id::rootId(), new LogicalObject(Id::rootId()));
-	mObjects[Id::rootId()]->setProperty("name", Id::rootId().toString());
+	mObjects[Id::rootId()]->setProperty(nameProperty, Id::rootId().toString());
+	rebuildIndexes();
+	mSerializer.invalidateAll();
 }
 
 Repository::~Repository()
@@ -54,18 +70,16 @@ IdList Repository::findElementsByName(const QString &name, bool sensitivity, boo
 	const QRegExp regExp(name, caseSensitivity);
 	IdList result;
 
-	if (regExpression){
-		for (Object * const element : mObjects.values()) {
-			if (element->property("name").toString().contains(regExp)
-					&& !isLogicalId(mObjects.key(element))) {
-				result.append(mObjects.key(element));
-			}
-		}
-	} else {
-		for (Object * const element : mObjects.values()) {
-			if (element->property("name").toString().contains(name, caseSensitivity)
-					&& !isLogicalId(mObjects.key(element))) {
-				result.append(mObjects.key(element));
+	// Many elements share the same name, so each distinct name is matched only once.
+	for (auto it = mIdsByName.cbegin(); it != mIdsByName.cend(); ++it) {
+		const bool matches = regExpression
+				? it.key().contains(regExp)
+				: it.key().contains(name, caseSensitivity);
+		if (matches) {
+			for (const Id &id : it.value()) {
+				if (!isLogicalId(id)) {
+					result.append(id);
+				}
 			}
 		}
 	}
@@ -76,12 +90,28 @@ IdList Repository::findElementsByName(const QString &name, bool sensitivity, boo
 qReal::IdList Repository::elementsByProperty(const QString &property, bool sensitivity
 		, bool regExpression) const
 {
-	IdList result;
+	const Qt::CaseSensitivity caseSensitivity = sensitivity ? Qt::CaseSensitive : Qt::CaseInsensitive;
+
+	// Same matching rules as in Object::hasProperty(), but applied to each distinct property name only once.
+	QSet<Id> found;
+	if (!regExpression && sensitivity) {
+		found = mIdsByProperty.value(property);
+	} else {
+		const QRegExp regExp(property, caseSensitivity);
+		for (auto it = mIdsByProperty.cbegin(); it != mIdsByProperty.cend(); ++it) {
+			const bool matches = regExpression
+					? it.key().contains(regExp)
+					: it.key().compare(property, caseSensitivity) == 0;
+			if (matches) {
+				found.unite(it.value());
+			}
+		}
+	}
 
-	for (Object *element : mObjects.values()) {
-		if ((element->hasProperty(property, sensitivity, regExpression))
-				&& (!isLogicalId(mObjects.key(element)))) {
-			result.append(mObjects.key(element));
+	IdList result;
+	for (const Id &id : found) {
+		if (!isLogicalId(id)) {
+			result.append(id);
 		}
 	}
 
@@ -96,19 +126,19 @@ qReal::IdList Repository::elementsByPropertyContent(const QString &propertyValue
 	const QRegExp regExp(propertyValue, caseSensitivity);
 	IdList result;
 
-	for (Object * const element : mObjects.values()) {
-		QMapIterator<QString, QVariant> iterator = element->propertiesIterator();
+	for (auto element = mObjects.cbegin(); element != mObjects.cend(); ++element) {
+		QMapIterator<QString, QVariant> iterator = element.value()->propertiesIterator();
 		if (regExpression) {
 			while (iterator.hasNext()) {
 				if (iterator.next().value().toString().contains(regExp)) {
-					result.append(mObjects.key(element));
+					result.append(element.key());
 					break;
 				}
 			}
 		} else {
 			while (iterator.hasNext()) {
 				if (iterator.next().value().toString().contains(propertyValue, caseSensitivity)) {
-					result.append(mObjects.key(element));
+					result.append(element.key());
 					break;
 				}
 			}
@@ -121,7 +151,11 @@ qReal::IdList Repository::elementsByPropertyContent(const QString &propertyValue
 void Repository::replaceProperties(const qReal::IdList &toReplace, const QString &value, const QString &newValue)
 {
 	for (const qReal::Id &currentId : toReplace) {
-		mObjects[currentId]->replaceProperties(value, newValue);
+		Object * const object = mObjects[currentId];
+		removeFromIndexes(object);
+		object->replaceProperties(value, newValue);
+		addToIndexes(object);
+		mSerializer.invalidate(currentId);
 	}
 }
 
@@ -146,6 +180,11 @@ Id Repository::parent(const Id &id) const
 Id Repository::cloneObject(const qReal::Id &id)
 {
 	const Object * const result = mObjects[id]->clone(mObjects);
+	for (const Object * const object : allChildrenOf(result->id())) {
+		addToIndexes(object);
+		mSerializer.invalidate(object->id());
+	}
+
 	return result->id();
 }
 
@@ -156,6 +195,8 @@ void Repository::setParent(const Id &id, const Id &parent)
 			mObjects[id]->setParent(parent);
 			if (!mObjects[parent]->children().contains(id))
 				mObjects[parent]->addChild(id);
+			mSerializer.invalidate(id);
+			mSerializer.invalidate(parent);
 		} else {
 			throw Exception("Repository: Adding nonexistent parent " + parent.toString()
 					+ " to  object " + id.toString());
@@ -187,7 +228,11 @@ void Repository::addChild(const Id &id, const Id &child, const Id &logicalId)
 			object->setParent(id);
 
 			mObjects.insert(child, object);
+			addToIndexes(object);
 		}
+
+		mSerializer.invalidate(id);
+		mSerializer.invalidate(child);
 	} else {
 		throw Exception("Repository: Adding child " + child.toString() + " to nonexistent object " + id.toString());
 	}
@@ -207,6 +252,7 @@ void Repository::stackBefore(const qReal::Id &id, const qReal::Id &child, const
 	}
 
 	mObjects[id]->stackBefore(child, sibling);
+	mSerializer.invalidate(id);
 }
 
 void Repository::removeParent(const Id &id)
@@ -216,6 +262,8 @@ void Repository::removeParent(const Id &id)
 		if (mObjects.contains(parent)) {
 			mObjects[id]->setParent(Id());
 			mObjects[parent]->removeChild(id);
+			mSerializer.invalidate(id);
+			mSerializer.invalidate(parent);
 		} else {
 			throw Exception("Repository: Removing nonexistent parent " + parent.toString()
 					+ " from object " + id.toString());
@@ -230,6 +278,7 @@ void Repository::removeChild(const Id &id, const Id &child)
 	if (mObjects.contains(id)) {
 		if (mObjects.contains(child)) {
 			mObjects[id]->removeChild(child);
+			mSerializer.invalidate(id);
 		} else {
 			throw Exception("Repository: removing nonexistent child " + child.toString()
 					+ " from object " + id.toString());
@@ -246,7 +295,18 @@ void Repository::setProperty(const Id &id, const QString &name, const QVariant &
 //		Q_ASSERT(mObjects[id]->hasProperty(name)
 //				 ? mObjects[id]->property(name).userType() == value.userType()
 //				 : true);
-		mObjects[id]->setProperty(name, value);
+		Object * const object = mObjects[id];
+		if (name == nameProperty) {
+			removeFromIndex(mIdsByName, object->property(nameProperty).toString(), id);
+		}
+
+		object->setProperty(name, value);
+		mIdsByProperty[name].insert(id);
+		if (name == nameProperty) {
+			mIdsByName[object->property(nameProperty).toString()].insert(id);
+		}
+
+		mSerializer.invalidate(id);
 	} else {
 		throw Exception("Repository: Setting property " + name + " of nonexistent object " + id.toString());
 	}
@@ -254,7 +314,11 @@ void Repository::setProperty(const Id &id, const QString &name, const QVariant &
 
 void Repository::copyProperties(const Id &dest, const Id &src)
 {
-	mObjects[dest]->copyPropertiesFrom(*mObjects[src]);
+	Object * const object = mObjects[dest];
+	removeFromIndexes(object);
+	object->copyPropertiesFrom(*mObjects[src]);
+	addToIndexes(object);
+	mSerializer.invalidate(dest);
 }
 
 QMap<QString, QVariant> Repository::properties(const Id &id) const
@@ -264,7 +328,11 @@ QMap<QString, QVariant> Repository::properties(const Id &id) const
 
 void Repository::setProperties(const Id &id, QMap<QString, QVariant> const &properties)
 {
-	mObjects[id]->setProperties(properties);
+	Object * const object = mObjects[id];
+	removeFromIndexes(object);
+	object->setProperties(properties);
+	addToIndexes(object);
+	mSerializer.invalidate(id);
 }
 
 QVariant Repository::property(const Id &id, const QString &name) const
@@ -279,7 +347,16 @@ QVariant Repository::property(const Id &id, const QString &name) const
 void Repository::removeProperty(const Id &id, const QString &name)
 {
 	if (mObjects.contains(id)) {
-		return mObjects[id]->removeProperty(name);
+		Object * const object = mObjects[id];
+		const QString oldName = object->property(nameProperty).toString();
+		object->removeProperty(name);
+		removeFromIndex(mIdsByProperty, name, id);
+		if (name == nameProperty) {
+			removeFromIndex(mIdsByName, oldName, id);
+			mIdsByName[QString()].insert(id);
+		}
+
+		mSerializer.invalidate(id);
 	} else {
 		throw Exception("Repository: Removing property of nonexistent object " + id.toString());
 	}
@@ -300,6 +377,8 @@ void Repository::setBackReference(const Id &id, const Id &reference) const
 	if (mObjects.contains(id)) {
 		if (mObjects.contains(reference)) {
 			mObjects[id]->setBackReference(reference);
+			mIdsByProperty["backReferences"].insert(id);
+			mSerializer.invalidate(id);
 		} else {
 			throw Exception("Repository: setting nonexistent back reference " + reference.toString()
 							+ " to object " + id.toString());
@@ -314,6 +393,7 @@ void Repository::removeBackReference(const Id &id, const Id &reference) const
 	if (mObjects.contains(id)) {
 		if (mObjects.contains(reference)) {
 			mObjects[id]->removeBackReference(reference);
+			mSerializer.invalidate(id);
 		} else {
 			throw Exception("Repository: removing nonexistent back reference " + reference.toString()
 							+ " of object " + id.toString());
@@ -327,6 +407,7 @@ void Repository::setTemporaryRemovedLinks(const Id &id, const QString &direction
 {
 	if (mObjects.contains(id)) {
 		mObjects[id]->setTemporaryRemovedLinks(direction, linkIdList);
+		mSerializer.invalidate(id);
 	} else {
 		throw Exception("Repository: Setting temporaryRemovedLinks of nonexistent object " + id.toString());
 	}
@@ -353,7 +434,13 @@ IdList Repository::temporaryRemovedLinks(const Id &id) const
 void Repository::removeTemporaryRemovedLinks(const Id &id)
 {
 	if (mObjects.contains(id)) {
-		return mObjects[id]->removeTemporaryRemovedLinks();
+		// For every direction that has temporary removed links the object also drops the property named after
+		// that direction ("from", "to"), so the object is reindexed by its remaining properties.
+		Object * const object = mObjects[id];
+		removeFromIndexes(object);
+		object->removeTemporaryRemovedLinks();
+		addToIndexes(object);
+		mSerializer.invalidate(id);
 	} else {
 		throw Exception("Repository: Removing temporaryRemovedLinks of nonexistent object " + id.toString());
 	}
@@ -367,6 +454,7 @@ void Repository::loadFromDisk()
 		resetToEmpty();
 	}
 	addChildrenToRootObject();
+	rebuildIndexes();
 }
 
 void Repository::importFromDisk(const QString &importedFile)
@@ -382,6 +470,7 @@ void Repository::addChildrenToRootObject()
 		if (object->parent() == Id::rootId()) {
 			if (!mObjects[Id::rootId()]->children().contains(object->id())) {
 				mObjects[Id::rootId()]->addChild(object->id());
+				mSerializer.invalidate(Id::rootId());
 			}
 		}
 	}
@@ -424,6 +513,35 @@ QList<Object*> Repository::allChildrenOfWithLogicalId(const Id &id) const
 	return result;
 }
 
+void Repository::addToIndexes(const Object *object) const
+{
+	const Id id = object->id();
+	mIdsByName[object->property(nameProperty).toString()].insert(id);
+	QMapIterator<QString, QVariant> iterator = object->propertiesIterator();
+	while (iterator.hasNext()) {
+		mIdsByProperty[iterator.next().key()].insert(id);
+	}
+}
+
+void Repository::removeFromIndexes(const Object *object) const
+{
+	const Id id = object->id();
+	removeFromIndex(mIdsByName, object->property(nameProperty).toString(), id);
+	QMapIterator<QString, QVariant> iterator = object->propertiesIterator();
+	while (iterator.hasNext()) {
+		removeFromIndex(mIdsByProperty, iterator.next().key(), id);
+	}
+}
+
+void Repository::rebuildIndexes()
+{
+	mIdsByName.clear();
+	mIdsByProperty.clear();
+	for (const Object * const object : mObjects) {
+		addToIndexes(object);
+	}
+}
+
 bool Repository::exist(const Id &id) const
 {
 	return (mObjects[id] != nullptr);
@@ -489,8 +607,10 @@ void Repository::remove(const IdList &list) const
 void Repository::remove(const qReal::Id &id)
 {
 	if (mObjects.contains(id)) {
+		removeFromIndexes(mObjects[id]);
 		delete mObjects[id];
 		mObjects.remove(id);
+		mSerializer.invalidate(id);
 	} else {
 		throw Exception("Repository: Trying to remove nonexistent object " + id.toString());
 	}
@@ -541,6 +661,9 @@ void Repository::open(const QString &saveFile)
 {
 	qDeleteAll(mObjects);
 	mObjects.clear();
+	mIdsByName.clear();
+	mIdsByProperty.clear();
+	mSerializer.invalidateAll();
 	mSerializer.setWorkingFile(saveFile);
 	mWorkingFile = saveFile;
 	loadFromDisk();
@@ -579,6 +702,7 @@ void Repository::createGraphicalPart(const qReal::Id &id, int partIndex)
 	}
 
 	graphicalObject->createGraphicalPart(partIndex);
+	mSerializer.invalidate(id);
 }
 
 QList<int> Repository::graphicalParts(const qReal::Id &id) const
@@ -614,6 +738,7 @@ void Repository::setGraphicalPartProperty(
 	}
 
 	graphicalObject->setGraphicalPartProperty(partIndex, propertyName, value);
+	mSerializer.invalidate(id);
 }
 
 QStringList Repository::metaInformationKeys() const
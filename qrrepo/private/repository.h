@@ -15,6 +15,7 @@
 #pragma once
 
 #include <QtCore/QHash>
+#include <QtCore/QSet>
 
 #include <qrkernel/definitions.h>
 #include <qrkernel/ids.h>
@@ -168,7 +169,22 @@ private:
 	QList<Object*> allChildrenOf(const qReal::Id &id) const;
 	QList<Object*> allChildrenOfWithLogicalId(const qReal::Id &id) const;
 
+	/// Registers the given object in secondary indexes used by search methods.
+	void addToIndexes(const Object *object) const;
+
+	/// Forgets the given object in secondary indexes used by search methods.
+	void removeFromIndexes(const Object *object) const;
+
+	/// Builds secondary indexes from scratch, used after bulk modifications like loading from disk.
+	void rebuildIndexes();
+
 	QHash<qReal::Id, Object *> mObjects;
+
+	/// Ids of objects by the value of their "name" property, objects without name are stored by empty string.
+	mutable QHash<QString, QSet<qReal::Id>> mIdsByName;
+
+	/// Ids of objects by names of properties they have.
+	mutable QHash<QString, QSet<qReal::Id>> mIdsByProperty;
 	QHash<QString, QVariant> mMetaInfo;
 
 	/// Name of the current save file for project.
@@ -21,9 +21,6 @@
 
 #include <qrkernel/platformInfo.h>
 #include <qrkernel/exception/exception.h>
-#include <qrutils/outFile.h>
-#include <qrutils/inFile.h>
-#include <qrutils/xmlUtils.h>
 #include <qrutils/fileSystemUtils.h>
 
 #include "folderCompressor.h"
@@ -82,24 +79,26 @@ bool Serializer::saveToDisk(QList<Object *> const &objects, QHash<QString, QVari
 		, "Serializer::saveToDisk(...)"
 		, "may be Repository of RepoApi (see Models constructor also) has been initialised with empty filename?");
 
-	clearWorkingDir();
+	// Save contents are kept in memory and written directly into the archive.
+	QMap<QString, FolderCompressor::CompressedFile> files;
 	for (const Object * const object : objects) {
-		const QString filePath = createDirectory(object->id(), object->isLogicalObject());
+		auto saved = mSavedObjects.constFind(object->id());
+		if (saved == mSavedObjects.cend()) {
+			QDomDocument doc;
+			QDomElement root = object->serialize(doc);
+			doc.appendChild(root);
 
-		QDomDocument doc;
-		QDomElement root = object->serialize(doc);
-		doc.appendChild(root);
+			saved = mSavedObjects.insert(object->id(), FolderCompressor::compress(doc.toByteArray(2)));
+		}
 
-		OutFile out(filePath);
-		doc.save(out(), 2);
+		files[pathInSave(object->id(), object->isLogicalObject())] = saved.value();
 	}
 
-	saveMetaInfo(metaInfo);
+	saveMetaInfo(metaInfo, files);
 
 	const QFileInfo fileInfo(mWorkingFile);
 	const QString fileName = fileInfo.completeBaseName();
 
-	const QDir compressDir(mWorkingDir);
 	const QDir dir = fileInfo.absolutePath();
 
 	QFile previousSave(dir.absolutePath() + "/" + fileName +".qrs");
@@ -109,7 +108,7 @@ bool Serializer::saveToDisk(QList<Object *> const &objects, QHash<QString, QVari
 
 	const QString filePath = fileInfo.absolutePath() + "/" + fileName + ".qrs";
 	try {
-		FolderCompressor::compressFolder(compressDir.absolutePath(), filePath);
+		FolderCompressor::compressFiles(files, filePath);
 	} catch (...) {
 		return false;
 	}
@@ -119,67 +118,60 @@ bool Serializer::saveToDisk(QList<Object *> const &objects, QHash<QString, QVari
 		FileSystemUtils::makeHidden(filePath);
 	}
 
-	clearWorkingDir();
-
 	return true;
 }
 
 void Serializer::loadFromDisk(QHash<qReal::Id, Object*> &objectsHash, QHash<QString, QVariant> &metaInfo)
 {
-	clearWorkingDir();
+	QMap<QString, QByteArray> files;
 	if (QFileInfo::exists(mWorkingFile)) {
-		decompressFile(mWorkingFile);
+		files = FolderCompressor::decompressFiles(mWorkingFile);
 	}
 
-	loadFromDisk(mWorkingDir, objectsHash);
-	loadMetaInfo(metaInfo);
+	loadModel("tree/logical/", files, objectsHash);
+	loadModel("tree/graphical/", files, objectsHash);
+	loadMetaInfo(files, metaInfo);
 }
 
-void Serializer::loadFromDisk(const QString &currentPath, QHash<qReal::Id, Object*> &objectsHash)
+void Serializer::loadModel(const QString &prefix, const QMap<QString, QByteArray> &files
+		, QHash<qReal::Id, Object*> &objectsHash)
 {
-	QDir dir(currentPath + "/tree");
-	if (dir.cd("logical")) {
-		loadModel(dir, objectsHash);
-		dir.cdUp();
-		dir.cd("graphical");
-		loadModel(dir, objectsHash);
-	}
-}
-
-void Serializer::loadModel(const QDir &dir, QHash<qReal::Id, Object*> &objectsHash)
-{
-	for (const QFileInfo &fileInfo : dir.entryInfoList(QDir::AllEntries | QDir::NoDotAndDotDot)) {
-		const QString path = fileInfo.filePath();
-		if (fileInfo.isDir()) {
-			loadModel(path, objectsHash);
-		} else if (fileInfo.isFile()) {
-			QDomDocument doc = xmlUtils::loadDocument(path);
-			const QDomElement element = doc.documentElement();
-
-			// To ensure backwards compatibility. Replace this by separate tag names when save updating mechanism
-			// will be implemented.
-			Object * const object = element.hasAttribute("logicalId") && element.attribute("logicalId") != "qrm:/"
-					? dynamic_cast<Object *>(new GraphicalObject(element))
-					: dynamic_cast<Object *>(new LogicalObject(element))
-					;
-
-			auto &old = objectsHash[object->id()];
-			delete old;
-			old = object;
-		}
+	// Files are sorted by path, so all files from the given folder are together.
+	for (auto file = files.lowerBound(prefix); file != files.cend() && file.key().startsWith(prefix); ++file) {
+		QDomDocument doc;
+		doc.setContent(file.value());
+		const QDomElement element = doc.documentElement();
+
+		// To ensure backwards compatibility. Replace this by separate tag names when save updating mechanism
+		// will be implemented.
+		Object * const object = element.hasAttribute("logicalId") && element.attribute("logicalId") != "qrm:/"
+				? dynamic_cast<Object *>(new GraphicalObject(element))
+				: dynamic_cast<Object *>(new LogicalObject(element))
+				;
+
+		auto &old = objectsHash[object->id()];
+		delete old;
+		old = object;
+		mSavedObjects.remove(object->id());
 	}
 }
 
-void Serializer::saveMetaInfo(QHash<QString, QVariant> const &metaInfo) const
+void Serializer::saveMetaInfo(QHash<QString, QVariant> const &metaInfo
+		, QMap<QString, FolderCompressor::CompressedFile> &files) const
 {
 	QDomDocument document;
 	QDomElement root = document.createElement("metaInformation");
 	document.appendChild(root);
 	for (const QString &key : metaInfo.keys()) {
 		if (mFileNames.contains(key)) {
-			const QString filePath = mWorkingDir + "/" + key + ".xml";
-			OutFile out(filePath);
-			out() << ValuesSerializer::serializeQVariant(metaInfo[key]);
+			// Files with meta-information may be large, so they are compressed again only when changed.
+			const QString fileName = key + ".xml";
+			if (!mSavedMetaInfoFiles.contains(fileName) || mSavedMetaInfo.value(key) != metaInfo[key]) {
+				mSavedMetaInfoFiles[fileName] = FolderCompressor::compress(
+						ValuesSerializer::serializeQVariant(metaInfo[key]).toUtf8());
+			}
+
+			files[fileName] = mSavedMetaInfoFiles[fileName];
 		} else {
 			QDomElement element = document.createElement("info");
 			element.setAttribute("key", key);
@@ -189,20 +181,20 @@ void Serializer::saveMetaInfo(QHash<QString, QVariant> const &metaInfo) const
 		}
 	}
 
-	OutFile meta(mWorkingDir + "/metaInfo.xml");
-	meta() << document.toString(4);
+	files["metaInfo.xml"] = FolderCompressor::compress(document.toString(4).toUtf8());
+	mSavedMetaInfo = metaInfo;
 }
 
-void Serializer::loadMetaInfo(QHash<QString, QVariant> &metaInfo) const
+void Serializer::loadMetaInfo(const QMap<QString, QByteArray> &files, QHash<QString, QVariant> &metaInfo) const
 {
 	metaInfo.clear();
 
-	const QString filePath = mWorkingDir + "/metaInfo.xml";
-	if (!QFile::exists(filePath)) {
+	if (!files.contains("metaInfo.xml")) {
 		return;
 	}
 
-	const QDomDocument document = xmlUtils::loadDocument(filePath);
+	QDomDocument document;
+	document.setContent(files["metaInfo.xml"]);
 	for (QDomElement child = document.documentElement().firstChildElement("info")
 			; !child.isNull()
 			; child = child.nextSiblingElement("info"))
@@ -212,46 +204,50 @@ void Serializer::loadMetaInfo(QHash<QString, QVariant> &metaInfo) const
 	}
 
 	for (const auto & file : mFileNames) {
-		const QString path = mWorkingDir + "/" + file + ".xml";
-		if (!QFile::exists(path)) {
+		const QString path = file + ".xml";
+		if (!files.contains(path)) {
 			continue;
 		}
-		metaInfo[file] = InFile::readAll(path);
+		metaInfo[file] = QString::fromUtf8(files[path]);
 	}
 }
 
 QString Serializer::pathToElement(const Id &id) const
 {
-	QString dirName = mWorkingDir;
-
-	QStringList partsList = id.toString().split('/');
-	Q_ASSERT(partsList.size() >=1 && partsList.size() <= 5);
-	for (int i = 1; i < partsList.size() - 1; ++i) {
-		dirName += "/" + partsList[i];
-	}
-
-	return dirName + "/" + partsList[partsList.size() - 1];
+	return mWorkingDir + "/" + idPath(id);
 }
 
-QString Serializer::createDirectory(const Id &id, bool logical) const
+QString Serializer::pathInSave(const Id &id, bool logical) const
 {
-	QString dirName = mWorkingDir + "/tree";
-	dirName += logical ? "/logical" : "/graphical";
+	return (logical ? "tree/logical/" : "tree/graphical/") + idPath(id);
+}
 
-	const QStringList partsList = id.toString().split('/');
-	Q_ASSERT(partsList.size() >= 1 && partsList.size() <= 5);
-	for (int i = 1; i < partsList.size() - 1; ++i) {
-		dirName += "/" + partsList[i];
+QString Serializer::idPath(const Id &id)
+{
+	// Parts of an id are taken directly, building its string representation and splitting it is much slower.
+	switch (id.idSize()) {
+	case 4:
+		return id.editor() + "/" + id.diagram() + "/" + id.element() + "/" + id.id();
+	case 3:
+		return id.editor() + "/" + id.diagram() + "/" + id.element();
+	case 2:
+		return id.editor() + "/" + id.diagram();
+	default:
+		return id.editor();
 	}
-
-	QDir dir;
-	dir.rmdir(mWorkingDir);
-	dir.mkpath(dirName);
-
-	return dirName + "/" + partsList[partsList.size() - 1];
 }
 
 void Serializer::decompressFile(const QString &fileName)
 {
 	FolderCompressor::decompressFolder(fileName, mWorkingDir);
 }
+
+void Serializer::invalidate(const Id &id) const
+{
+	mSavedObjects.remove(id);
+}
+
+void Serializer::invalidateAll() const
+{
+	mSavedObjects.clear();
+}
@@ -16,12 +16,14 @@
 
 #include <QtXml/QDomDocument>
 #include <QtCore/QVariant>
+#include <QtCore/QMap>
 #include <QtCore/QFile>
 #include <QtCore/QDir>
 
 #include <qrkernel/roles.h>
 
 #include "classes/object.h"
+#include "folderCompressor.h"
 #include "valuesSerializer.h"
 
 namespace qrRepo {
@@ -43,25 +45,47 @@ public:
 	void removeFromDisk(const qReal::Id &id) const;
 
 	/// Returns true if saving was successfull.
+	/// Objects are serialized only if they were not saved before or were invalidated since that, so invalidate()
+	/// must be called for each modified object.
 	bool saveToDisk(QList<Object *> const &objects, QHash<QString, QVariant> const &metaInfo) const;
 	void loadFromDisk(QHash<qReal::Id, Object *> &objectsHash, QHash<QString, QVariant> &metaInfo);
 
 	/// Decompresses given file into working directory.
 	void decompressFile(const QString &fileName);
 
+	/// Forgets saved contents of the given object, so it will be serialized again on next save.
+	void invalidate(const qReal::Id &id) const;
+
+	/// Forgets saved contents of all objects.
+	void invalidateAll() const;
+
 private:
-	void loadFromDisk(const QString &currentPath, QHash<qReal::Id, Object *> &objectsHash);
-	void loadModel(const QDir &dir, QHash<qReal::Id, Object *> &objectsHash);
+	/// Loads objects from all files in the save whose paths start with the given prefix.
+	void loadModel(const QString &prefix, const QMap<QString, QByteArray> &files
+			, QHash<qReal::Id, Object *> &objectsHash);
 
-	void saveMetaInfo(const QHash<QString, QVariant> &metaInfo) const;
-	void loadMetaInfo(QHash<QString, QVariant> &metaInfo) const;
+	void saveMetaInfo(const QHash<QString, QVariant> &metaInfo
+			, QMap<QString, FolderCompressor::CompressedFile> &files) const;
+	void loadMetaInfo(const QMap<QString, QByteArray> &files, QHash<QString, QVariant> &metaInfo) const;
 
 	QString pathToElement(const qReal::Id &id) const;
-	QString createDirectory(const qReal::Id &id, bool logical) const;
+
+	/// Returns a path of the file with the given object relative to the root of the save.
+	QString pathInSave(const qReal::Id &id, bool logical) const;
+
+	/// Returns non-empty parts of a given id joined by "/".
+	static QString idPath(const qReal::Id &id);
 
 	const QStringList mFileNames {"worldModel", "blobs"};
 	QString mWorkingDir;
 	QString mWorkingFile;
+
+	/// Compressed contents of objects that were not modified since they were saved last time.
+	mutable QHash<qReal::Id, FolderCompressor::CompressedFile> mSavedObjects;
+
+	/// Meta-information saved last time and compressed files with it, only changed files are compressed again.
+	mutable QHash<QString, QVariant> mSavedMetaInfo;
+	mutable QMap<QString, FolderCompressor::CompressedFile> mSavedMetaInfoFiles;
 };
 
 }
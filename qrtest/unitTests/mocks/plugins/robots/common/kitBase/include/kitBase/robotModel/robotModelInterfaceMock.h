@@ -47,6 +47,7 @@ public:
 	MOCK_CONST_METHOD0(needsConnection, bool());
 
 	MOCK_CONST_METHOD0(updateSensorsValues, void());
+	MOCK_CONST_METHOD1(updateSensorsValuesOnPorts, void(const QList<kitBase::robotModel::PortInfo> &ports));
 	MOCK_CONST_METHOD0(updateIntervalForInterpretation, int());
 
 
@@ -0,0 +1,43 @@
+# Copyright 2016 QReal Research Group
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+TARGET = robots_checker_unittests
+
+include(../../../common.pri)
+
+links(qrkernel qrutils)
+
+CHECKER_DIR = $$PWD/../../../../../plugins/robots/checker
+
+INCLUDEPATH += \
+	$$CHECKER_DIR/twoDModelRunner \
+	$$CHECKER_DIR/trajectoryConverter \
+
+# Tests
+SOURCES += \
+	$$PWD/trajectoryTest.cpp \
+	$$PWD/reportMergerTest.cpp \
+
+# Tested classes are parts of checker applications, so they are compiled into tests.
+HEADERS += \
+	$$CHECKER_DIR/twoDModelRunner/reporter.h \
+	$$CHECKER_DIR/twoDModelRunner/reportMerger.h \
+	$$CHECKER_DIR/twoDModelRunner/trajectoryWriter.h \
+	$$CHECKER_DIR/trajectoryConverter/trajectoryReader.h \
+
+SOURCES += \
+	$$CHECKER_DIR/twoDModelRunner/reporter.cpp \
+	$$CHECKER_DIR/twoDModelRunner/reportMerger.cpp \
+	$$CHECKER_DIR/twoDModelRunner/trajectoryWriter.cpp \
+	$$CHECKER_DIR/trajectoryConverter/trajectoryReader.cpp \
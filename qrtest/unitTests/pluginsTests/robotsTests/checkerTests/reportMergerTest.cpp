@@ -0,0 +1,101 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QTemporaryDir>
+
+#include <reportMerger.h>
+
+#include "gtest/gtest.h"
+
+using namespace twoDModel;
+
+class ReportMergerTest : public testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		ASSERT_TRUE(mDirectory.isValid());
+		ASSERT_TRUE(QDir(mDirectory.path()).mkdir("reports"));
+		for (int i = 0; i < 4; ++i) {
+			const QString field = QString("field%1").arg(i);
+			mFields << mDirectory.path() + "/fields/" + field + ".xml";
+			const QJsonArray messages = { QJsonObject{{ "level", "info" }, { "message", field }} };
+			QFile report(reportsFolder() + "/" + field);
+			ASSERT_TRUE(report.open(QIODevice::WriteOnly));
+			report.write(QJsonDocument(messages).toJson());
+		}
+	}
+
+	QString reportsFolder() const
+	{
+		return mDirectory.path() + "/reports";
+	}
+
+	/// Merges reports of fields finished in the given order and returns merged report contents.
+	QByteArray merge(const QList<QPair<int, int>> &finishedFields, const QString &fileName) const
+	{
+		ReportMerger merger(mFields, reportsFolder());
+		for (const auto &field : finishedFields) {
+			merger.addResult(field.first, field.second);
+		}
+
+		const QString path = mDirectory.path() + "/" + fileName;
+		merger.write(path);
+		QFile file(path);
+		return file.open(QIODevice::ReadOnly) ? file.readAll() : QByteArray();
+	}
+
+	QTemporaryDir mDirectory;
+	QStringList mFields;
+};
+
+TEST_F(ReportMergerTest, mergedReportDoesNotDependOnCompletionOrder)
+{
+	const QByteArray merged = merge({{0, 0}, {1, 1}, {2, 0}, {3, 0}}, "merged");
+	EXPECT_EQ(merged, merge({{3, 0}, {1, 1}, {0, 0}, {2, 0}}, "shuffled"));
+	EXPECT_EQ(merged, merge({{2, 0}, {3, 0}, {1, 1}, {0, 0}}, "reversed"));
+
+	const QJsonArray entries = QJsonDocument::fromJson(merged).array();
+	ASSERT_EQ(4, entries.size());
+	for (int i = 0; i < entries.size(); ++i) {
+		const QJsonObject entry = entries[i].toObject();
+		EXPECT_EQ(QString("field%1").arg(i), entry["field"].toString());
+		EXPECT_EQ(i == 1 ? 1 : 0, entry["exitCode"].toInt());
+		EXPECT_FALSE(entry.contains("cancelled"));
+		const QJsonArray messages = entry["messages"].toArray();
+		ASSERT_EQ(1, messages.size());
+		EXPECT_EQ(entry["field"].toString(), messages[0].toObject()["message"].toString());
+	}
+}
+
+TEST_F(ReportMergerTest, cancelledFieldsAreMarked)
+{
+	const QJsonArray entries = QJsonDocument::fromJson(merge({{2, 0}, {1, 1}}, "merged")).array();
+	ASSERT_EQ(4, entries.size());
+	for (const int cancelled : {0, 3}) {
+		const QJsonObject entry = entries[cancelled].toObject();
+		EXPECT_EQ(QString("field%1").arg(cancelled), entry["field"].toString());
+		EXPECT_TRUE(entry["cancelled"].toBool());
+		EXPECT_FALSE(entry.contains("exitCode"));
+	}
+
+	EXPECT_EQ(1, entries[1].toObject()["exitCode"].toInt());
+	EXPECT_FALSE(entries[2].toObject().contains("cancelled"));
+}
@@ -0,0 +1,248 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QTemporaryDir>
+#include <QtCore/QThread>
+
+#include <reporter.h>
+#include <trajectoryReader.h>
+#include <trajectoryWriter.h>
+
+#include "gtest/gtest.h"
+
+using namespace twoDModel;
+
+class TrajectoryTest : public testing::Test
+{
+protected:
+	QString path(const QString &fileName) const
+	{
+		return mDirectory.path() + "/" + fileName;
+	}
+
+	QByteArray contents(const QString &fileName) const
+	{
+		QFile file(path(fileName));
+		return file.open(QIODevice::ReadOnly) ? file.readAll() : QByteArray();
+	}
+
+	/// Reads all records from the given file checking that it has no errors.
+	QList<QJsonObject> read(const QString &fileName, TrajectoryFormat expectedFormat) const
+	{
+		TrajectoryReader reader(path(fileName));
+		EXPECT_EQ(expectedFormat, reader.format());
+		QList<QJsonObject> result;
+		QJsonObject record;
+		while (reader.readNext(record)) {
+			result << record;
+		}
+
+		EXPECT_EQ(QString(), reader.errorString());
+		return result;
+	}
+
+	/// Writes some robot positions and device states and returns them in JSON representation.
+	QList<QJsonObject> writeRecords(TrajectoryWriter &writer) const
+	{
+		QList<QJsonObject> records;
+		writer.begin();
+		for (int i = 0; i < 3; ++i) {
+			writer.writeRobotPosition("robot1", 10 * i, QPointF(12.5 * i, -3.25), 90.5 * i);
+			records << QJsonObject{
+				{ "robotId", "robot1" }
+				, { "timestamp", 10 * i }
+				, { "x", 12.5 * i }
+				, { "y", -3.25 }
+				, { "rotation", 90.5 * i }
+			};
+		}
+
+		const QList<QJsonValue> values = { 42, "text", QJsonArray{1, 2}, QJsonObject{{"a", true}} };
+		for (const QJsonValue &value : values) {
+			writer.writeDeviceState("robot2", 20, "display", "DisplayPort", "shape", value);
+			records << QJsonObject{
+				{ "robotId", "robot2" }
+				, { "timestamp", 20 }
+				, { "device", "display" }
+				, { "port", "DisplayPort" }
+				, { "property", "shape" }
+				, { "value", value }
+			};
+		}
+
+		writer.end();
+		return records;
+	}
+
+	QTemporaryDir mDirectory;
+};
+
+TEST_F(TrajectoryTest, roundTripTest)
+{
+	const QMap<QString, TrajectoryFormat> formats = {
+		{ "json", TrajectoryFormat::json }
+		, { "ndjson", TrajectoryFormat::ndjson }
+		, { "binary", TrajectoryFormat::binary }
+	};
+
+	for (const QString &name : formats.keys()) {
+		TrajectoryFormat format = TrajectoryFormat::json;
+		ASSERT_TRUE(TrajectoryWriter::formatByName(name, format));
+		ASSERT_EQ(formats[name], format);
+
+		TrajectoryWriter writer(path(name), format);
+		ASSERT_TRUE(writer.isOpen());
+		const QList<QJsonObject> records = writeRecords(writer);
+		EXPECT_EQ(records, read(name, format)) << name.toStdString();
+
+		// Conversion through write() gives the same file.
+		{
+			TrajectoryWriter converted(path(name + ".converted"), format);
+			converted.begin();
+			for (const QJsonObject &record : records) {
+				converted.write(record);
+			}
+
+			converted.end();
+		}
+
+		EXPECT_EQ(contents(name), contents(name + ".converted")) << name.toStdString();
+	}
+
+	TrajectoryFormat format = TrajectoryFormat::binary;
+	EXPECT_FALSE(TrajectoryWriter::formatByName("xml", format));
+}
+
+TEST_F(TrajectoryTest, jsonCompatibilityTest)
+{
+	TrajectoryWriter writer(path("trajectory.json"), TrajectoryFormat::json);
+	const QList<QJsonObject> records = writeRecords(writer);
+
+	// Each record was written separately as an indented document before the writer was introduced.
+	QByteArray expected = "[\n";
+	bool first = true;
+	for (const QJsonObject &record : records) {
+		QJsonDocument document;
+		document.setObject(record);
+		expected += (first ? "" : ", ") + document.toJson();
+		first = false;
+	}
+
+	expected += "]\n";
+	EXPECT_EQ(expected.toStdString(), contents("trajectory.json").toStdString());
+}
+
+TEST_F(TrajectoryTest, intervalFlushTest)
+{
+	TrajectoryWriter writer(path("trajectory.json"), TrajectoryFormat::json);
+	writer.begin();
+	writer.writeRobotPosition("robot1", 0, QPointF(), 0);
+	QThread::msleep(TrajectoryWriter::flushInterval + 50);
+	writer.writeRobotPosition("robot1", 10, QPointF(), 0);
+
+	// Records are written by time long before the buffer is full.
+	const QByteArray written = contents("trajectory.json");
+	EXPECT_TRUE(written.startsWith("[\n")) << written.toStdString();
+	EXPECT_TRUE(written.contains("\"timestamp\": 10")) << written.toStdString();
+}
+
+TEST_F(TrajectoryTest, unterminatedJsonTest)
+{
+	{
+		TrajectoryWriter writer(path("trajectory.json"), TrajectoryFormat::json);
+		writeRecords(writer);
+	}
+
+	QByteArray trajectory = contents("trajectory.json");
+	trajectory.chop(QByteArray("]\n").size());
+	QFile interrupted(path("interrupted.json"));
+	ASSERT_TRUE(interrupted.open(QIODevice::WriteOnly));
+	interrupted.write(trajectory);
+	interrupted.close();
+	EXPECT_EQ(read("trajectory.json", TrajectoryFormat::json), read("interrupted.json", TrajectoryFormat::json));
+	EXPECT_EQ(7, read("interrupted.json", TrajectoryFormat::json).size());
+
+	// A record cut in the middle can not be read.
+	QFile broken(path("broken.json"));
+	ASSERT_TRUE(broken.open(QIODevice::WriteOnly));
+	broken.write(trajectory.left(trajectory.size() - 10));
+	broken.close();
+	TrajectoryReader reader(path("broken.json"));
+	QJsonObject record;
+	EXPECT_FALSE(reader.readNext(record));
+	EXPECT_FALSE(reader.errorString().isEmpty());
+}
+
+TEST_F(TrajectoryTest, decimationTest)
+{
+	TrajectoryOptions options;
+	options.minInterval = 100;
+	Reporter reporter(QString(), path("trajectory.json"));
+	reporter.setTrajectoryOptions(options);
+	reporter.onInterpretationStart();
+	for (int timestamp = 0; timestamp <= 250; timestamp += 10) {
+		reporter.newTrajectoryPoint("robot1", timestamp, QPointF(timestamp, 0), 0);
+	}
+
+	reporter.newTrajectoryPoint("robot2", 0, QPointF(), 0);
+	reporter.onInterpretationEnd();
+
+	QList<int> robot1Timestamps;
+	int robot2Records = 0;
+	for (const QJsonObject &record : read("trajectory.json", TrajectoryFormat::json)) {
+		if (record["robotId"] == "robot1") {
+			robot1Timestamps << record["timestamp"].toInt();
+		} else {
+			++robot2Records;
+		}
+	}
+
+	// The last skipped position is written when interpretation ends.
+	EXPECT_EQ(QList<int>({0, 100, 200, 250}), robot1Timestamps);
+	EXPECT_EQ(1, robot2Records);
+}
+
+TEST_F(TrajectoryTest, distanceDecimationTest)
+{
+	TrajectoryOptions options;
+	options.minDistance = 10;
+	Reporter reporter(QString(), path("trajectory.json"));
+	reporter.setTrajectoryOptions(options);
+	reporter.onInterpretationStart();
+
+	// Creeping forward.
+	for (int i = 0; i <= 12; ++i) {
+		reporter.newTrajectoryPoint("robot1", i, QPointF(i, 0), 0);
+	}
+
+	// Turning in place, also across 0 degrees.
+	const QList<qreal> rotations = { 4, 8, 12, 16, -6, 350, 345 };
+	for (int i = 0; i < rotations.size(); ++i) {
+		reporter.newTrajectoryPoint("robot1", 20 + i, QPointF(12, 0), rotations[i]);
+	}
+
+	reporter.onInterpretationEnd();
+
+	QList<int> timestamps;
+	for (const QJsonObject &record : read("trajectory.json", TrajectoryFormat::json)) {
+		timestamps << record["timestamp"].toInt();
+	}
+
+	EXPECT_EQ(QList<int>({0, 10, 21, 24, 26}), timestamps);
+}
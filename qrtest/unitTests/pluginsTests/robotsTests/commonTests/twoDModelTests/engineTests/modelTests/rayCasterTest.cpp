@@ -0,0 +1,143 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <climits>
+
+#include <QtCore/QtMath>
+#include <QtCore/qnumeric.h>
+
+#include <src/engine/model/rayCaster.h>
+#include <src/engine/items/wallItem.h>
+#include <twoDModel/engine/model/worldModel.h>
+
+#include <gtest/gtest.h>
+
+using namespace twoDModel::model;
+using namespace twoDModel::items;
+
+namespace {
+
+/// Range sensor reading in cm as it was calculated by intersecting scanning region with items.
+int referenceRangeReading(const WorldModel &world, const QPainterPath &items, const QPointF &position
+		, qreal direction, int maxDistance, qreal angle)
+{
+	const auto touches = [&](int distance) {
+		return world.rangeSensorScanningRegion(position, direction, {angle, distance}).intersects(items);
+	};
+
+	if (!touches(maxDistance)) {
+		return maxDistance;
+	}
+
+	int min = 0;
+	int max = maxDistance;
+	while (min < max) {
+		const int current = (min + max) / 2;
+		if (touches(current)) {
+			max = current;
+		} else {
+			min = current + 1;
+		}
+	}
+
+	return min;
+}
+
+/// Lidar reading as it was calculated by clipping items with the scanning region of each beam.
+QVector<int> referenceLidarReading(const WorldModel &world, const QPainterPath &items, const QPointF &position
+		, qreal direction, int maxDistance, qreal maxAngle)
+{
+	QVector<int> result;
+	for (int i = 0; i < maxAngle; ++i) {
+		const QPainterPath beam = world.rangeSensorScanningRegion(position, direction + i, {1, maxDistance});
+		const QPainterPath intersection = items.intersected(beam);
+		int distance = INT_MAX;
+		for (int j = 0; j < intersection.elementCount(); ++j) {
+			const QPainterPath::Element element = intersection.elementAt(j);
+			if (element.type != QPainterPath::CurveToDataElement) {
+				distance = qMin(distance
+						, static_cast<int>(QLineF(position, QPointF(element)).length() / world.pixelsInCm()));
+			}
+		}
+
+		result.append(distance <= maxDistance ? distance : 0);
+	}
+
+	return result;
+}
+
+/// Fills \a world with walls around (10, 5) and returns their united geometry.
+QPainterPath addWalls(WorldModel &world)
+{
+	const QList<QLineF> walls = {
+		QLineF(200, -300, 240, 300)
+		, QLineF(-150, 80, -90, 120)
+		, QLineF(-60, -170, -10, -190)
+		, QLineF(-250, -200, -250, 150)
+	};
+
+	QPainterPath result;
+	for (const QLineF &line : walls) {
+		const QSharedPointer<WallItem> wall(new WallItem(line.p1(), line.p2()));
+		world.addWall(wall);
+		result.addPath(wall->path());
+	}
+
+	return result;
+}
+
+}
+
+TEST(RayCasterTest, segmentTest)
+{
+	const RayCaster rayCaster(QPointF(), { QLineF(100, -50, 100, 50) });
+	EXPECT_NEAR(100, rayCaster.distance(0, 10), 1e-6);
+	EXPECT_NEAR(100 / qCos(qDegreesToRadians(15.0)), rayCaster.distance(20, 10), 1e-6);
+	EXPECT_TRUE(qIsInf(rayCaster.distance(180, 10)));
+	EXPECT_NEAR(100, rayCaster.distance(180, 360), 1e-6);
+
+	const QVector<qreal> sweep = rayCaster.sweep(-90, 360);
+	ASSERT_EQ(360, sweep.size());
+	EXPECT_NEAR(100, sweep[90], 1e-6);
+	EXPECT_TRUE(qIsInf(sweep[270]));
+	for (int i = 0; i < 360; ++i) {
+		EXPECT_DOUBLE_EQ(rayCaster.distance(-90 + i, 1), sweep[i]);
+	}
+}
+
+TEST(RayCasterTest, rangeReadingCompatibilityTest)
+{
+	WorldModel world;
+	const QPainterPath items = addWalls(world);
+	const QPointF position(10, 5);
+	const int maxDistance = 255;
+	for (int direction = 0; direction < 360; direction += 7) {
+		EXPECT_NEAR(referenceRangeReading(world, items, position, direction, maxDistance, 20)
+				, world.rangeReading(position, direction, maxDistance, 20), 1) << "direction " << direction;
+	}
+}
+
+TEST(RayCasterTest, lidarReadingCompatibilityTest)
+{
+	WorldModel world;
+	const QPainterPath items = addWalls(world);
+	const QPointF position(10, 5);
+	const int maxDistance = 255;
+	const QVector<int> reference = referenceLidarReading(world, items, position, 30, maxDistance, 360);
+	const QVector<int> reading = world.lidarReading(position, 30, maxDistance, 360);
+	ASSERT_EQ(reference.size(), reading.size());
+	for (int i = 0; i < reading.size(); ++i) {
+		EXPECT_NEAR(reference[i], reading[i], 1) << "beam " << i;
+	}
+}
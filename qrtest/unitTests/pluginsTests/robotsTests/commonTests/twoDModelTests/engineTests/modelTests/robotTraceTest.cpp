@@ -0,0 +1,148 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include <QtGui/QPen>
+#include <QtWidgets/QGraphicsPathItem>
+
+#include <twoDModel/engine/model/worldModel.h>
+#include <src/engine/view/scene/fakeScene.h>
+
+#include <gtest/gtest.h>
+
+using namespace twoDModel::model;
+using namespace twoDModel::view;
+
+namespace {
+
+/// Counts trace signals of the world model.
+struct TraceSignals
+{
+	explicit TraceSignals(const WorldModel &world)
+	{
+		QObject::connect(&world, &WorldModel::traceItemAdded, [this]() { ++added; });
+		QObject::connect(&world, &WorldModel::traceSegmentAppended, [this]() { ++appended; });
+	}
+
+	int added = 0;
+	int appended = 0;
+};
+
+bool isWhite(const QImage &image)
+{
+	for (int y = 0; y < image.height(); ++y) {
+		for (int x = 0; x < image.width(); ++x) {
+			if (image.pixel(x, y) != qRgb(255, 255, 255)) {
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+}
+
+TEST(RobotTraceTest, chunkSealingTest)
+{
+	const int chunkSize = WorldModel::traceChunkSize;
+	const QPen pen(Qt::red, 3);
+	WorldModel world;
+	TraceSignals counter(world);
+	for (int i = 0; i < chunkSize; ++i) {
+		world.appendRobotTrace(pen, QPointF(i, 0), QPointF(i + 1, 10));
+	}
+
+	ASSERT_EQ(1, world.trace().size());
+	EXPECT_EQ(1, counter.added);
+	EXPECT_EQ(chunkSize - 1, counter.appended);
+	const QSharedPointer<QGraphicsPathItem> sealed = world.trace().first();
+	const QPainterPath sealedPath = sealed->path();
+	EXPECT_EQ(2 * chunkSize, sealedPath.elementCount());
+
+	// The full chunk is sealed, next segment of the same stroke starts a new one.
+	world.appendRobotTrace(pen, QPointF(chunkSize, 0), QPointF(chunkSize + 1, 10));
+	ASSERT_EQ(2, world.trace().size());
+	EXPECT_EQ(2, counter.added);
+	EXPECT_EQ(chunkSize - 1, counter.appended);
+	EXPECT_EQ(sealed, world.trace().first());
+	EXPECT_EQ(sealedPath, sealed->path());
+	EXPECT_EQ(2, world.trace().last()->path().elementCount());
+	EXPECT_EQ(pen, world.trace().last()->pen());
+
+	world.appendRobotTrace(pen, QPointF(chunkSize + 1, 0), QPointF(chunkSize + 2, 10));
+	EXPECT_EQ(2, world.trace().size());
+	EXPECT_EQ(chunkSize, counter.appended);
+	EXPECT_EQ(sealedPath, sealed->path());
+
+	// Constraints still see one stroke.
+	ASSERT_EQ(1, world.traceStrokes().size());
+	EXPECT_EQ(sealed, world.traceStrokes().first());
+}
+
+TEST(RobotTraceTest, penChangeTest)
+{
+	const QPen red(Qt::red, 3);
+	const QPen blue(Qt::blue, 3);
+	WorldModel world;
+	TraceSignals counter(world);
+	world.appendRobotTrace(red, QPointF(0, 0), QPointF(10, 0));
+	world.appendRobotTrace(red, QPointF(10, 0), QPointF(20, 0));
+	world.appendRobotTrace(blue, QPointF(20, 0), QPointF(30, 0));
+	world.appendRobotTrace(QPen(Qt::transparent), QPointF(30, 0), QPointF(40, 0));
+	world.appendRobotTrace(red, QPointF(40, 0), QPointF(50, 0));
+
+	ASSERT_EQ(3, world.trace().size());
+	EXPECT_EQ(3, counter.added);
+	EXPECT_EQ(1, counter.appended);
+	EXPECT_EQ(red, world.trace()[0]->pen());
+	EXPECT_EQ(blue, world.trace()[1]->pen());
+	EXPECT_EQ(red, world.trace()[2]->pen());
+	EXPECT_EQ(4, world.trace()[0]->path().elementCount());
+	EXPECT_EQ(world.trace(), world.traceStrokes());
+
+	world.clearRobotTrace();
+	EXPECT_TRUE(world.trace().isEmpty());
+	EXPECT_TRUE(world.traceStrokes().isEmpty());
+}
+
+TEST(RobotTraceTest, fakeSceneAppendedSegmentTest)
+{
+	const QPen pen(Qt::red, 3);
+	WorldModel world;
+	FakeScene scene(world);
+	world.appendRobotTrace(pen, QPointF(0, 0), QPointF(100, 0));
+
+	// Caches the raster under the next segment before it is drawn.
+	const QPointF center(50, 100);
+	const int size = 9;
+	const QRectF piece(center - QPointF(size / 2, size / 2), QSizeF(size, size));
+	ASSERT_TRUE(isWhite(scene.sample(center, 0, size)));
+
+	world.appendRobotTrace(pen, QPointF(0, 100), QPointF(100, 100));
+	ASSERT_EQ(1, world.trace().size());
+	ASSERT_EQ(1, scene.items().size());
+
+	const QImage sample = scene.sample(center, 0, size);
+	EXPECT_FALSE(isWhite(sample));
+	EXPECT_EQ(scene.render(piece), sample);
+
+	// Each new chunk gets its own clone.
+	for (int i = 0; i < WorldModel::traceChunkSize; ++i) {
+		world.appendRobotTrace(pen, QPointF(0, 200 + i), QPointF(100, 200 + i));
+	}
+
+	EXPECT_EQ(world.trace().size(), scene.items().size());
+	EXPECT_FALSE(isWhite(scene.sample(QPointF(50, 200 + WorldModel::traceChunkSize - 3), 0, 5)));
+}
@@ -0,0 +1,81 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <QtWidgets/QGraphicsRectItem>
+
+#include <src/engine/model/solidItemsIndex.h>
+
+#include <gtest/gtest.h>
+
+using namespace twoDModel::model;
+
+namespace {
+
+QPainterPath rectPath(const QRectF &rect)
+{
+	QPainterPath path;
+	path.addRect(rect);
+	return path;
+}
+
+}
+
+TEST(SolidItemsIndexTest, nearItemsOnlyTest)
+{
+	QGraphicsRectItem near;
+	QGraphicsRectItem far;
+	SolidItemsIndex index;
+	index.insert(&near, []() { return rectPath(QRectF(0, 0, 10, 10)); });
+	index.insert(&far, []() { return rectPath(QRectF(5000, 5000, 10, 10)); });
+
+	const QPainterPath path = index.path(QRectF(-20, -20, 40, 40));
+	EXPECT_TRUE(path.contains(QPointF(5, 5)));
+	EXPECT_FALSE(path.contains(QPointF(5005, 5005)));
+	EXPECT_TRUE(index.path().contains(QPointF(5005, 5005)));
+}
+
+TEST(SolidItemsIndexTest, invalidateTest)
+{
+	QGraphicsRectItem item;
+	QRectF rect(0, 0, 10, 10);
+	SolidItemsIndex index;
+	index.insert(&item, [&rect]() { return rectPath(rect); });
+	EXPECT_TRUE(index.path(QRectF(0, 0, 10, 10)).contains(QPointF(5, 5)));
+
+	rect.translate(1000, 0);
+	EXPECT_TRUE(index.path(QRectF(0, 0, 10, 10)).contains(QPointF(5, 5)));
+
+	index.invalidate(&item);
+	EXPECT_TRUE(index.path(QRectF(0, 0, 10, 10)).isEmpty());
+	EXPECT_TRUE(index.path(QRectF(1000, 0, 10, 10)).contains(QPointF(1005, 5)));
+}
+
+TEST(SolidItemsIndexTest, largeAndDegenerateItemsTest)
+{
+	QGraphicsRectItem large;
+	QGraphicsRectItem line;
+	SolidItemsIndex index;
+	index.insert(&large, []() { return rectPath(QRectF(-10000, -10000, 20000, 20000)); });
+	index.insert(&line, []() {
+		QPainterPath path(QPointF(300, 0));
+		path.lineTo(300, 100);
+		return path;
+	});
+
+	EXPECT_TRUE(index.path(QRectF(9000, 9000, 10, 10)).contains(QPointF(9005, 9005)));
+
+	index.remove(&large);
+	EXPECT_FALSE(index.path(QRectF(9000, 9000, 10, 10)).contains(QPointF(9005, 9005)));
+	EXPECT_FALSE(index.path(QRectF(299, 50, 2, 0)).isEmpty());
+}
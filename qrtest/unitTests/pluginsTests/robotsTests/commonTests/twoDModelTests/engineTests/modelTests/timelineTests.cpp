@@ -0,0 +1,83 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "timelineTests.h"
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QEventLoop>
+#include <QtCore/QTimer>
+#include <QtCore/QDebug>
+
+using namespace qrTest::robotsTests::commonTwoDModelTests;
+using namespace twoDModel::model;
+
+qint64 TimelineTests::runUntil(Timeline &timeline, quint64 timestamp)
+{
+	QEventLoop loop;
+	QObject::connect(&timeline, &Timeline::tick, &loop, [&timeline, timestamp]() {
+		if (timeline.timestamp() >= timestamp) {
+			timeline.stop(qReal::interpretation::StopReason::finised);
+		}
+	});
+	QObject::connect(&timeline, &Timeline::stopped, &loop, &QEventLoop::quit);
+
+	QElapsedTimer timer;
+	timer.start();
+	timeline.start();
+	loop.exec();
+	return timer.elapsed();
+}
+
+TEST_F(TimelineTests, immediateModeReachesTimestampTest)
+{
+	Timeline timeline;
+	timeline.setImmediateMode(true);
+	runUntil(timeline, 1000);
+	EXPECT_EQ(1000u, timeline.timestamp());
+}
+
+TEST_F(TimelineTests, batchModeProcessesEventsBetweenBatchesOnlyTest)
+{
+	const int ticksPerBatch = 4;
+	Timeline timeline;
+	timeline.setImmediateMode(true);
+	timeline.setTicksPerBatch(ticksPerBatch);
+
+	QList<quint64> reactionTimestamps;
+	QObject::connect(&timeline, &Timeline::tick, &timeline, [&timeline, &reactionTimestamps]() {
+		QTimer::singleShot(0, &timeline, [&timeline, &reactionTimestamps]() {
+			reactionTimestamps << timeline.timestamp();
+		});
+	});
+
+	runUntil(timeline, 1000);
+	EXPECT_EQ(1000u, timeline.timestamp());
+	ASSERT_FALSE(reactionTimestamps.isEmpty());
+	for (const quint64 timestamp : reactionTimestamps) {
+		EXPECT_EQ(0u, timestamp % (ticksPerBatch * Timeline::timeInterval));
+	}
+}
+
+TEST_F(TimelineTests, DISABLED_immediateModeBenchmark)
+{
+	// Ten minutes of simulated time.
+	const quint64 modelingTime = 10 * 60 * 1000;
+	for (const int ticksPerBatch : {0, 1, 10, 100}) {
+		Timeline timeline;
+		timeline.setImmediateMode(true);
+		timeline.setTicksPerBatch(ticksPerBatch);
+		const qint64 wallTime = qMax(runUntil(timeline, modelingTime), static_cast<qint64>(1));
+		qDebug() << "Ticks per batch:" << ticksPerBatch << "simulated ms per wall ms:" << modelingTime / wallTime;
+	}
+}
@@ -0,0 +1,36 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <twoDModel/engine/model/timeline.h>
+
+namespace qrTest {
+namespace robotsTests {
+namespace commonTwoDModelTests {
+
+/// Tests for 2D model timeline.
+class TimelineTests : public testing::Test
+{
+protected:
+	/// Runs the given timeline till the given simulated timestamp.
+	/// @returns Wall-clock time in ms spent on modeling.
+	static qint64 runUntil(twoDModel::model::Timeline &timeline, quint64 timestamp);
+};
+
+}
+}
+}
@@ -0,0 +1,172 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include <QtGui/QPen>
+
+#include <twoDModel/engine/model/worldModel.h>
+#include <src/engine/view/scene/fakeScene.h>
+#include <src/engine/twoDModelEngineApi.h>
+
+#include <gtest/gtest.h>
+
+using namespace twoDModel;
+using namespace twoDModel::model;
+using namespace twoDModel::view;
+
+namespace {
+
+/// Draws wide stripes of different colors crossing tile boundaries, including tiles with negative coordinates.
+void drawStripes(WorldModel &world)
+{
+	world.appendRobotTrace(QPen(Qt::red, 60), QPointF(-300, 240), QPointF(600, 240));
+	world.appendRobotTrace(QPen(Qt::blue, 60), QPointF(270, -300), QPointF(270, 600));
+	world.appendRobotTrace(QPen(Qt::green, 40), QPointF(-100, -100), QPointF(500, 400));
+}
+
+/// Returns a piece of the scene under the sensor the way it was taken before sampling from tiles:
+/// renders the bounding square of the piece, rotates it and takes its center.
+QImage renderRotated(FakeScene &scene, const QPointF &center, qreal rotation, int size)
+{
+	const int side = 2 * size;
+	const QImage image = scene.render(QRectF(center - QPointF(side / 2.0, side / 2.0), QSizeF(side, side)));
+	const QImage rotated = image.transformed(QTransform().rotate(-rotation));
+	return rotated.copy(QRect(rotated.rect().center() - QPoint(size / 2, size / 2), QSize(size, size)));
+}
+
+/// Returns a share of pixels that differ noticeably on two images of the same size.
+qreal mismatch(const QImage &first, const QImage &second)
+{
+	int different = 0;
+	for (int y = 0; y < first.height(); ++y) {
+		for (int x = 0; x < first.width(); ++x) {
+			const QColor a = first.pixelColor(x, y);
+			const QColor b = second.pixelColor(x, y);
+			if (qAbs(a.red() - b.red()) + qAbs(a.green() - b.green()) + qAbs(a.blue() - b.blue()) > 30) {
+				++different;
+			}
+		}
+	}
+
+	return static_cast<qreal>(different) / (first.width() * first.height());
+}
+
+/// Image with all kinds of colors, deterministic for reproducibility.
+QImage patternImage(int width, int height)
+{
+	QImage image(width, height, QImage::Format_RGB32);
+	for (int y = 0; y < height; ++y) {
+		for (int x = 0; x < width; ++x) {
+			image.setPixel(x, y, qRgb((x * 37 + y * 11) % 256, (x * 5 + y * 71) % 256, (x * y + 13) % 256));
+		}
+	}
+
+	return image;
+}
+
+}
+
+TEST(FakeSceneTest, sampleMatchesRenderWithoutRotation)
+{
+	WorldModel world;
+	FakeScene scene(world);
+	drawStripes(world);
+
+	const int size = 41;
+	for (const QPointF &center : { QPointF(256, 256), QPointF(0, 0), QPointF(250, 10), QPointF(-30, 500) }) {
+		const QRectF piece(center - QPointF(size / 2, size / 2), QSizeF(size, size));
+		EXPECT_EQ(scene.render(piece), scene.sample(center, 0, size))
+				<< center.x() << " " << center.y();
+	}
+}
+
+TEST(FakeSceneTest, sampleMatchesRotatedRender)
+{
+	WorldModel world;
+	FakeScene scene(world);
+	drawStripes(world);
+
+	const int size = 41;
+	for (const QPointF &center : { QPointF(256, 256), QPointF(0, 0), QPointF(250, 10), QPointF(-30, 500) }) {
+		for (const qreal rotation : { 30.0, 90.0, 135.0, 200.0, -45.0 }) {
+			const QImage sample = scene.sample(center, rotation, size);
+			const QImage rendered = renderRotated(scene, center, rotation, size);
+			ASSERT_EQ(rendered.size(), sample.size());
+
+			// Both are nearest-pixel lookups, so they differ only in single pixels on the borders of stripes.
+			EXPECT_LT(mismatch(rendered, sample), 0.1) << center.x() << " " << center.y() << " " << rotation;
+			const QColor renderedColor = TwoDModelEngineApi::averageColor(rendered);
+			const QColor sampledColor = TwoDModelEngineApi::averageColor(sample);
+			EXPECT_NEAR(renderedColor.red(), sampledColor.red(), 10);
+			EXPECT_NEAR(renderedColor.green(), sampledColor.green(), 10);
+			EXPECT_NEAR(renderedColor.blue(), sampledColor.blue(), 10);
+		}
+	}
+}
+
+TEST(FakeSceneTest, sampleOfChangedTile)
+{
+	WorldModel world;
+	FakeScene scene(world);
+	drawStripes(world);
+
+	// Caches tiles around the point and then draws over them.
+	const QPointF center(256, 100);
+	const int size = 21;
+	scene.sample(center, 45, size);
+	world.appendRobotTrace(QPen(Qt::black, 30), QPointF(200, 100), QPointF(300, 100));
+
+	const QRectF piece(center - QPointF(size / 2, size / 2), QSizeF(size, size));
+	EXPECT_EQ(scene.render(piece), scene.sample(center, 0, size));
+}
+
+TEST(FakeSceneTest, averageColorAndLight)
+{
+	QImage halves(10, 10, QImage::Format_RGB32);
+	halves.fill(qRgb(0, 0, 100));
+	for (int y = 0; y < halves.height(); ++y) {
+		for (int x = 0; x < halves.width() / 2; ++x) {
+			halves.setPixel(x, y, qRgb(200, 0, 0));
+		}
+	}
+
+	EXPECT_EQ(QColor(100, 0, 50), TwoDModelEngineApi::averageColor(halves));
+	EXPECT_EQ(QColor(101, 1, 51), TwoDModelEngineApi::averageColor(halves, 0.6));
+	EXPECT_EQ(QColor(80, 0, 30), TwoDModelEngineApi::averageColor(halves, -20));
+
+	QImage black(5, 5, QImage::Format_RGB32);
+	black.fill(Qt::black);
+	EXPECT_EQ(0, TwoDModelEngineApi::lightReading(black));
+
+	// Compares with averaging that was used before sums were accumulated in integer channels.
+	const QImage image = patternImage(37, 23);
+	qreal averageR = 0;
+	qreal averageG = 0;
+	qreal averageB = 0;
+	uint brightnessSum = 0;
+	const uchar * const bytes = image.constBits();
+	const int n = image.width() * image.height();
+	for (int i = 0; i < n; ++i) {
+		averageB += bytes[4 * i];
+		averageG += bytes[4 * i + 1];
+		averageR += bytes[4 * i + 2];
+		const uint brightness = static_cast<uint>(0.2126 * bytes[4 * i + 2] + 0.7152 * bytes[4 * i + 1]
+				+ 0.0722 * bytes[4 * i]);
+		brightnessSum += 4 * brightness;
+	}
+
+	EXPECT_EQ(QColor(qRound(averageR / n), qRound(averageG / n), qRound(averageB / n))
+			, TwoDModelEngineApi::averageColor(image));
+	EXPECT_EQ(static_cast<int>(brightnessSum * 1.0 / n * 100.0 / 1023), TwoDModelEngineApi::lightReading(image));
+}
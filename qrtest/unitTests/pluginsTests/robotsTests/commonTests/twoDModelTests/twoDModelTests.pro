@@ -27,9 +27,15 @@ INCLUDEPATH += \
 # Tests
 HEADERS += \
 	$$PWD/engineTests/constraintsTests/constraintsParserTests.h \
+	$$PWD/engineTests/modelTests/timelineTests.h \
 
 SOURCES += \
 	$$PWD/engineTests/constraintsTests/constraintsParserTests.cpp \
+	$$PWD/engineTests/modelTests/timelineTests.cpp \
+	$$PWD/engineTests/modelTests/solidItemsIndexTest.cpp \
+	$$PWD/engineTests/modelTests/rayCasterTest.cpp \
+	$$PWD/engineTests/modelTests/robotTraceTest.cpp \
+	$$PWD/engineTests/viewTests/fakeSceneTest.cpp \
 
 # Support classes
 HEADERS += \
@@ -0,0 +1,334 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include "structurizatorTest.h"
+
+#include <QtCore/QDirIterator>
+#include <QtCore/QFile>
+#include <QtCore/QTextStream>
+
+#include <qrrepo/repoApi.h>
+
+#include <structurizator.h>
+#include <structurizatorNodes/blockStructurizatorNode.h>
+#include <structurizatorNodes/breakStructurizatorNode.h>
+#include <structurizatorNodes/ifStructurizatorNode.h>
+#include <structurizatorNodes/selfLoopStructurizatorNode.h>
+#include <structurizatorNodes/simpleStructurizatorNode.h>
+#include <structurizatorNodes/structurizatorNodeWithBreaks.h>
+#include <structurizatorNodes/switchStructurizatorNode.h>
+#include <structurizatorNodes/whileStructurizatorNode.h>
+
+using namespace qrTest::robotsTests::trikV62QtsGeneratorTests;
+using namespace generatorBase;
+using namespace qReal;
+
+StructurizatorTest::Graph StructurizatorTest::graph(int verticesNumber, const QList<QPair<int, int>> &edges) const
+{
+	Graph result;
+	for (int i = 1; i <= verticesNumber; ++i) {
+		addVertex(result, Id("editor", "diagram", "element", QString::number(i)));
+	}
+
+	for (const QPair<int, int> &edge : edges) {
+		addEdge(result, edge.first, edge.second);
+	}
+
+	return result;
+}
+
+QList<StructurizatorTest::Graph> StructurizatorTest::diagramGraphs(const QString &fileName) const
+{
+	const qrRepo::RepoApi repo(fileName, true);
+	QList<Graph> result;
+	for (const Id &id : repo.graphicalElements()) {
+		if (id.element() == "InitialNode") {
+			Graph diagramGraph;
+			QMap<Id, int> loopHeaders;
+			QSet<Id> verticesOnStack;
+			addVertex(diagramGraph, id);
+			visitDiagramVertex(repo, id, diagramGraph, loopHeaders, verticesOnStack);
+			result << diagramGraph;
+		}
+	}
+
+	return result;
+}
+
+int StructurizatorTest::appendRandomFragment(Graph &graph, int from, int depth) const
+{
+	const auto newVertex = [this, &graph]() {
+		return addVertex(graph, Id("editor", "diagram", "element", QString::number(graph.verticesNumber + 1)));
+	};
+
+	switch (depth == 0 ? 0 : qrand() % 6) {
+	case 0: {
+		const int action = newVertex();
+		addEdge(graph, from, action);
+		return action;
+	}
+	case 1: {
+		return appendRandomFragment(graph, appendRandomFragment(graph, from, depth - 1), depth - 1);
+	}
+	case 2: {
+		const int condition = newVertex();
+		addEdge(graph, from, condition);
+		const int thenEnd = appendRandomFragment(graph, condition, depth - 1);
+		const int elseEnd = appendRandomFragment(graph, condition, depth - 1);
+		const int exit = newVertex();
+		addEdge(graph, thenEnd, exit);
+		addEdge(graph, elseEnd, exit);
+		return exit;
+	}
+	case 3: {
+		const int condition = newVertex();
+		addEdge(graph, from, condition);
+		const int exit = newVertex();
+		for (int i = 0; i < 3; ++i) {
+			addEdge(graph, appendRandomFragment(graph, condition, depth - 1), exit);
+		}
+
+		return exit;
+	}
+	case 4: {
+		const int head = newVertex();
+		addEdge(graph, from, head);
+		addEdge(graph, appendRandomFragment(graph, head, depth - 1), head);
+		const int exit = newVertex();
+		addEdge(graph, head, exit);
+		return exit;
+	}
+	default: {
+		const int head = newVertex();
+		addEdge(graph, from, head);
+		const int exit = newVertex();
+		const int condition = newVertex();
+		addEdge(graph, appendRandomFragment(graph, head, depth - 1), condition);
+		addEdge(graph, condition, exit);
+		addEdge(graph, appendRandomFragment(graph, condition, depth - 1), head);
+		return exit;
+	}
+	}
+}
+
+QString StructurizatorTest::structurization(const Graph &graph) const
+{
+	Structurizator structurizator;
+	const IntermediateStructurizatorNode *tree = structurizator.performStructurization(graph.ids, 1
+			, graph.followers, graph.vertexNumber, graph.verticesNumber);
+	return tree ? treeToString(graph, tree) : "none";
+}
+
+QMultiMap<QString, QString> StructurizatorTest::expectedStructurizations(const QString &fileName) const
+{
+	QFile file(fileName);
+	EXPECT_TRUE(file.open(QIODevice::ReadOnly | QIODevice::Text));
+	QMultiMap<QString, QString> result;
+	QTextStream stream(&file);
+	while (!stream.atEnd()) {
+		const QString line = stream.readLine();
+		if (line.isEmpty() || line.startsWith('#')) {
+			continue;
+		}
+
+		const int separator = line.indexOf('\t');
+		result.insert(line.left(separator), line.mid(separator + 1));
+	}
+
+	return result;
+}
+
+QString StructurizatorTest::treeToString(const Graph &graph, const IntermediateStructurizatorNode *node) const
+{
+	if (!node) {
+		return QString();
+	}
+
+	const auto vertex = [&graph](const Id &id) {
+		return id.isNull() ? QString() : QString::number(graph.vertexNumber.value(id));
+	};
+
+	// Exits are also a part of a tree that follows the node, so only their first ids are taken.
+	const auto exit = [&vertex](const IntermediateStructurizatorNode *exitNode) {
+		return exitNode ? "->" + vertex(exitNode->firstId()) : QString();
+	};
+
+	const auto list = [this, &graph](const QList<IntermediateStructurizatorNode *> &nodes) {
+		QStringList result;
+		for (const IntermediateStructurizatorNode *listNode : nodes) {
+			result << treeToString(graph, listNode);
+		}
+
+		result.sort();
+		return "[" + result.join(", ") + "]";
+	};
+
+	switch (node->type()) {
+	case IntermediateStructurizatorNode::simple:
+		return vertex(static_cast<const SimpleStructurizatorNode *>(node)->id());
+	case IntermediateStructurizatorNode::breakNode:
+		return "break " + vertex(node->firstId());
+	case IntermediateStructurizatorNode::block: {
+		const auto block = static_cast<const BlockStructurizatorNode *>(node);
+		return QString("block(%1, %2)").arg(treeToString(graph, block->firstNode())
+				, treeToString(graph, block->secondNode()));
+	}
+	case IntermediateStructurizatorNode::ifThenElseCondition: {
+		const auto ifNode = static_cast<const IfStructurizatorNode *>(node);
+		QString thenBranch = treeToString(graph, ifNode->thenBranch());
+		QString elseBranch = treeToString(graph, ifNode->elseBranch());
+		if (!elseBranch.isEmpty() && elseBranch < thenBranch) {
+			thenBranch.swap(elseBranch);
+		}
+
+		return QString("if(%1, %2, %3, %4)").arg(treeToString(graph, ifNode->condition()), thenBranch, elseBranch
+				, exit(ifNode->exit()));
+	}
+	case IntermediateStructurizatorNode::switchCondition: {
+		const auto switchNode = static_cast<const SwitchStructurizatorNode *>(node);
+		return QString("switch(%1, %2, %3)").arg(treeToString(graph, switchNode->condition())
+				, list(switchNode->branches()), exit(switchNode->exit()));
+	}
+	case IntermediateStructurizatorNode::infiniteloop:
+		return QString("loop(%1)").arg(treeToString(graph
+				, static_cast<const SelfLoopStructurizatorNode *>(node)->bodyNode()));
+	case IntermediateStructurizatorNode::whileloop: {
+		const auto whileNode = static_cast<const WhileStructurizatorNode *>(node);
+		return QString("while(%1, %2, %3)").arg(treeToString(graph, whileNode->headNode())
+				, treeToString(graph, whileNode->bodyNode()), exit(whileNode->exitNode()));
+	}
+	case IntermediateStructurizatorNode::nodeWithBreaks: {
+		const auto nodeWithBreaks = static_cast<const StructurizatorNodeWithBreaks *>(node);
+		return QString("breaks(%1, %2, %3)").arg(treeToString(graph, nodeWithBreaks->condition())
+				, list(nodeWithBreaks->exitBranches()), list(nodeWithBreaks->restBranches()));
+	}
+	}
+
+	return "unknown";
+}
+
+int StructurizatorTest::addVertex(Graph &graph, const Id &id) const
+{
+	graph.ids.insert(id);
+	graph.vertexNumber[id] = ++graph.verticesNumber;
+	return graph.verticesNumber;
+}
+
+void StructurizatorTest::addEdge(Graph &graph, int from, int to) const
+{
+	graph.followers[from].insert(to);
+}
+
+void StructurizatorTest::visitDiagramVertex(const qrRepo::RepoApi &repo, const Id &vertex, Graph &graph
+		, QMap<Id, int> &loopHeaders, QSet<Id> &verticesOnStack) const
+{
+	verticesOnStack.insert(vertex);
+	const int from = graph.vertexNumber[vertex];
+	IdList newVertices;
+	for (const Id &link : repo.outgoingLinks(vertex)) {
+		const Id target = repo.otherEntityFromLink(link, vertex);
+		if (link.element() != "ControlFlow" || target.isNull() || target == Id::rootId()) {
+			continue;
+		}
+
+		if (!graph.ids.contains(target)) {
+			if (isLoop(target)) {
+				const int header = addVertex(graph, target.sameTypeId());
+				loopHeaders[target] = header;
+				addEdge(graph, from, header);
+				addEdge(graph, header, addVertex(graph, target));
+			} else {
+				addEdge(graph, from, addVertex(graph, target));
+			}
+
+			newVertices << target;
+		} else if (isLoop(target) && !verticesOnStack.contains(target)) {
+			// only edges from loop body go to the loop block itself, others go to its header
+			addEdge(graph, from, loopHeaders[target]);
+		} else {
+			addEdge(graph, from, graph.vertexNumber[target]);
+		}
+	}
+
+	for (const Id &newVertex : newVertices) {
+		visitDiagramVertex(repo, newVertex, graph, loopHeaders, verticesOnStack);
+	}
+
+	verticesOnStack.remove(vertex);
+}
+
+bool StructurizatorTest::isLoop(const Id &id) const
+{
+	return id.element() == "Loop" || id.element() == "PreconditionalLoop";
+}
+
+TEST_F(StructurizatorTest, bundledExamples)
+{
+	const QMultiMap<QString, QString> expected
+			= expectedStructurizations("unittests/structurizations/bundledExamples.txt");
+	const QDir examples("unittests/examples");
+	int diagramsCount = 0;
+	QDirIterator it(examples.path(), {"*.qrs"}, QDir::Files, QDirIterator::Subdirectories);
+	while (it.hasNext()) {
+		const QString fileName = examples.relativeFilePath(QFileInfo(it.next()).absoluteFilePath());
+		SCOPED_TRACE(fileName.toStdString());
+		QStringList trees;
+		for (const Graph &diagramGraph : diagramGraphs(examples.filePath(fileName))) {
+			trees << structurization(diagramGraph);
+		}
+
+		// Diagrams of a save file are taken in order of its elements in repository, which is not stable.
+		QStringList expectedTrees = expected.values(fileName);
+		expectedTrees.sort();
+		trees.sort();
+		EXPECT_EQ(expectedTrees.join("\n"), trees.join("\n"));
+		diagramsCount += trees.size();
+	}
+
+	EXPECT_EQ(expected.size(), diagramsCount);
+	EXPECT_GT(diagramsCount, 50);
+}
+
+TEST_F(StructurizatorTest, reductionsOutsideOfDominatorTree)
+{
+	const QMultiMap<QString, QString> expected
+			= expectedStructurizations("unittests/structurizations/handMadeGraphs.txt");
+
+	// Switch reduction removes edge to its exit, so dominators kept from the initial graph do not match the reduced
+	// graph anymore and the next reductions do not form subtrees of dominator tree. Structurizator must keep
+	// the same dominators it used to keep then (recalculating them from the reduced graph would structurize the first
+	// graph while it was not structurized before).
+	EXPECT_EQ(expected.value("reductionsOutsideOfDominatorTree1")
+			, structurization(graph(7, {{1, 2}, {1, 5}, {2, 3}, {2, 4}, {2, 6}, {3, 7}, {5, 3}, {5, 7}})));
+
+	EXPECT_EQ(expected.value("reductionsOutsideOfDominatorTree2")
+			, structurization(graph(9, {{1, 2}, {1, 4}, {2, 3}, {2, 6}, {3, 5}, {3, 8}, {3, 9}, {4, 7}, {4, 9}
+					, {9, 7}})));
+
+	EXPECT_EQ(expected.value("reductionsOutsideOfDominatorTree3")
+			, structurization(graph(7, {{1, 2}, {1, 5}, {1, 7}, {2, 3}, {2, 4}, {2, 6}, {5, 6}, {5, 7}, {6, 7}
+					, {7, 7}})));
+}
+
+TEST_F(StructurizatorTest, randomStructuredGraphs)
+{
+	for (int seed = 0; seed < 200; ++seed) {
+		SCOPED_TRACE(seed);
+		qsrand(seed);
+		Graph randomGraph = graph(1, {});
+		appendRandomFragment(randomGraph, 1, 4);
+		EXPECT_NE(QString("none"), structurization(randomGraph));
+	}
+}
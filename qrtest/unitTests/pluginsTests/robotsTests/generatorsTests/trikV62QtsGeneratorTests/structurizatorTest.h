@@ -0,0 +1,87 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <QtCore/QMap>
+#include <QtCore/QSet>
+#include <QtCore/QString>
+
+#include <qrkernel/ids.h>
+
+namespace qrRepo {
+class RepoApi;
+}
+
+namespace generatorBase {
+class IntermediateStructurizatorNode;
+}
+
+namespace qrTest {
+namespace robotsTests {
+namespace trikV62QtsGeneratorTests {
+
+/// Checks control flow trees built by structurizator against expected trees from test data. Expected trees were built
+/// by structurizator implementation before dominator tree was introduced, so the code generated from these trees stays
+/// the same.
+class StructurizatorTest : public testing::Test
+{
+protected:
+	/// Control flow graph in the form structurizator takes it.
+	struct Graph
+	{
+		QSet<qReal::Id> ids;
+		QMap<qReal::Id, int> vertexNumber;
+		QMap<int, QSet<int>> followers;
+		int verticesNumber = 0;
+	};
+
+	/// Creates graph with vertices numbered from 1 to verticesNumber and given edges, 1 is a start vertex.
+	Graph graph(int verticesNumber, const QList<QPair<int, int>> &edges) const;
+
+	/// Builds graphs for all diagrams in a save file the same way structural control flow generator does: vertices
+	/// are numbered in order of depth-first search from initial node, loop blocks get fictive header vertices.
+	QList<Graph> diagramGraphs(const QString &fileName) const;
+
+	/// Appends a random structured fragment (action, sequence, if, switch, while loop or loop with exit in
+	/// the middle) after a given vertex and returns the last vertex of the fragment.
+	int appendRandomFragment(Graph &graph, int from, int depth) const;
+
+	/// Performs structurization of a graph and returns string representation of the tree, "none" if graph can not
+	/// be structurized.
+	QString structurization(const Graph &graph) const;
+
+	/// Reads expected trees from a test data file. Each line of a file contains a graph name and a tree separated by
+	/// tab, lines starting with '#' are comments. Several graphs may have the same name.
+	QMultiMap<QString, QString> expectedStructurizations(const QString &fileName) const;
+
+	/// Returns string representation of a tree built by structurizator with ids replaced by vertex numbers in a given
+	/// graph, empty string for nullptr. Branches of conditions are sorted, since their order follows iteration order
+	/// of QSet with followers of a condition, which differs from run to run.
+	QString treeToString(const Graph &graph, const generatorBase::IntermediateStructurizatorNode *node) const;
+
+private:
+	int addVertex(Graph &graph, const qReal::Id &id) const;
+	void addEdge(Graph &graph, int from, int to) const;
+	void visitDiagramVertex(const qrRepo::RepoApi &repo, const qReal::Id &vertex, Graph &graph
+			, QMap<qReal::Id, int> &loopHeaders, QSet<qReal::Id> &verticesOnStack) const;
+	bool isLoop(const qReal::Id &id) const;
+};
+
+}
+}
+}
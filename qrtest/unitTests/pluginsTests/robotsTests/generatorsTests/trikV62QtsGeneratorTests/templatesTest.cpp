@@ -0,0 +1,220 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include <QtCore/QFile>
+#include <QtCore/QRegularExpression>
+#include <QtCore/QSet>
+#include <QtCore/QTemporaryDir>
+
+#include <qrutils/stringUtils.h>
+#include <generatorBase/masterGeneratorBase.h>
+#include <generatorBase/templateParametrizedEntity.h>
+
+#include "gtest/gtest.h"
+
+using namespace generatorBase;
+
+namespace {
+
+/// Gives access to template reading methods of TemplateParametrizedEntity.
+class Templates : public TemplateParametrizedEntity
+{
+public:
+	explicit Templates(const QStringList &pathsToTemplates)
+		: TemplateParametrizedEntity(pathsToTemplates)
+	{
+	}
+
+	using TemplateParametrizedEntity::readTemplate;
+	using TemplateParametrizedEntity::readTemplateIfExists;
+	using TemplateParametrizedEntity::addRandomIds;
+};
+
+/// Gives access to MasterGeneratorBase::fillMainTemplate(), never instantiated.
+class MasterGenerator : public MasterGeneratorBase
+{
+public:
+	using MasterGeneratorBase::fillMainTemplate;
+};
+
+/// Fills main template the way MasterGeneratorBase::generate() did before fillMainTemplate(): replaceWithAutoIndent()
+/// for each placeholder and then removal of too many empty lines.
+QString legacyFillMainTemplate(QString resultCode, const QMap<QString, QString> &code)
+{
+	for (const QString &placeholder : code.keys()) {
+		const QRegularExpression regexp(QString("^(([ \\t]*)%1)$").arg(placeholder)
+				, QRegularExpression::MultilineOption);
+		const QRegularExpressionMatch match = regexp.match(resultCode);
+		if (match.hasMatch()) {
+			resultCode.replace(match.captured(1), utils::StringUtils::addIndent(code[placeholder], 1
+					, match.captured(2)));
+		}
+	}
+
+	resultCode.replace(QRegExp("\n(\n)+"), "\n\n");
+	return resultCode;
+}
+
+}
+
+class TemplatesTest : public testing::Test
+{
+protected:
+	void TearDown() override
+	{
+		TemplateParametrizedEntity::clearTemplatesCache();
+	}
+
+	void writeTemplate(const QString &name, const QString &contents)
+	{
+		QFile file(mDirectory.path() + "/" + name);
+		ASSERT_TRUE(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+		file.write(contents.toUtf8());
+	}
+
+	QTemporaryDir mDirectory;
+};
+
+TEST_F(TemplatesTest, randomIdsNumbering)
+{
+	const Templates templates{QStringList()};
+	const QStringList parts = templates.addRandomIds("@@RANDOM_ID@@ @@RANDOM_ID@@ @@RANDOM_ID_1@@ @@RANDOM_ID_2@@ "
+			"@@RANDOM_ID_1@@ @@RANDOM_ID_4@@ @@RANDOM_ID_01@@ @@RANDOM_ID_x@@ @@RANDOM_ID @@@RANDOM_ID_2@@").split(' ');
+
+	ASSERT_EQ(10, parts.size());
+	const QRegularExpression identifier("^[A-Za-z_]\\w*$");
+	for (int i : {0, 2, 3}) {
+		EXPECT_TRUE(identifier.match(parts[i]).hasMatch()) << parts[i].toStdString();
+	}
+
+	// The same placeholder gets the same identifier, different placeholders get different ones.
+	EXPECT_EQ(parts[0], parts[1]);
+	EXPECT_EQ(parts[2], parts[4]);
+	EXPECT_EQ(3, (QSet<QString>{parts[0], parts[2], parts[3]}).size());
+	EXPECT_EQ("@" + parts[3], parts[9]);
+
+	// Numbers after the first missing one and malformed placeholders are left as is.
+	EXPECT_EQ("@@RANDOM_ID_4@@", parts[5]);
+	EXPECT_EQ("@@RANDOM_ID_01@@", parts[6]);
+	EXPECT_EQ("@@RANDOM_ID_x@@", parts[7]);
+	EXPECT_EQ("@@RANDOM_ID", parts[8]);
+
+	EXPECT_EQ("no placeholders", templates.addRandomIds("no placeholders"));
+	EXPECT_EQ("@@RANDOM_ID_2@@", templates.addRandomIds("@@RANDOM_ID_2@@"));
+}
+
+TEST_F(TemplatesTest, freshRandomIdsForEachRead)
+{
+	writeTemplate("test.t", "int @@RANDOM_ID@@ = @@RANDOM_ID_1@@;");
+	const Templates templates{QStringList{mDirectory.path()}};
+
+	const QString first = templates.readTemplate("test.t");
+	const QString second = templates.readTemplate("test.t");
+	const QRegularExpression pattern("^int (\\w+) = (\\w+);$");
+	const QRegularExpressionMatch firstMatch = pattern.match(first);
+	const QRegularExpressionMatch secondMatch = pattern.match(second);
+	ASSERT_TRUE(firstMatch.hasMatch()) << first.toStdString();
+	ASSERT_TRUE(secondMatch.hasMatch()) << second.toStdString();
+	EXPECT_NE(firstMatch.captured(1), firstMatch.captured(2));
+	EXPECT_NE(firstMatch.captured(1), secondMatch.captured(1));
+	EXPECT_NE(firstMatch.captured(2), secondMatch.captured(2));
+}
+
+TEST_F(TemplatesTest, cacheReuse)
+{
+	QTemporaryDir overridingDirectory;
+	writeTemplate("test.t", "first");
+	const Templates templates{QStringList{overridingDirectory.path(), mDirectory.path()}};
+	EXPECT_EQ("first", templates.readTemplate("test.t"));
+	EXPECT_EQ("fallback", templates.readTemplateIfExists("missing.t", "fallback"));
+
+	// Both read and missing templates are taken from cache until it is cleared.
+	writeTemplate("test.t", "second");
+	writeTemplate("missing.t", "found");
+	EXPECT_EQ("first", templates.readTemplate("test.t"));
+	EXPECT_EQ("fallback", templates.readTemplateIfExists("missing.t", "fallback"));
+	EXPECT_EQ("first", Templates(QStringList{mDirectory.path()}).readTemplate("test.t"));
+
+	TemplateParametrizedEntity::clearTemplatesCache();
+	EXPECT_EQ("second", templates.readTemplate("test.t"));
+	EXPECT_EQ("found", templates.readTemplateIfExists("missing.t", "fallback"));
+
+	// Templates from the first folder override the ones from the second after cache is cleared.
+	QFile overriding(overridingDirectory.path() + "/test.t");
+	ASSERT_TRUE(overriding.open(QIODevice::WriteOnly));
+	overriding.write("overridden");
+	overriding.close();
+	EXPECT_EQ("second", templates.readTemplate("test.t"));
+	TemplateParametrizedEntity::clearTemplatesCache();
+	EXPECT_EQ("overridden", templates.readTemplate("test.t"));
+}
+
+TEST_F(TemplatesTest, wholeLinePlaceholders)
+{
+	const QString mainTemplate =
+			"@@VARIABLES@@\n"
+			"int main()\n"
+			"{\n"
+			"\t@@MAIN_CODE@@\n"
+			"\tx = @@MAIN_CODE@@;\n"
+			"    @@UNKNOWN@@\n"
+			"\t@@INITHOOKS@@\n"
+			"}\n"
+			"  @@THREADS@@";
+	const QMap<QString, QString> code = {
+		{ "@@VARIABLES@@", "int x;\n\nint y;" }
+		, { "@@MAIN_CODE@@", "a();\nif (x) {\n\tb();\n}" }
+		, { "@@INITHOOKS@@", "" }
+		, { "@@THREADS@@", "void thread()\n{\n}" }
+	};
+
+	const QString expected =
+			"int x;\n"
+			"\n"
+			"int y;\n"
+			"int main()\n"
+			"{\n"
+			"\ta();\n"
+			"\tif (x) {\n"
+			"\t\tb();\n"
+			"\t}\n"
+			"\tx = @@MAIN_CODE@@;\n"
+			"    @@UNKNOWN@@\n"
+			"\n"
+			"}\n"
+			"  void thread()\n"
+			"  {\n"
+			"  }";
+	EXPECT_EQ(expected.toStdString(), MasterGenerator::fillMainTemplate(mainTemplate, code).toStdString());
+	EXPECT_EQ(expected.toStdString(), legacyFillMainTemplate(mainTemplate, code).toStdString());
+}
+
+TEST_F(TemplatesTest, emptyLinesSqueezing)
+{
+	const QString mainTemplate = "a\n\n\n\nb\n\n@@EMPTY@@\n\n\nc\n\t@@CODE@@\n\n\n";
+	const QMap<QString, QString> code = {
+		{ "@@EMPTY@@", "" }
+		, { "@@CODE@@", "\n\nd();\n\n\n\ne();\n\n" }
+	};
+
+	const QString expected = "a\n\nb\n\nc\n\td();\n\te();\n\n";
+	EXPECT_EQ(expected.toStdString(), MasterGenerator::fillMainTemplate(mainTemplate, code).toStdString());
+	EXPECT_EQ(expected.toStdString(), legacyFillMainTemplate(mainTemplate, code).toStdString());
+
+	// Code inserted without indentation is squeezed too.
+	const QString unindented = MasterGenerator::fillMainTemplate("x\n@@CODE@@\ny", code);
+	EXPECT_EQ("x\n\nd();\n\ne();\n\ny", unindented.toStdString());
+	EXPECT_EQ(legacyFillMainTemplate("x\n@@CODE@@\ny", code).toStdString(), unindented.toStdString());
+}
@@ -14,6 +14,11 @@
 
 #include "trikV62QtsGeneratorTest.h"
 
+#include <QtCore/QDirIterator>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QTemporaryDir>
+#include <QtCore/QDebug>
+
 #include <trikV62QtsGeneratorPlugin.h>
 
 #include <gmock/gmock.h>
@@ -49,7 +54,36 @@ void TrikV62QtsGeneratorTest::SetUp()
 	mEventsForKitPluginInterface.reset(new kitBase::EventsForKitPluginInterface());
 	mInterpreterControlInterface.reset(new InterpreterControlInterfaceMock());
 
-	mFacade.reset(new QrguiFacade("unittests/smile.qrs"));
+	openSave("unittests/smile.qrs");
+
+	mTestRegistry.reset(new TestRegistry);
+	mTestRegistry->set("pathToGeneratorRoot", ".");
+	mTestRegistry->set("TrikTcpServer", "127.0.0.1");
+
+	mRobotModel.reset(new TestRobotModel());
+
+	ON_CALL(*robotModelManagerInterfaceMock, model()).WillByDefault(Invoke(
+			[this]() -> kitBase::robotModel::RobotModelInterface & {
+				return *mRobotModel;
+			}
+			));
+
+	EXPECT_CALL(*robotModelManagerInterfaceMock, model()).Times(AtLeast(1));
+}
+
+void TrikV62QtsGeneratorTest::openSave(const QString &fileName)
+{
+	mKitPluginConfigurer.reset();
+	mPluginConfigurer.reset();
+	mFacade.reset(new QrguiFacade(fileName));
+
+	const qReal::GraphicalModelAssistInterface &graphicalModel = mFacade->graphicalModelAssistInterface();
+	for (const qReal::Id &diagram : graphicalModel.children(graphicalModel.rootId())) {
+		if (diagram.element() == "RobotsDiagramNode") {
+			mFacade->setActiveTab(diagram);
+		}
+	}
+
 	mPluginConfigurer.reset(new qReal::PluginConfigurator(
 			mFacade->repoControlInterface()
 			, mFacade->graphicalModelAssistInterface()
@@ -70,20 +104,6 @@ void TrikV62QtsGeneratorTest::SetUp()
 			, *mEventsForKitPluginInterface
 			, *mInterpreterControlInterface
 			));
-
-	mTestRegistry.reset(new TestRegistry);
-	mTestRegistry->set("pathToGeneratorRoot", ".");
-	mTestRegistry->set("TrikTcpServer", "127.0.0.1");
-
-	mRobotModel.reset(new TestRobotModel());
-
-	ON_CALL(*robotModelManagerInterfaceMock, model()).WillByDefault(Invoke(
-			[this]() -> kitBase::robotModel::RobotModelInterface & {
-				return *mRobotModel;
-			}
-			));
-
-	EXPECT_CALL(*robotModelManagerInterfaceMock, model()).Times(AtLeast(1));
 }
 
 kitBase::KitPluginConfigurator &TrikV62QtsGeneratorTest::kitPluginConfigurer()
@@ -138,3 +158,38 @@ TEST_F(TrikV62QtsGeneratorTest, incorrectCasingVersionTest)
 	EXPECT_FALSE(controlSimulator().runProgramRequestReceived());
 	EXPECT_TRUE(errorReporter->wereErrors());
 }
+
+TEST_F(TrikV62QtsGeneratorTest, DISABLED_bundledExamplesGenerationBenchmark)
+{
+	const QTemporaryDir output;
+	ASSERT_TRUE(output.isValid());
+	int generated = 0;
+	int failed = 0;
+	qint64 totalTime = 0;
+	QDirIterator it("unittests/examples", {"*.qrs"}, QDir::Files, QDirIterator::Subdirectories);
+	while (it.hasNext()) {
+		const QString fileName = it.next();
+		openSave(fileName);
+		TrikV62QtsGeneratorPlugin plugin;
+		plugin.init(kitPluginConfigurer());
+
+		QElapsedTimer timer;
+		timer.start();
+		const QString generatedFile = plugin.generateCodeInto(output.path());
+		const qint64 time = timer.elapsed();
+		totalTime += time;
+
+		// Examples for other kits use blocks unknown to TRIK generator, they are timed up to the first error.
+		if (generatedFile.isEmpty()) {
+			++failed;
+			qDebug() << "Generation for" << fileName << "failed after" << time << "ms";
+		} else {
+			++generated;
+			qDebug() << "Generation for" << fileName << "took" << time << "ms";
+		}
+	}
+
+	qDebug() << "Generation for" << generated << "examples succeeded and for" << failed << "failed, it took"
+			<< totalTime << "ms";
+	EXPECT_GT(generated, 0);
+}
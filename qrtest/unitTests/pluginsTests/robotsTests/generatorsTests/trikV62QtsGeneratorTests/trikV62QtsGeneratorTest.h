@@ -17,6 +17,7 @@
 #include <gtest/gtest.h>
 
 #include <QtCore/QScopedPointer>
+#include <QtCore/QString>
 
 namespace qrtext {
 namespace lua {
@@ -58,6 +59,10 @@ class TrikV62QtsGeneratorTest : public testing::Test
 protected:
 	void SetUp() override;
 
+	/// Replaces the model used by tests with a model from a given save file and reconfigures plugin configurers
+	/// accordingly. The main diagram of a save file becomes active.
+	void openSave(const QString &fileName);
+
 	/// Provides access to kit plugin configurer object for tests.
 	kitBase::KitPluginConfigurator &kitPluginConfigurer();
 
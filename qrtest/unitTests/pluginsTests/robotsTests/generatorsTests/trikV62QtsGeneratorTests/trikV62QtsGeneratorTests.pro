@@ -28,9 +28,41 @@ INCLUDEPATH += \
 
 HEADERS += \
 	$$PWD/trikV62QtsGeneratorTest.h \
+	$$PWD/structurizatorTest.h \
 
 SOURCES += \
 	$$PWD/trikV62QtsGeneratorTest.cpp \
+	$$PWD/structurizatorTest.cpp \
+	$$PWD/templatesTest.cpp \
+
+# Structurizator is not exported from generator base library, so it is compiled into tests.
+GENERATOR_BASE_SRC = $$PWD/../../../../../../plugins/robots/generators/generatorBase/src
+
+INCLUDEPATH += $$GENERATOR_BASE_SRC
+
+HEADERS += \
+	$$GENERATOR_BASE_SRC/structurizator.h \
+	$$GENERATOR_BASE_SRC/structurizatorNodes/intermediateStructurizatorNode.h \
+	$$GENERATOR_BASE_SRC/structurizatorNodes/simpleStructurizatorNode.h \
+	$$GENERATOR_BASE_SRC/structurizatorNodes/breakStructurizatorNode.h \
+	$$GENERATOR_BASE_SRC/structurizatorNodes/ifStructurizatorNode.h \
+	$$GENERATOR_BASE_SRC/structurizatorNodes/structurizatorNodeWithBreaks.h \
+	$$GENERATOR_BASE_SRC/structurizatorNodes/switchStructurizatorNode.h \
+	$$GENERATOR_BASE_SRC/structurizatorNodes/blockStructurizatorNode.h \
+	$$GENERATOR_BASE_SRC/structurizatorNodes/whileStructurizatorNode.h \
+	$$GENERATOR_BASE_SRC/structurizatorNodes/selfLoopStructurizatorNode.h \
+
+SOURCES += \
+	$$GENERATOR_BASE_SRC/structurizator.cpp \
+	$$GENERATOR_BASE_SRC/structurizatorNodes/intermediateStructurizatorNode.cpp \
+	$$GENERATOR_BASE_SRC/structurizatorNodes/simpleStructurizatorNode.cpp \
+	$$GENERATOR_BASE_SRC/structurizatorNodes/breakStructurizatorNode.cpp \
+	$$GENERATOR_BASE_SRC/structurizatorNodes/ifStructurizatorNode.cpp \
+	$$GENERATOR_BASE_SRC/structurizatorNodes/structurizatorNodeWithBreaks.cpp \
+	$$GENERATOR_BASE_SRC/structurizatorNodes/switchStructurizatorNode.cpp \
+	$$GENERATOR_BASE_SRC/structurizatorNodes/blockStructurizatorNode.cpp \
+	$$GENERATOR_BASE_SRC/structurizatorNodes/whileStructurizatorNode.cpp \
+	$$GENERATOR_BASE_SRC/structurizatorNodes/selfLoopStructurizatorNode.cpp \
 
 HEADERS += \
 	$$PWD/../../../../mocks/plugins/robots/common/kitBase/include/kitBase/robotModel/robotModelManagerInterfaceMock.h \
@@ -38,3 +70,4 @@ HEADERS += \
 	$$PWD/../../support/testRobotModel.h \
 
 copyToDestdir($$PWD/support/testData/unittests, NOW)
+copyToDestdir($$PWD/../../../../../../plugins/robots/examples/examples, NOW, unittests/)
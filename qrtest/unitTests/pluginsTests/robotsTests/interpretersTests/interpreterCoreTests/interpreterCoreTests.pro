@@ -30,14 +30,18 @@ includes(plugins/robots/interpreters \
 HEADERS += \
 	kitPluginManagerTest.h \
 	interpreterTests/interpreterTest.h \
+	interpreterTests/threadTest.h \
 	interpreterTests/detailsTests/blocksTableTest.h \
+	interpreterTests/detailsTests/sensorVariablesUpdaterTest.h \
 	managersTests/sensorsConfigurationManagerTest.h \
 	support/dummySensorsConfigurer.h \
 
 SOURCES += \
 	kitPluginManagerTest.cpp \
 	interpreterTests/interpreterTest.cpp \
+	interpreterTests/threadTest.cpp \
 	interpreterTests/detailsTests/blocksTableTest.cpp \
+	interpreterTests/detailsTests/sensorVariablesUpdaterTest.cpp \
 	managersTests/sensorsConfigurationManagerTest.cpp \
 	support/dummySensorsConfigurer.cpp \
 
@@ -48,9 +52,15 @@ include(mocks.pri)
 HEADERS += \
 	support/dummyBlock.h \
 	support/dummyBlocksFactory.h \
+	support/dummyBlocksTable.h \
+	support/failingBlock.h \
+	support/waitingBlock.h \
 
 SOURCES += \
 	support/dummyBlock.cpp \
 	support/dummyBlocksFactory.cpp \
+	support/dummyBlocksTable.cpp \
+	support/failingBlock.cpp \
+	support/waitingBlock.cpp \
 
 copyToDestdir(../support/testData/unittests, NOW)
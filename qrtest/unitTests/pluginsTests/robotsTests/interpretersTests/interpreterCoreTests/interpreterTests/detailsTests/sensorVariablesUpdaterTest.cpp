@@ -0,0 +1,133 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include "sensorVariablesUpdaterTest.h"
+
+#include <kitBase/robotModel/robotParts/touchSensor.h>
+
+#include "interpreterCore/interpreter/details/sensorVariablesUpdater.h"
+
+using namespace qrTest::robotsTests::interpreterCoreTests::detailsTests;
+using namespace interpreterCore::interpreter::details;
+using namespace kitBase::robotModel;
+
+using namespace ::testing;
+
+namespace {
+
+/// Touch sensor that does not need a robot to be read.
+class TestTouchSensor : public robotParts::TouchSensor
+{
+public:
+	explicit TestTouchSensor(const PortInfo &port)
+		: robotParts::TouchSensor(DeviceInfo::create<robotParts::TouchSensor>(), port)
+	{
+	}
+
+	void read() override
+	{
+	}
+};
+
+}
+
+void SensorVariablesUpdaterTest::SetUp()
+{
+	const QList<PortInfo> ports = {
+		PortInfo("1", input, {}, "sensor1")
+		, PortInfo("2", input, {}, "sensor2")
+	};
+
+	for (const PortInfo &port : ports) {
+		mSensors << new TestTouchSensor(port);
+	}
+
+	ON_CALL(mConfiguration, devices()).WillByDefault(Return(mSensors));
+	EXPECT_CALL(mConfiguration, devices()).Times(AtLeast(0));
+
+	ON_CALL(mModel, robotId()).WillByDefault(Return("mockRobot"));
+	EXPECT_CALL(mModel, robotId()).Times(AtLeast(0));
+
+	ON_CALL(mModel, availablePorts()).WillByDefault(Return(ports));
+	EXPECT_CALL(mModel, availablePorts()).Times(AtLeast(0));
+
+	ON_CALL(mModel, buttonCodes()).WillByDefault(Return(StringIntHash()));
+	EXPECT_CALL(mModel, buttonCodes()).Times(AtLeast(0));
+
+	ON_CALL(mModel, configuration()).WillByDefault(ReturnRef(mConfiguration));
+	EXPECT_CALL(mModel, configuration()).Times(AtLeast(0));
+
+	ON_CALL(mModel, timeline()).WillByDefault(ReturnRef(mTimeline));
+	EXPECT_CALL(mModel, timeline()).Times(AtLeast(0));
+
+	ON_CALL(mModel, updateIntervalForInterpretation()).WillByDefault(Return(1000));
+	EXPECT_CALL(mModel, updateIntervalForInterpretation()).Times(AtLeast(0));
+
+	ON_CALL(mModel, updateSensorsValuesOnPorts(_)).WillByDefault(Invoke([this](const QList<PortInfo> &ports) {
+		for (const PortInfo &port : ports) {
+			mPolledVariables << port.reservedVariable();
+		}
+	}));
+
+	// Updater shall always ask the model, even if nothing is demanded: model may have its own sensor readers.
+	EXPECT_CALL(mModel, updateSensorsValuesOnPorts(_)).Times(AtLeast(1));
+	EXPECT_CALL(mModel, updateSensorsValues()).Times(0);
+
+	ON_CALL(mModelManager, model()).WillByDefault(ReturnRef(mModel));
+	EXPECT_CALL(mModelManager, model()).Times(AtLeast(1));
+
+	mParser.reset(new interpreterCore::textLanguage::RobotsBlockParser(mModelManager, []() { return 0; }));
+}
+
+void SensorVariablesUpdaterTest::TearDown()
+{
+	mParser.reset();
+	qDeleteAll(mSensors);
+	mSensors.clear();
+}
+
+QStringList SensorVariablesUpdaterTest::poll()
+{
+	SensorVariablesUpdater updater(mModelManager, *mParser);
+	updater.setProgramIdentifiersProvider([this]() { return mProgramIdentifiers; });
+	updater.setWatchedVariables(mWatchedVariables);
+	updater.run();
+	updater.suspend();
+	return mPolledVariables;
+}
+
+TEST_F(SensorVariablesUpdaterTest, unusedSensorsAreSkipped)
+{
+	mProgramIdentifiers = {"x", "y"};
+	ASSERT_EQ(QStringList(), poll());
+}
+
+TEST_F(SensorVariablesUpdaterTest, programSensorsArePolled)
+{
+	mProgramIdentifiers = {"x", "sensor2"};
+	ASSERT_EQ(QStringList{"sensor2"}, poll());
+}
+
+TEST_F(SensorVariablesUpdaterTest, watchedSensorsArePolled)
+{
+	mWatchedVariables = QStringList{"sensor1"};
+	ASSERT_EQ(QStringList{"sensor1"}, poll());
+}
+
+TEST_F(SensorVariablesUpdaterTest, referencedSensorsArePolled)
+{
+	ASSERT_EQ(1, mParser->interpret<int>(qReal::Id("a", "b", "c", "d"), "test", "sensor1 + 1"));
+	ASSERT_EQ(QStringList{"sensor1"}, poll());
+}
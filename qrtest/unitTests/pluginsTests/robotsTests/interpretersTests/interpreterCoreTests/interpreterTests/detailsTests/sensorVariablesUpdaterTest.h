@@ -0,0 +1,57 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#pragma once
+
+#include <QtCore/QScopedPointer>
+#include <QtCore/QSet>
+
+#include <gtest/gtest.h>
+
+#include <kitBase/robotModel/robotModelInterfaceMock.h>
+#include <kitBase/robotModel/robotModelManagerInterfaceMock.h>
+#include <kitBase/robotModel/configurationInterfaceMock.h>
+#include <interpreterCore/textLanguage/robotsBlockParser.h>
+#include <utils/realTimeline.h>
+
+namespace qrTest {
+namespace robotsTests {
+namespace interpreterCoreTests {
+namespace detailsTests {
+
+class SensorVariablesUpdaterTest : public testing::Test
+{
+protected:
+	void SetUp() override;
+	void TearDown() override;
+
+	/// Starts sensor variables updater, lets it poll sensors once and returns reserved variables of polled sensors.
+	QStringList poll();
+
+	utils::RealTimeline mTimeline;
+	RobotModelInterfaceMock mModel;
+	RobotModelManagerInterfaceMock mModelManager;
+	ConfigurationInterfaceMock mConfiguration;
+	QList<kitBase::robotModel::robotParts::Device *> mSensors;
+	QScopedPointer<interpreterCore::textLanguage::RobotsBlockParser> mParser;
+	QSet<QString> mProgramIdentifiers;
+	QStringList mWatchedVariables;
+	QStringList mPolledVariables;
+};
+
+}
+}
+}
+}
@@ -0,0 +1,155 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include "threadTest.h"
+
+#include <QtCore/QEventLoop>
+#include <QtCore/QTimer>
+
+#include <qrutils/interpreter/thread.h>
+#include <testUtils/testRegistry.h>
+
+#include "support/dummyBlock.h"
+#include "support/failingBlock.h"
+#include "support/waitingBlock.h"
+
+using namespace qrTest::robotsTests::interpreterCoreTests;
+using namespace qReal;
+using namespace qReal::interpretation;
+
+/// Time in ms after which a thread that does not stop is considered hung.
+const int threadTimeout = 5000;
+
+void ThreadTest::SetUp()
+{
+	mQrguiFacade.reset(new QrguiFacade("unittests/basicTest.qrs"));
+	mDiagram = Id::loadFromString(
+			"qrm:/RobotsMetamodel/RobotsDiagram/RobotsDiagramNode/{f08fa823-e187-4755-87ba-e4269ae4e798}");
+
+	mBlocksTable.reset(new DummyBlocksTable(mQrguiFacade->graphicalModelAssistInterface()
+			, *mQrguiFacade->mainWindowInterpretersInterface().errorReporter()
+			, [this] (const Id &id) -> Block * {
+				Block * const block = mFailingBlocks.contains(id)
+						? static_cast<Block *>(new FailingBlock)
+						: mWaitingBlocks.contains(id)
+								? static_cast<Block *>(new WaitingBlock)
+								: static_cast<Block *>(new DummyBlock);
+				QObject::connect(block, &BlockInterface::done, [this, id]() { mFinishedBlocks << id; });
+				return block;
+			}));
+}
+
+StopReason ThreadTest::run(bool fastMode, const Id &diagram)
+{
+	TestRegistry registry;
+	registry.set("interpreterFastMode", fastMode);
+
+	Thread thread(&mQrguiFacade->graphicalModelAssistInterface()
+			, mQrguiFacade->mainWindowInterpretersInterface()
+			, Id("RobotsMetamodel", "RobotsDiagram", "InitialNode")
+			, diagram
+			, *mBlocksTable
+			, "main");
+
+	QEventLoop loop;
+	bool stopped = false;
+	StopReason reason = StopReason::finised;
+	QObject::connect(&thread, &Thread::stopped, [&] (StopReason stopReason) {
+		stopped = true;
+		reason = stopReason;
+		loop.quit();
+	});
+
+	thread.interpret();
+	if (!stopped) {
+		if (!mWaitingBlocks.isEmpty()) {
+			QTimer::singleShot(0, &thread, [&thread]() { thread.stop(StopReason::userStop); });
+		}
+
+		QTimer::singleShot(threadTimeout, &loop, &QEventLoop::quit);
+		loop.exec();
+	}
+
+	EXPECT_TRUE(stopped);
+	return reason;
+}
+
+Id ThreadTest::blockOfType(const QString &element) const
+{
+	for (const Id &child : mQrguiFacade->graphicalModelAssistInterface().graphicalRepoApi().children(mDiagram)) {
+		if (child.element() == element) {
+			return child;
+		}
+	}
+
+	return Id();
+}
+
+TEST_F(ThreadTest, chainIsExecutedInNormalMode)
+{
+	EXPECT_EQ(StopReason::finised, run(false, mDiagram));
+	const QList<Id> expected = { blockOfType("InitialNode"), blockOfType("NxtEnginesForward")
+			, blockOfType("FinalNode") };
+	EXPECT_EQ(expected, mFinishedBlocks);
+}
+
+TEST_F(ThreadTest, chainIsExecutedInFastMode)
+{
+	EXPECT_EQ(StopReason::finised, run(true, mDiagram));
+	const QList<Id> expected = { blockOfType("InitialNode"), blockOfType("NxtEnginesForward")
+			, blockOfType("FinalNode") };
+	EXPECT_EQ(expected, mFinishedBlocks);
+}
+
+TEST_F(ThreadTest, failureIsReportedInNormalMode)
+{
+	mFailingBlocks << blockOfType("NxtEnginesForward");
+	EXPECT_EQ(StopReason::error, run(false, mDiagram));
+	EXPECT_EQ(QList<Id>({ blockOfType("InitialNode") }), mFinishedBlocks);
+}
+
+TEST_F(ThreadTest, failureIsReportedInFastMode)
+{
+	mFailingBlocks << blockOfType("NxtEnginesForward");
+	EXPECT_EQ(StopReason::error, run(true, mDiagram));
+	EXPECT_EQ(QList<Id>({ blockOfType("InitialNode") }), mFinishedBlocks);
+}
+
+TEST_F(ThreadTest, stopIsReportedInNormalMode)
+{
+	mWaitingBlocks << blockOfType("NxtEnginesForward");
+	EXPECT_EQ(StopReason::userStop, run(false, mDiagram));
+	EXPECT_EQ(QList<Id>({ blockOfType("InitialNode") }), mFinishedBlocks);
+}
+
+TEST_F(ThreadTest, stopIsReportedInFastMode)
+{
+	mWaitingBlocks << blockOfType("NxtEnginesForward");
+	EXPECT_EQ(StopReason::userStop, run(true, mDiagram));
+	EXPECT_EQ(QList<Id>({ blockOfType("InitialNode") }), mFinishedBlocks);
+}
+
+TEST_F(ThreadTest, missingInitialNodeIsReportedInNormalMode)
+{
+	// Final node has no children, so there is nothing to start from.
+	EXPECT_EQ(StopReason::error, run(false, blockOfType("FinalNode")));
+	EXPECT_TRUE(mFinishedBlocks.isEmpty());
+}
+
+TEST_F(ThreadTest, missingInitialNodeIsReportedInFastMode)
+{
+	EXPECT_EQ(StopReason::error, run(true, blockOfType("FinalNode")));
+	EXPECT_TRUE(mFinishedBlocks.isEmpty());
+}
@@ -0,0 +1,62 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#pragma once
+
+#include <QtCore/QScopedPointer>
+#include <QtCore/QSet>
+
+#include <gtest/gtest.h>
+
+#include <qrutils/interpreter/stopReason.h>
+#include <testUtils/qrguiFacade.h>
+
+#include "support/dummyBlocksTable.h"
+
+namespace qrTest {
+namespace robotsTests {
+namespace interpreterCoreTests {
+
+/// Tests for interpreter thread, both in normal and in fast mode. Test diagram is a chain of three blocks:
+/// initial node, engines block and final node.
+class ThreadTest : public testing::Test
+{
+protected:
+	void SetUp() override;
+
+	/// Runs a thread from initial node of a given diagram and returns the reason it has stopped with.
+	/// Blocks that wait forever are stopped by user.
+	qReal::interpretation::StopReason run(bool fastMode, const qReal::Id &diagram);
+
+	/// Returns id of the first block of a given type on test diagram.
+	qReal::Id blockOfType(const QString &element) const;
+
+	QScopedPointer<QrguiFacade> mQrguiFacade;
+	QScopedPointer<DummyBlocksTable> mBlocksTable;
+	qReal::Id mDiagram;
+
+	/// Blocks that report an error when run.
+	QSet<qReal::Id> mFailingBlocks;
+
+	/// Blocks that never finish.
+	QSet<qReal::Id> mWaitingBlocks;
+
+	/// Ids of blocks that have finished, in order of execution.
+	QList<qReal::Id> mFinishedBlocks;
+};
+
+}
+}
+}
@@ -0,0 +1,61 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include "dummyBlocksTable.h"
+
+using namespace qrTest::robotsTests::interpreterCoreTests;
+using namespace qReal;
+
+DummyBlocksTable::DummyBlocksTable(const GraphicalModelAssistInterface &graphicalModelApi
+		, ErrorReporterInterface &errorReporter
+		, const std::function<interpretation::Block *(const Id &)> &factory)
+	: mGraphicalModelApi(graphicalModelApi)
+	, mErrorReporter(errorReporter)
+	, mFactory(factory)
+{
+}
+
+DummyBlocksTable::~DummyBlocksTable()
+{
+	clear();
+}
+
+interpretation::BlockInterface *DummyBlocksTable::block(const Id &element)
+{
+	if (element.isNull()) {
+		return nullptr;
+	}
+
+	if (!mBlocks.contains(element)) {
+		interpretation::Block * const newBlock = mFactory(element);
+		newBlock->init(element, &mGraphicalModelApi, nullptr, &mErrorReporter, nullptr);
+		mBlocks.insert(element, newBlock);
+	}
+
+	return mBlocks.value(element);
+}
+
+void DummyBlocksTable::clear()
+{
+	qDeleteAll(mBlocks);
+	mBlocks.clear();
+}
+
+void DummyBlocksTable::setFailure()
+{
+	for (interpretation::Block * const block : mBlocks) {
+		block->setFailedStatus();
+	}
+}
@@ -0,0 +1,53 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#pragma once
+
+#include <functional>
+
+#include <QtCore/QHash>
+
+#include <qrutils/interpreter/block.h>
+#include <qrutils/interpreter/blocksTableInterface.h>
+
+namespace qrTest {
+namespace robotsTests {
+namespace interpreterCoreTests {
+
+/// Blocks table that creates blocks with a given function and initializes them without text language support,
+/// so it can be used to test threads without robot model and interpreter.
+class DummyBlocksTable : public qReal::interpretation::BlocksTableInterface
+{
+public:
+	DummyBlocksTable(const qReal::GraphicalModelAssistInterface &graphicalModelApi
+			, qReal::ErrorReporterInterface &errorReporter
+			, const std::function<qReal::interpretation::Block *(const qReal::Id &)> &factory);
+
+	~DummyBlocksTable() override;
+
+	qReal::interpretation::BlockInterface *block(const qReal::Id &element) override;
+	void clear() override;
+	void setFailure() override;
+
+private:
+	const qReal::GraphicalModelAssistInterface &mGraphicalModelApi;
+	qReal::ErrorReporterInterface &mErrorReporter;
+	std::function<qReal::interpretation::Block *(const qReal::Id &)> mFactory;
+	QHash<qReal::Id, qReal::interpretation::Block *> mBlocks;  // Has ownership
+};
+
+}
+}
+}
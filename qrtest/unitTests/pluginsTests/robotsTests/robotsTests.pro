@@ -15,6 +15,7 @@
 TEMPLATE = subdirs
 
 SUBDIRS = \
+	checkerTests \
 	commonTests \
 	generatorsTests \
 	interpretersTests \
@@ -0,0 +1,123 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include <QtXml/QDomDocument>
+
+#include <qrkernel/exception/exception.h>
+#include <metaMetaModel/metamodel.h>
+#include <metaMetaModel/nodeElementType.h>
+
+#include "gtest/gtest.h"
+
+using namespace qReal;
+
+namespace {
+
+/// Node type that fills its data in the way generated editor plugins do and counts initializations.
+class TestNodeType : public NodeElementType
+{
+public:
+	TestNodeType(Metamodel &metamodel, const QString &name, const QDomElement &sdf = QDomElement())
+		: NodeElementType(metamodel)
+		, mSdf(sdf)
+		, mInitializations(0)
+	{
+		setName(name);
+		setFriendlyName(name);
+		setDiagram("TestDiagram");
+		setDescription("Test node");
+	}
+
+	int initializations() const
+	{
+		return mInitializations;
+	}
+
+protected:
+	void initialize() override
+	{
+		++mInitializations;
+		addLabel(QSharedPointer<LabelProperties>(new LabelProperties(1, 0.5, -0.7, "Port", false, 0)));
+		if (!mSdf.isNull()) {
+			loadSdf(mSdf);
+		}
+
+		setSize(QSizeF(50, 50));
+		addProperty("Port", "string", "A1", "Port", "", false);
+		addProperty("Value", "int", "0", "Value", "", false);
+		addLinePort(LinePortInfo(QLineF(0, 0.1, 0, 0.9), false, false, false, false, 50, 50, "NonTyped"));
+		addLinePort(LinePortInfo(QLineF(1, 0.1, 1, 0.9), false, false, false, false, 50, 50, "NonTyped"));
+		setResizable(false);
+	}
+
+private:
+	const QDomElement mSdf;
+	int mInitializations;
+};
+
+}
+
+TEST(MetamodelTest, typesAreInitializedOnFirstUse)
+{
+	Metamodel metamodel;
+	TestNodeType * const type = new TestNodeType(metamodel, "Node");
+	metamodel.addNode(type);
+
+	EXPECT_EQ("Node", metamodel.elementType("TestDiagram", "Node").name());
+	EXPECT_EQ("Node", type->friendlyName());
+	EXPECT_EQ(0, type->initializations());
+
+	EXPECT_EQ(QStringList({"Port", "Value"}), type->propertyNames());
+	EXPECT_EQ(1, type->labels().size());
+	EXPECT_EQ(2, type->linePorts().size());
+	EXPECT_EQ(QSizeF(50, 50), type->size());
+	EXPECT_EQ(1, type->initializations());
+}
+
+TEST(MetamodelTest, modificationsAreNotOverwrittenByInitialization)
+{
+	Metamodel metamodel;
+	TestNodeType * const type = new TestNodeType(metamodel, "Node");
+	metamodel.addNode(type);
+
+	type->addProperty("Value", "int", "42", "Value", "", false);
+	EXPECT_EQ(1, type->initializations());
+	EXPECT_EQ("42", type->propertyDefaultValue("Value"));
+	EXPECT_EQ(QStringList({"Port", "Value"}), type->propertyNames());
+}
+
+TEST(MetamodelTest, elementsLookup)
+{
+	Metamodel metamodel;
+	metamodel.addNode(new TestNodeType(metamodel, "C"));
+	metamodel.addNode(new TestNodeType(metamodel, "A"));
+	metamodel.addNode(new TestNodeType(metamodel, "B"));
+
+	QStringList names;
+	for (const ElementType * const type : metamodel.elements("TestDiagram")) {
+		names << type->name();
+	}
+
+	EXPECT_EQ(QStringList({"A", "B", "C"}), names);
+	EXPECT_TRUE(metamodel.elements("OtherDiagram").isEmpty());
+
+	EXPECT_TRUE(metamodel.hasElement("TestDiagram", "B"));
+	EXPECT_FALSE(metamodel.hasElement("TestDiagram", "D"));
+	EXPECT_FALSE(metamodel.hasElement("OtherDiagram", "B"));
+
+	EXPECT_EQ("B", metamodel.elementType(Id("TestEditor", "TestDiagram", "B")).name());
+	EXPECT_THROW(metamodel.elementType("TestDiagram", "D"), qReal::Exception);
+	EXPECT_THROW(metamodel.elementType("OtherDiagram", "B"), qReal::Exception);
+}
@@ -0,0 +1,127 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include "graphicalModelTest.h"
+
+#include <models/details/graphicalModel.h>
+
+using namespace qrguiTests;
+using namespace qReal;
+using namespace qReal::models;
+
+const Id logicalElement("editor", "diagram", "element", "logical");
+const Id otherLogicalElement("editor", "diagram", "element", "otherLogical");
+const Id graphicalElement("editor", "diagram", "element", "graphical");
+const Id secondGraphicalElement("editor", "diagram", "element", "secondGraphical");
+const Id otherGraphicalElement("editor", "diagram", "element", "otherGraphical");
+
+void GraphicalModelTest::SetUp()
+{
+	mModels.reset(new Models("graphicalModelTest.qrs", mEditorManager));
+}
+
+void GraphicalModelTest::addElement(const Id &id, const Id &logicalId, const Id &parent)
+{
+	ElementInfo element(id, logicalId, Id::rootId(), parent, {}, {}, Id(), false);
+	static_cast<details::GraphicalModel *>(mModels->graphicalModel())->addElementToModel(element);
+}
+
+QSet<Id> GraphicalModelTest::graphicalIds(const Id &logicalId) const
+{
+	return mModels->graphicalModelAssistApi().graphicalIdsByLogicalId(logicalId).toSet();
+}
+
+TEST_F(GraphicalModelTest, lookupAfterAdd)
+{
+	EXPECT_TRUE(graphicalIds(logicalElement).isEmpty());
+
+	addElement(graphicalElement, logicalElement);
+	addElement(secondGraphicalElement, logicalElement);
+	addElement(otherGraphicalElement, otherLogicalElement);
+
+	EXPECT_EQ(QSet<Id>({ graphicalElement, secondGraphicalElement }), graphicalIds(logicalElement));
+	EXPECT_EQ(QSet<Id>({ otherGraphicalElement }), graphicalIds(otherLogicalElement));
+	EXPECT_TRUE(graphicalIds(Id("editor", "diagram", "element", "unknown")).isEmpty());
+}
+
+TEST_F(GraphicalModelTest, lookupAfterAddingSeveralElements)
+{
+	ElementInfo parent(graphicalElement, logicalElement, Id::rootId(), Id::rootId(), {}, {}, Id(), false);
+	ElementInfo child(otherGraphicalElement, otherLogicalElement, logicalElement, graphicalElement
+			, {}, {}, Id(), false);
+	ElementInfo sibling(secondGraphicalElement, logicalElement, Id::rootId(), Id::rootId(), {}, {}, Id(), false);
+	QList<ElementInfo> elements = { parent, child, sibling };
+	mModels->graphicalModelAssistApi().createElements(elements);
+
+	EXPECT_EQ(QSet<Id>({ graphicalElement, secondGraphicalElement }), graphicalIds(logicalElement));
+	EXPECT_EQ(QSet<Id>({ otherGraphicalElement }), graphicalIds(otherLogicalElement));
+}
+
+TEST_F(GraphicalModelTest, lookupAfterRemove)
+{
+	addElement(graphicalElement, logicalElement);
+	addElement(secondGraphicalElement, logicalElement);
+	addElement(otherGraphicalElement, otherLogicalElement);
+
+	mModels->graphicalModelAssistApi().removeElement(graphicalElement);
+	EXPECT_EQ(QSet<Id>({ secondGraphicalElement }), graphicalIds(logicalElement));
+	EXPECT_EQ(QSet<Id>({ otherGraphicalElement }), graphicalIds(otherLogicalElement));
+
+	mModels->graphicalModelAssistApi().removeElement(secondGraphicalElement);
+	EXPECT_TRUE(graphicalIds(logicalElement).isEmpty());
+	EXPECT_EQ(QSet<Id>({ otherGraphicalElement }), graphicalIds(otherLogicalElement));
+}
+
+TEST_F(GraphicalModelTest, lookupAfterRemovingParent)
+{
+	addElement(graphicalElement, logicalElement);
+	addElement(otherGraphicalElement, otherLogicalElement, graphicalElement);
+	addElement(secondGraphicalElement, logicalElement, graphicalElement);
+
+	mModels->graphicalModelAssistApi().removeElement(graphicalElement);
+	EXPECT_TRUE(graphicalIds(logicalElement).isEmpty());
+	EXPECT_TRUE(graphicalIds(otherLogicalElement).isEmpty());
+}
+
+TEST_F(GraphicalModelTest, lookupAfterReinit)
+{
+	addElement(graphicalElement, logicalElement);
+	addElement(secondGraphicalElement, logicalElement);
+	addElement(otherGraphicalElement, otherLogicalElement, graphicalElement);
+
+	mModels->reinit();
+	EXPECT_EQ(QSet<Id>({ graphicalElement, secondGraphicalElement }), graphicalIds(logicalElement));
+	EXPECT_EQ(QSet<Id>({ otherGraphicalElement }), graphicalIds(otherLogicalElement));
+
+	// Items from the index are used directly, so stale ones would crash here.
+	auto graphicalModel = static_cast<details::GraphicalModel *>(mModels->graphicalModel());
+	graphicalModel->updateElements(logicalElement, "renamed");
+	EXPECT_EQ("renamed", mModels->graphicalRepoApi().name(graphicalElement));
+	EXPECT_EQ("renamed", mModels->graphicalRepoApi().name(secondGraphicalElement));
+	EXPECT_NE("renamed", mModels->graphicalRepoApi().name(otherGraphicalElement));
+}
+
+TEST_F(GraphicalModelTest, lookupAfterClear)
+{
+	addElement(graphicalElement, logicalElement);
+	addElement(secondGraphicalElement, logicalElement);
+
+	mModels->repoControlApi().exterminate();
+	mModels->reinit();
+	EXPECT_TRUE(graphicalIds(logicalElement).isEmpty());
+
+	addElement(otherGraphicalElement, logicalElement);
+	EXPECT_EQ(QSet<Id>({ otherGraphicalElement }), graphicalIds(logicalElement));
+}
@@ -0,0 +1,43 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#pragma once
+
+#include <QtCore/QScopedPointer>
+
+#include <gtest/gtest.h>
+
+#include <models/models.h>
+#include <plugins/pluginManager/editorManager.h>
+
+namespace qrguiTests {
+
+/// Tests for lookup of graphical elements by logical ids in graphical model.
+class GraphicalModelTest : public testing::Test
+{
+protected:
+	void SetUp() override;
+
+	/// Adds graphical element with given id depicting given logical element to graphical model.
+	void addElement(const qReal::Id &id, const qReal::Id &logicalId, const qReal::Id &parent = qReal::Id::rootId());
+
+	/// Returns a set of graphical ids depicting given logical element according to graphical model.
+	QSet<qReal::Id> graphicalIds(const qReal::Id &logicalId) const;
+
+	qReal::EditorManager mEditorManager;
+	QScopedPointer<qReal::models::Models> mModels;
+};
+
+}
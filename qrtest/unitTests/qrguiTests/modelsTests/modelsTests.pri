@@ -20,7 +20,9 @@ HEADERS += \
 	$$PWD/../../mocks/qrgui/models/details/modelsImplementation/modelIndexesInterfaceMock.h \
 
 HEADERS += \
+	$$PWD/detailsTests/graphicalModelTest.h \
 	$$PWD/detailsTests/graphicalPartModelTest.h \
 
 SOURCES += \
+	$$PWD/detailsTests/graphicalModelTest.cpp \
 	$$PWD/detailsTests/graphicalPartModelTest.cpp \
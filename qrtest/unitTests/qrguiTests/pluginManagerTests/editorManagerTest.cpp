@@ -0,0 +1,225 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QSet>
+#include <QtCore/QTemporaryDir>
+#include <QtCore/QDebug>
+
+#include <qrkernel/platformInfo.h>
+#include <qrgui/plugins/pluginManager/editorManager.h>
+#include <metaMetaModel/elementType.h>
+#include <metaMetaModel/edgeElementType.h>
+
+#include "mainWindow/palette/paletteElement.h"
+
+#include "gtest/gtest.h"
+
+using namespace qReal;
+
+namespace {
+
+/// Folder with mock editor plugin built for these tests, relative to tests binary.
+const QString mockPlugins = "plugins/unittests/editors";
+
+/// Returns resident memory of this process in kilobytes or 0 if it is unknown on this platform.
+qint64 residentMemory()
+{
+	QFile status("/proc/self/status");
+	if (!status.open(QIODevice::ReadOnly)) {
+		return 0;
+	}
+
+	for (const QByteArray &line : status.readAll().split('\n')) {
+		if (line.startsWith("VmRSS:")) {
+			return line.mid(6).trimmed().split(' ').first().toLongLong();
+		}
+	}
+
+	return 0;
+}
+
+/// Requests from editor manager everything that palette needs to show the given element.
+void showElement(const EditorManager &manager, const Id &element)
+{
+	const gui::PaletteElement paletteElement(manager, element);
+	Q_UNUSED(paletteElement)
+	manager.mouseGesture(element);
+	manager.isNodeOrEdge(element.type());
+}
+
+/// Requests from editor manager everything that palette needs to show elements of all diagrams, like
+/// PaletteTreeWidgets and DraggableElement do. Returns ids of elements that are not shown in palette.
+IdList loadPalette(const EditorManager &manager)
+{
+	IdList hiddenElements;
+	for (const Id &editor : manager.editors()) {
+		for (const Id &diagram : manager.diagrams(editor)) {
+			const IdList elements = manager.elements(diagram);
+			manager.shallPaletteBeSorted(editor, diagram);
+			const QStringList groups = manager.paletteGroups(editor, diagram);
+			if (groups.isEmpty()) {
+				// All elements are shown.
+				for (const Id &element : elements) {
+					showElement(manager, element);
+				}
+
+				continue;
+			}
+
+			QSet<QString> shown;
+			for (const QString &group : groups) {
+				manager.paletteGroupDescription(editor, diagram, group);
+				for (const QString &name : manager.paletteGroupList(editor, diagram, group)) {
+					shown << name;
+				}
+			}
+
+			for (const Id &element : elements) {
+				if (shown.contains(element.element())) {
+					showElement(manager, element);
+				} else {
+					hiddenElements << element;
+				}
+			}
+		}
+	}
+
+	return hiddenElements;
+}
+
+}
+
+class EditorManagerTest : public testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		ASSERT_TRUE(mCacheDirectory.isValid());
+	}
+
+	QTemporaryDir mCacheDirectory;
+};
+
+TEST_F(EditorManagerTest, typesAbsentFromPaletteAreNotInitialized)
+{
+	// Plugin is loaded without cache, then it is loaded and cached, then its metamodel is read from cache.
+	for (const QString &cacheDirectory : {QString(), mCacheDirectory.path(), mCacheDirectory.path()}) {
+		const EditorManager manager(mockPlugins, cacheDirectory);
+		ASSERT_EQ(IdList{Id("MockMetamodel")}, manager.editors());
+		const IdList hiddenElements = loadPalette(manager);
+
+		// Abstract action and diagram node are never shown in palette.
+		ASSERT_EQ(2, hiddenElements.size());
+		for (const Id &element : hiddenElements) {
+			EXPECT_FALSE(manager.elementType(element).isInitialized()) << element.toString().toStdString();
+		}
+	}
+}
+
+TEST_F(EditorManagerTest, cachedMetamodelsMatchPlugins)
+{
+	const EditorManager plugins(mockPlugins, QString());
+	{
+		// Loads plugins and fills the cache.
+		const EditorManager manager(mockPlugins, mCacheDirectory.path());
+	}
+
+	const EditorManager cached(mockPlugins, mCacheDirectory.path());
+	ASSERT_EQ(IdList{Id("MockMetamodel")}, plugins.editors());
+	ASSERT_EQ(plugins.editors(), cached.editors());
+	for (const Id &editor : plugins.editors()) {
+		EXPECT_EQ(plugins.version(editor), cached.version(editor));
+		ASSERT_EQ(plugins.diagrams(editor), cached.diagrams(editor));
+		for (const Id &diagram : plugins.diagrams(editor)) {
+			EXPECT_EQ(plugins.paletteGroups(editor, diagram), cached.paletteGroups(editor, diagram));
+			ASSERT_EQ(plugins.elements(diagram).toSet(), cached.elements(diagram).toSet());
+			for (const Id &element : plugins.elements(diagram)) {
+				const ElementType &pluginType = plugins.elementType(element);
+				const ElementType &cachedType = cached.elementType(element);
+				EXPECT_FALSE(cachedType.isInitialized());
+				EXPECT_EQ(pluginType.friendlyName(), cachedType.friendlyName());
+				EXPECT_EQ(pluginType.propertyNames(), cachedType.propertyNames());
+				EXPECT_EQ(pluginType.labels().size(), cachedType.labels().size());
+				EXPECT_EQ(pluginType.containedTypes().toSet(), cachedType.containedTypes().toSet());
+				if (pluginType.type() == ElementType::Type::edge) {
+					EXPECT_EQ(pluginType.toEdge().startArrowStyle(), cachedType.toEdge().startArrowStyle());
+					EXPECT_EQ(pluginType.toEdge().endArrowStyle(), cachedType.toEdge().endArrowStyle());
+				}
+			}
+		}
+	}
+}
+
+TEST_F(EditorManagerTest, metamodelReadFromCacheIsUnloadedWithoutPlugin)
+{
+	{
+		// Loads plugins and fills the cache.
+		const EditorManager manager(mockPlugins, mCacheDirectory.path());
+	}
+
+	EditorManager cached(mockPlugins, mCacheDirectory.path());
+	ASSERT_EQ(IdList{Id("MockMetamodel")}, cached.editors());
+	EXPECT_EQ(QString(), cached.unloadPlugin("MockMetamodel"));
+	EXPECT_TRUE(cached.editors().isEmpty());
+}
+
+TEST_F(EditorManagerTest, DISABLED_loadingBenchmark)
+{
+	// Real editor plugins are measured, so robots editors must be built.
+	const QString plugins = PlatformInfo::invariantSettingsPath("pathToEditorPlugins");
+	qint64 memory = residentMemory();
+	QElapsedTimer timer;
+	timer.start();
+	{
+		const EditorManager manager(plugins, QString());
+		qDebug() << "Loading of editor plugins without cache took" << timer.elapsed() << "ms and"
+				<< residentMemory() - memory << "KiB";
+	}
+
+	timer.restart();
+	{
+		const EditorManager manager(plugins, mCacheDirectory.path());
+		qDebug() << "Loading of editor plugins with cache filling took" << timer.elapsed() << "ms";
+	}
+
+	memory = residentMemory();
+	timer.restart();
+	const EditorManager manager(plugins, mCacheDirectory.path());
+	qDebug() << "Loading of cached editor plugins took" << timer.elapsed() << "ms and"
+			<< residentMemory() - memory << "KiB";
+
+	memory = residentMemory();
+	timer.restart();
+	loadPalette(manager);
+	qDebug() << "Loading of palette took" << timer.elapsed() << "ms and" << residentMemory() - memory << "KiB";
+
+	// Before element types became lazy all of them were built in full while plugins were loaded.
+	int types = 0;
+	memory = residentMemory();
+	timer.restart();
+	for (const Id &editor : manager.editors()) {
+		for (const Id &diagram : manager.diagrams(editor)) {
+			for (const Id &element : manager.elements(diagram)) {
+				manager.elementType(element).labels();
+				++types;
+			}
+		}
+	}
+
+	qDebug() << "Materialization of the rest of" << types << "types took" << timer.elapsed() << "ms and"
+			<< residentMemory() - memory << "KiB";
+}
@@ -0,0 +1,276 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QLocale>
+#include <QtCore/QTemporaryDir>
+#include <QtXml/QDomDocument>
+
+#include <qrgui/plugins/pluginManager/metamodelCache.h>
+#include <metaMetaModel/metamodel.h>
+#include <metaMetaModel/nodeElementType.h>
+#include <metaMetaModel/edgeElementType.h>
+
+#include "gtest/gtest.h"
+
+using namespace qReal;
+
+namespace {
+
+const QString diagram = "TestDiagram";
+
+void writeFile(const QString &path, const QByteArray &contents)
+{
+	QFile file(path);
+	ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+	file.write(contents);
+}
+
+/// Creates metamodel filled in the way metamodel loaders do it.
+QSharedPointer<Metamodel> createMetamodel()
+{
+	QSharedPointer<Metamodel> metamodel(new Metamodel);
+	metamodel->setId("TestMetamodel");
+	metamodel->setVersion("1.2");
+	metamodel->setFriendlyName("Test metamodel");
+	metamodel->addDiagram(diagram);
+	metamodel->setDiagramFriendlyName(diagram, "Test diagram");
+	metamodel->appendDiagramPaletteGroup(diagram, "Actions");
+	metamodel->addElementToDiagramPaletteGroup(diagram, "Actions", "Action");
+	metamodel->setDiagramPaletteGroupDescription(diagram, "Actions", "Some actions");
+	metamodel->addEnum("Colors", {{"red", "Red"}, {"green", "Green"}});
+	metamodel->setEnumEditable("Colors", true);
+
+	NodeElementType * const diagramNode = new NodeElementType(*metamodel);
+	diagramNode->setName("TestDiagramNode");
+	diagramNode->setDiagram(diagram);
+	diagramNode->setContainer(true);
+	diagramNode->setSizeOfForestalling({1, 2, 3, 4});
+	metamodel->addElement(*diagramNode);
+	metamodel->setDiagramNode(diagram, "TestDiagramNode");
+
+	NodeElementType * const action = new NodeElementType(*metamodel);
+	action->setName("Action");
+	action->setFriendlyName("Action");
+	action->setDescription("Does something");
+	action->setDiagram(diagram);
+	QDomDocument sdf;
+	sdf.setContent(QString("<picture sizex=\"50\" sizey=\"50\"><rectangle x1=\"0\" y1=\"0\" x2=\"50\" y2=\"50\"/>"
+			"</picture>"));
+	action->loadSdf(sdf.documentElement());
+	action->setSize(QSizeF(50, 50));
+	action->setResizable(false);
+	action->setMouseGesture("0, 0 : 100, 0");
+	QSharedPointer<LabelProperties> label(new LabelProperties(1, 0.5, -0.7, "Port", false, 90));
+	label->setPrefix("port ");
+	label->setBackground(Qt::white);
+	action->addLabel(label);
+	action->addProperty("Port", "string", "A1", "Port", "Output port", false);
+	action->addProperty("Color", "Colors", "red", "Color", "", false);
+	action->addProperty("Target", "string", "", "Target", "", true);
+	action->addPointPort(PointPortInfo(QPointF(0.5, 0.5), true, false, 50, 50, "NonTyped"));
+	action->addLinePort(LinePortInfo(QLineF(0, 0.1, 0, 0.9), false, false, false, false, 50, 50, "Input"));
+	action->addCircularPort(CircularPortInfo(QPointF(25, 25), 10, false, true, 50, 50, "Output"));
+	metamodel->addElement(*action);
+
+	NodeElementType * const childAction = new NodeElementType(*metamodel);
+	childAction->setName("ChildAction");
+	childAction->setDiagram(diagram);
+	childAction->setHidden(true);
+	metamodel->addElement(*childAction);
+
+	EdgeElementType * const link = new EdgeElementType(*metamodel);
+	link->setName("Link");
+	link->setDiagram(diagram);
+	link->setPenWidth(2);
+	link->setPenColor(Qt::blue);
+	link->setPenStyle(Qt::DashLine);
+	link->setDividable(true);
+	link->setFromPortTypes({"Output"});
+	link->setToPortTypes({"Input"});
+	link->setShapeType(LinkShape::square);
+	link->setStartArrowStyle("empty_rhomb");
+	link->setEndArrowStyle("open_arrow");
+	metamodel->addElement(*link);
+
+	metamodel->produceEdge(*childAction, *action, ElementType::generalizationLinkType);
+	metamodel->produceEdge(*diagramNode, *action, ElementType::containmentLinkType);
+	metamodel->addExplosion(*action, *diagramNode, true, false);
+	return metamodel;
+}
+
+}
+
+class MetamodelCacheTest : public testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		ASSERT_TRUE(mDirectory.isValid());
+		mSource = mDirectory.path() + "/metamodel.qrs";
+		writeFile(mSource, "metamodel contents");
+		mCache.reset(new MetamodelCache(mDirectory.path() + "/cache"));
+	}
+
+	QTemporaryDir mDirectory;
+	QString mSource;
+	QScopedPointer<MetamodelCache> mCache;
+};
+
+TEST_F(MetamodelCacheTest, roundTrip)
+{
+	ASSERT_TRUE(mCache->save(mSource, {createMetamodel()}));
+	QList<QSharedPointer<Metamodel>> metamodels;
+	ASSERT_TRUE(mCache->load(mSource, metamodels));
+	ASSERT_EQ(1, metamodels.size());
+
+	const Metamodel &metamodel = *metamodels.first();
+	EXPECT_EQ("TestMetamodel", metamodel.id());
+	EXPECT_EQ("1.2", metamodel.version());
+	EXPECT_EQ(QStringList{diagram}, metamodel.diagrams());
+	EXPECT_EQ("Test diagram", metamodel.diagramFriendlyName(diagram));
+	EXPECT_EQ(QStringList{"Action"}, metamodel.diagramPaletteGroupList(diagram, "Actions"));
+	EXPECT_EQ("Some actions", metamodel.diagramPaletteGroupDescription(diagram, "Actions"));
+	EXPECT_EQ(2, metamodel.enumValues("Colors").size());
+	EXPECT_TRUE(metamodel.isEnumEditable("Colors"));
+	ASSERT_NE(nullptr, metamodel.diagramNode(diagram));
+	EXPECT_EQ("TestDiagramNode", metamodel.diagramNode(diagram)->name());
+	EXPECT_EQ(QVector<int>({1, 2, 3, 4}), metamodel.diagramNode(diagram)->toNode().sizeOfForestalling());
+
+	const NodeElementType &action = metamodel.elementType(diagram, "Action").toNode();
+	EXPECT_EQ("Does something", action.description());
+	EXPECT_EQ("rectangle", action.sdf().firstChildElement().tagName());
+	EXPECT_EQ(QSizeF(50, 50), action.size());
+	EXPECT_FALSE(action.isResizable());
+	EXPECT_EQ("0, 0 : 100, 0", action.mouseGesture());
+	ASSERT_EQ(1, action.labels().size());
+	EXPECT_EQ("Port", action.labels().first()->binding());
+	EXPECT_EQ("port ", action.labels().first()->prefix());
+	EXPECT_EQ(QColor(Qt::white), action.labels().first()->background());
+	EXPECT_EQ(90, action.labels().first()->rotation());
+	EXPECT_EQ(QStringList({"Port", "Color", "Target"}), action.propertyNames());
+	EXPECT_EQ(QStringList{"Target"}, action.referenceProperties());
+	EXPECT_EQ("Output port", action.propertyDescription("Port"));
+	EXPECT_EQ("Colors", action.propertyType("Color"));
+	ASSERT_EQ(1, action.pointPorts().size());
+	EXPECT_TRUE(action.pointPorts().first().scalesX);
+	ASSERT_EQ(1, action.linePorts().size());
+	EXPECT_EQ("Input", action.linePorts().first().type);
+	ASSERT_EQ(1, action.circularPorts().size());
+	EXPECT_EQ(10, action.circularPorts().first().radius);
+
+	const ElementType &childAction = metamodel.elementType(diagram, "ChildAction");
+	EXPECT_TRUE(childAction.isHidden());
+	EXPECT_TRUE(childAction.isParent(action));
+	EXPECT_EQ(1, childAction.explosions().size());
+	EXPECT_TRUE(childAction.explosions().first()->isReusable());
+	EXPECT_EQ(IdList{Id("TestMetamodel", diagram, "Action")}, metamodel.diagramNode(diagram)->containedTypes());
+
+	const EdgeElementType &link = metamodel.elementType(diagram, "Link").toEdge();
+	EXPECT_EQ(2, link.penWidth());
+	EXPECT_EQ(QColor(Qt::blue), link.penColor());
+	EXPECT_EQ(Qt::DashLine, link.penStyle());
+	EXPECT_TRUE(link.isDividable());
+	EXPECT_EQ(QStringList{"Input"}, link.toPortTypes());
+	EXPECT_EQ(LinkShape::square, link.shapeType());
+	EXPECT_EQ("empty_rhomb", link.startArrowStyle());
+	EXPECT_EQ("open_arrow", link.endArrowStyle());
+	EXPECT_FALSE(link.sdf().isNull());
+}
+
+TEST_F(MetamodelCacheTest, cachedTypesAreLazy)
+{
+	ASSERT_TRUE(mCache->save(mSource, {createMetamodel()}));
+	QList<QSharedPointer<Metamodel>> metamodels;
+	ASSERT_TRUE(mCache->load(mSource, metamodels));
+	ASSERT_EQ(1, metamodels.size());
+
+	const ElementType &action = metamodels.first()->elementType(diagram, "Action");
+	const ElementType &link = metamodels.first()->elementType(diagram, "Link");
+	EXPECT_EQ("Does something", action.description());
+	EXPECT_FALSE(action.isInitialized());
+	EXPECT_FALSE(link.isInitialized());
+
+	EXPECT_EQ(3, action.propertyNames().size());
+	EXPECT_TRUE(action.isInitialized());
+	EXPECT_FALSE(link.isInitialized());
+	EXPECT_EQ(2, link.toEdge().penWidth());
+	EXPECT_TRUE(link.isInitialized());
+}
+
+TEST_F(MetamodelCacheTest, cacheOfSeveralFiles)
+{
+	const QString plugin = mDirectory.path() + "/plugin.so";
+	writeFile(plugin, "plugin binary");
+	ASSERT_TRUE(mCache->save({mSource, plugin}, {createMetamodel()}));
+	QList<QSharedPointer<Metamodel>> metamodels;
+	EXPECT_FALSE(mCache->load({mSource}, metamodels));
+	EXPECT_TRUE(mCache->load({mSource, plugin}, metamodels));
+	EXPECT_EQ(1, metamodels.size());
+
+	metamodels.clear();
+	writeFile(plugin, "rebuilt plugin binary");
+	EXPECT_FALSE(mCache->load({mSource, plugin}, metamodels));
+	EXPECT_TRUE(metamodels.isEmpty());
+}
+
+TEST_F(MetamodelCacheTest, changedLocaleInvalidatesCache)
+{
+	const QLocale previousLocale;
+	QLocale::setDefault(QLocale(QLocale::English, QLocale::UnitedStates));
+	ASSERT_TRUE(mCache->save(mSource, {createMetamodel()}));
+	QLocale::setDefault(QLocale(QLocale::Russian, QLocale::Russia));
+	QList<QSharedPointer<Metamodel>> metamodels;
+	EXPECT_FALSE(mCache->load(mSource, metamodels));
+	QLocale::setDefault(previousLocale);
+}
+
+TEST_F(MetamodelCacheTest, changedSourceInvalidatesCache)
+{
+	ASSERT_TRUE(mCache->save(mSource, {createMetamodel()}));
+	writeFile(mSource, "changed metamodel contents");
+	QList<QSharedPointer<Metamodel>> metamodels;
+	EXPECT_FALSE(mCache->load(mSource, metamodels));
+	EXPECT_TRUE(metamodels.isEmpty());
+
+	QFile::remove(mSource);
+	EXPECT_FALSE(mCache->load(mSource, metamodels));
+}
+
+TEST_F(MetamodelCacheTest, corruptedCacheIsIgnored)
+{
+	ASSERT_TRUE(mCache->save(mSource, {createMetamodel()}));
+	const QDir cacheDirectory(mDirectory.path() + "/cache");
+	const QStringList cacheFiles = cacheDirectory.entryList(QDir::Files);
+	ASSERT_EQ(1, cacheFiles.size());
+
+	QFile cacheFile(cacheDirectory.filePath(cacheFiles.first()));
+	ASSERT_TRUE(cacheFile.open(QIODevice::ReadWrite));
+	cacheFile.resize(cacheFile.size() / 2);
+	cacheFile.close();
+
+	QList<QSharedPointer<Metamodel>> metamodels;
+	EXPECT_FALSE(mCache->load(mSource, metamodels));
+	EXPECT_TRUE(metamodels.isEmpty());
+}
+
+TEST_F(MetamodelCacheTest, emptyCacheDirectoryDisablesCache)
+{
+	const MetamodelCache cache("");
+	EXPECT_FALSE(cache.save(mSource, {createMetamodel()}));
+	QList<QSharedPointer<Metamodel>> metamodels;
+	EXPECT_FALSE(cache.load(mSource, metamodels));
+}
@@ -0,0 +1,110 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QDebug>
+#include <QtGui/QImage>
+#include <QtGui/QPainter>
+#include <QtXml/QDomDocument>
+
+#include <qrgui/plugins/pluginManager/sdfRenderer.h>
+
+#include "gtest/gtest.h"
+
+using namespace qReal;
+
+static QDomElement picture(QDomDocument &document, const QString &contents)
+{
+	document.setContent("<picture sizex=\"100\" sizey=\"100\">" + contents + "</picture>");
+	return document.documentElement();
+}
+
+static QImage render(SdfRenderer &renderer, int size)
+{
+	QImage image(size, size, QImage::Format_ARGB32);
+	image.fill(Qt::white);
+	QPainter painter(&image);
+	renderer.render(&painter, QRectF(0, 0, size, size));
+	return image;
+}
+
+TEST(SdfRendererTest, rectangle)
+{
+	QDomDocument document;
+	SdfRenderer renderer;
+	renderer.load(picture(document
+			, "<rectangle x1=\"10\" y1=\"10\" x2=\"90\" y2=\"90\" fill=\"#ff0000\" stroke=\"#ff0000\"/>"));
+
+	const QImage image = render(renderer, 200);
+	EXPECT_EQ(QColor(Qt::red).rgb(), image.pixel(100, 100));
+	EXPECT_EQ(QColor(Qt::white).rgb(), image.pixel(5, 5));
+}
+
+TEST(SdfRendererTest, path)
+{
+	QDomDocument document;
+	SdfRenderer renderer;
+	renderer.load(picture(document, "<path fill=\"#000000\" stroke=\"#000000\" stroke-width=\"1\""
+			" d=\" M 0 0 L 100 0 L 0 100 L 0 0\"/>"));
+
+	const QImage image = render(renderer, 200);
+	EXPECT_EQ(QColor(Qt::black).rgb(), image.pixel(40, 40));
+	EXPECT_EQ(QColor(Qt::white).rgb(), image.pixel(160, 160));
+}
+
+TEST(SdfRendererTest, reloading)
+{
+	QDomDocument document;
+	SdfRenderer renderer;
+	renderer.load(picture(document, "<rectangle x1=\"0\" y1=\"0\" x2=\"100\" y2=\"100\" fill=\"#ff0000\"/>"));
+	EXPECT_EQ(QColor(Qt::red).rgb(), render(renderer, 100).pixel(50, 50));
+
+	QDomDocument otherDocument;
+	renderer.load(otherDocument);
+	EXPECT_EQ(QColor(Qt::white).rgb(), render(renderer, 100).pixel(50, 50));
+}
+
+TEST(SdfRendererTest, DISABLED_renderingBenchmark)
+{
+	const int nodes = 1000;
+	QDomDocument document;
+	const QDomElement sdf = picture(document
+			, "<rectangle x1=\"0\" y1=\"0\" x2=\"100\" y2=\"100\" fill=\"#ffffff\" stroke=\"#000000\""
+			" stroke-width=\"2\" stroke-style=\"solid\"/>"
+			"<ellipse x1=\"10%\" y1=\"10%\" x2=\"90%\" y2=\"90%\" fill=\"#c0c0c0\" fill-style=\"solid\"/>"
+			"<path fill=\"#000000\" stroke=\"#000000\" stroke-width=\"2\""
+			" d=\" M 15 15 L 5 15 C 5 20.5228 9.47715 25 15 25 C 20.5228 25 25 20.5228 25 15 L 15 15\"/>"
+			"<line x1=\"0\" y1=\"50\" x2=\"100a\" y2=\"50\" stroke=\"#0000ff\" stroke-width=\"1\"/>"
+			"<polygon n=\"3\" x1=\"50\" y1=\"0\" x2=\"100\" y2=\"100\" x3=\"0\" y3=\"100\" fill=\"#00ff00\"/>");
+
+	QList<QSharedPointer<SdfRenderer>> renderers;
+	for (int i = 0; i < nodes; ++i) {
+		renderers << QSharedPointer<SdfRenderer>::create();
+		renderers.last()->load(sdf);
+	}
+
+	QImage image(2000, 2000, QImage::Format_ARGB32_Premultiplied);
+	QPainter painter(&image);
+
+	QElapsedTimer timer;
+	timer.start();
+	const int repaints = 10;
+	for (int repaint = 0; repaint < repaints; ++repaint) {
+		for (int i = 0; i < nodes; ++i) {
+			renderers[i]->render(&painter, QRectF((i % 40) * 50, (i / 40) * 50, 50, 50));
+		}
+	}
+
+	qDebug() << repaints << "repaints of" << nodes << "nodes took" << timer.elapsed() << "ms";
+}
@@ -0,0 +1,144 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include "mockEditorPlugin.h"
+
+#include <metaMetaModel/nodeElementType.h>
+#include <metaMetaModel/edgeElementType.h>
+#include <metaMetaModel/labelProperties.h>
+
+using namespace qrTest::mockEditorPlugin;
+using namespace qReal;
+
+namespace {
+
+const QString diagram = "MockDiagram";
+
+class MockDiagramNode : public NodeElementType
+{
+public:
+	explicit MockDiagramNode(Metamodel &metamodel)
+		: NodeElementType(metamodel)
+	{
+		setName("MockDiagramNode");
+		setFriendlyName("Mock diagram node");
+		setDiagram(diagram);
+	}
+
+	void initialize() override
+	{
+		setSize(QSizeF(100, 100));
+		setContainer(true);
+		setSizeOfForestalling({10, 10, 10, 10});
+	}
+};
+
+class AbstractAction : public NodeElementType
+{
+public:
+	explicit AbstractAction(Metamodel &metamodel)
+		: NodeElementType(metamodel)
+	{
+		setName("AbstractAction");
+		setFriendlyName("Abstract action");
+		setDiagram(diagram);
+	}
+
+	void initialize() override
+	{
+		setSize(QSizeF(50, 50));
+		addLinePort(LinePortInfo(QLineF(0, 0.1, 0, 0.9), false, false, false, false, 50, 50, "NonTyped"));
+	}
+};
+
+class Action : public NodeElementType
+{
+public:
+	explicit Action(Metamodel &metamodel)
+		: NodeElementType(metamodel)
+	{
+		setName("Action");
+		setFriendlyName("Action");
+		setDiagram(diagram);
+		setDescription("Does something for a while");
+	}
+
+	void initialize() override
+	{
+		QSharedPointer<LabelProperties> label(new LabelProperties(1, 0.1, 0.2, "Duration", false, 0));
+		label->setBackground(Qt::white);
+		addLabel(label);
+		setSize(QSizeF(50, 50));
+		setMouseGesture("0, 0 : 100, 0");
+		addLinePort(LinePortInfo(QLineF(0, 0.1, 0, 0.9), false, false, false, false, 50, 50, "NonTyped"));
+		addProperty("Duration", "int", "1000", "Duration (ms)", "", false);
+	}
+};
+
+class Link : public EdgeElementType
+{
+public:
+	explicit Link(Metamodel &metamodel)
+		: EdgeElementType(metamodel)
+	{
+		setName("Link");
+		setFriendlyName("Link");
+		setDiagram(diagram);
+	}
+
+	void initialize() override
+	{
+		setFromPortTypes({"NonTyped"});
+		setToPortTypes({"NonTyped"});
+		setShapeType(LinkShape::broken);
+		setPenWidth(1);
+		setPenColor(QColor(0, 0, 0));
+		setPenStyle(Qt::SolidLine);
+		setStartArrowStyle("no_arrow");
+		setEndArrowStyle("open_arrow");
+		addProperty("Guard", "string", "", "Guard", "", false);
+	}
+};
+
+}
+
+QStringList MockEditorPlugin::dependencies() const
+{
+	return {};
+}
+
+void MockEditorPlugin::load(Metamodel &metamodel)
+{
+	metamodel.setId("MockMetamodel");
+	metamodel.setVersion("1.0");
+
+	metamodel.addNode(new MockDiagramNode(metamodel));
+	metamodel.addNode(new AbstractAction(metamodel));
+	metamodel.addNode(new Action(metamodel));
+	metamodel.addNode(new Link(metamodel));
+	metamodel.produceEdge(metamodel.elementType(diagram, "Action"), metamodel.elementType(diagram, "AbstractAction")
+			, ElementType::generalizationLinkType);
+	metamodel.produceEdge(metamodel.elementType(diagram, "MockDiagramNode"), metamodel.elementType(diagram, "Action")
+			, ElementType::containmentLinkType);
+
+	metamodel.addDiagram(diagram);
+	metamodel.setDiagramFriendlyName(diagram, "Mock diagram");
+	metamodel.setDiagramNode(diagram, "MockDiagramNode");
+
+	metamodel.appendDiagramPaletteGroup(diagram, "Actions");
+	metamodel.addElementToDiagramPaletteGroup(diagram, "Actions", "Action");
+	metamodel.addElementToDiagramPaletteGroup(diagram, "Actions", "Link");
+	metamodel.setDiagramPaletteGroupDescription(diagram, "Actions", "Things to do");
+}
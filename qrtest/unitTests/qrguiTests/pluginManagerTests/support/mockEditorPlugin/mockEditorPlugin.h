@@ -0,0 +1,39 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#pragma once
+
+#include <QtCore/QObject>
+
+#include <metaMetaModel/metamodel.h>
+
+namespace qrTest {
+namespace mockEditorPlugin {
+
+/// Editor plugin with a tiny metamodel filled the way plugins generated by qrxc do it. Element types
+/// are filled lazily in overridden initialize(), abstract node and diagram node are absent from palette.
+class MockEditorPlugin : public QObject, public qReal::MetamodelLoaderInterface
+{
+	Q_OBJECT
+	Q_INTERFACES(qReal::MetamodelLoaderInterface)
+	Q_PLUGIN_METADATA(IID "MockMetamodel")
+
+public:
+	QStringList dependencies() const override;
+	void load(qReal::Metamodel &metamodel) override;
+};
+
+}
+}
@@ -14,11 +14,14 @@
 
 TARGET = qrgui_unittests
 
-QT += xml
+QT += xml svg
 
 include(../common.pri)
 
-links(qrkernel qrutils qrrepo qrgui-controller qrgui-plugin-manager qrgui-tool-plugin-interface)
+links(qrkernel qrutils qrrepo qrgraph qrgui-controller qrgui-plugin-manager qrgui-tool-plugin-interface \
+		qrgui-meta-meta-model)
+
+includes(qrgraph qrgui/plugins/metaMetaModel)
 
 INCLUDEPATH += \
 	# A little hack to make .ui files happy. They include other files by relative path based on qrgui/.ui \
@@ -27,4 +30,8 @@ INCLUDEPATH += \
 
 include(modelsTests/modelsTests.pri)
 
+include(pluginManagerTests/pluginManagerTests.pri)
+
+include(metaMetaModelTests/metaMetaModelTests.pri)
+
 include(helpers/helpers.pri)
@@ -64,6 +64,38 @@ TEST(IdsTest, sameTypeIdTest) {
 	EXPECT_EQ(id.sameTypeId().type(), id.type());
 }
 
+TEST(IdsTest, uuidIdTest) {
+	const Id id = Id::createElementId("editor", "diagram", "element");
+	const Id loaded = Id::loadFromString(id.toString());
+
+	EXPECT_EQ(loaded, id);
+	EXPECT_EQ(qHash(loaded), qHash(id));
+	EXPECT_EQ(loaded.id(), id.id());
+	EXPECT_EQ(Id(id.type(), id.id()), id);
+
+	const QString upperCaseUuid = id.id().toUpper();
+	const Id upperCaseId("editor", "diagram", "element", upperCaseUuid);
+	EXPECT_EQ(upperCaseId.id(), upperCaseUuid);
+	EXPECT_EQ(upperCaseId.toString(), "qrm:/editor/diagram/element/" + upperCaseUuid);
+	EXPECT_NE(upperCaseId, id);
+}
+
+TEST(IdsTest, comparisonTest) {
+	const Id id1("editor", "diagram", "element", "{00000000-0000-0000-0000-0000000000ff}");
+	const Id id2("editor", "diagram", "element", "{00000001-0000-0000-0000-000000000000}");
+	const Id id3("editor", "diagram", "element", "id");
+	const Id id4("editor", "diagram", "element2", "id");
+
+	EXPECT_TRUE(id1 < id2);
+	EXPECT_FALSE(id2 < id1);
+	EXPECT_TRUE(id3 < id2);
+	EXPECT_TRUE(id3 < id4);
+	EXPECT_TRUE(id1.type() < id1);
+	EXPECT_FALSE(id1 < id1);
+	EXPECT_TRUE(Id() < id1);
+	EXPECT_EQ(Id("", "", "", ""), Id());
+	EXPECT_TRUE(Id("", "", "", "").isNull());
+}
 
 TEST(IdsTest, toUrlToStringToVariantTest) {
 	QString const idString = "qrm:/editor/diagram/element/id";
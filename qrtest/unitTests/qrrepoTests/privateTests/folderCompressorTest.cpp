@@ -84,3 +84,38 @@ TEST_F(FolderCompressorTest, decompressTest) {
 	EXPECT_EQ(line2, "text2");
 	EXPECT_EQ(line3, "text3");
 }
+
+TEST_F(FolderCompressorTest, decompressFilesTest) {
+	FolderCompressor::compressFolder("temp", "compressed");
+	const QMap<QString, QByteArray> files = FolderCompressor::decompressFiles("compressed");
+
+	ASSERT_EQ(files.size(), 3);
+	EXPECT_EQ(files["file1"], "text1");
+	EXPECT_EQ(files["dir1/dir2/file2"], "text2");
+	EXPECT_EQ(files["dir3/file3"], "text3");
+}
+
+TEST_F(FolderCompressorTest, compressFilesTest) {
+	QMap<QString, QByteArray> files;
+	files["file1"] = "text1";
+	files["dir1/dir2/file2"] = "text2";
+	files["dir3/file3"] = "text3";
+	FolderCompressor::compressFiles(files, "compressed");
+	FolderCompressor::decompressFolder("compressed", "temp_decompessed");
+
+	QFile file1("temp_decompessed/file1");
+	QFile file2("temp_decompessed/dir1/dir2/file2");
+	QFile file3("temp_decompessed/dir3/file3");
+
+	ASSERT_TRUE(file1.open(QIODevice::ReadOnly));
+	ASSERT_TRUE(file2.open(QIODevice::ReadOnly));
+	ASSERT_TRUE(file3.open(QIODevice::ReadOnly));
+
+	EXPECT_EQ(file1.readAll(), "text1");
+	EXPECT_EQ(file2.readAll(), "text2");
+	EXPECT_EQ(file3.readAll(), "text3");
+
+	const QMap<QString, QByteArray> decompressed = FolderCompressor::decompressFiles("compressed");
+	ASSERT_EQ(decompressed.size(), 3);
+	EXPECT_EQ(decompressed["dir1/dir2/file2"], "text2");
+}
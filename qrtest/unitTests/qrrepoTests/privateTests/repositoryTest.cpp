@@ -16,6 +16,8 @@
 
 #include <QtCore/QFile>
 #include <QtCore/QDir>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QDebug>
 
 #include <qrrepo/private/classes/logicalObject.h>
 #include <qrkernel/exception/exception.h>
@@ -232,6 +234,75 @@ TEST_F(RepositoryTest, elementsByPropertyContentTest) {
 	EXPECT_TRUE(list.contains(root));
 }
 
+TEST_F(RepositoryTest, searchAfterModificationsTest) {
+	mRepository->setProperty(child1, "name", "renamed");
+	IdList list = mRepository->findElementsByName("child1", false, false);
+	EXPECT_EQ(list.size(), 1);
+	EXPECT_TRUE(list.contains(child1_child));
+
+	list = mRepository->findElementsByName("renamed", false, false);
+	EXPECT_EQ(list.size(), 1);
+	EXPECT_TRUE(list.contains(child1));
+
+	mRepository->setProperty(child1, "newProperty", "value");
+	list = mRepository->elementsByProperty("NewProperty", false, false);
+	EXPECT_EQ(list.size(), 1);
+	EXPECT_TRUE(list.contains(child1));
+
+	mRepository->removeProperty(child1, "newProperty");
+	EXPECT_TRUE(mRepository->elementsByProperty("newProperty", true, false).isEmpty());
+
+	mRepository->removeProperty(child1, "name");
+	EXPECT_TRUE(mRepository->findElementsByName("renamed", false, false).isEmpty());
+
+	mRepository->remove(child1_child);
+	EXPECT_TRUE(mRepository->findElementsByName("child1", false, false).isEmpty());
+	list = mRepository->elementsByProperty("property2", true, false);
+	EXPECT_TRUE(list.isEmpty());
+
+	const Id newChild("editor1", "diagram2", "element3", "newChild");
+	mRepository->addChild(root, newChild, child2);
+	mRepository->setProperty(newChild, "name", "child1_new");
+	list = mRepository->findElementsByName("child1", false, false);
+	EXPECT_EQ(list.size(), 1);
+	EXPECT_TRUE(list.contains(newChild));
+
+	mRepository->open("newSaveFile.qrs");
+	list = mRepository->elementsByProperty("property2", true, false);
+	EXPECT_TRUE(list.isEmpty());
+	EXPECT_TRUE(mRepository->findElementsByName("child", false, false).isEmpty());
+}
+
+TEST_F(RepositoryTest, DISABLED_searchBenchmark) {
+	const int elementsCount = 50000;
+	const int namesCount = 1000;
+	const Id logicalElement("editor1", "diagram1", "element1", "logical");
+	mRepository->addChild(Id::rootId(), logicalElement);
+
+	QElapsedTimer timer;
+	timer.start();
+	for (int i = 0; i < elementsCount; ++i) {
+		const Id element("editor1", "diagram1", "element1", QString::number(i));
+		mRepository->addChild(Id::rootId(), element, logicalElement);
+		mRepository->setProperty(element, "name", QString("element%1").arg(i % namesCount));
+		mRepository->setProperty(element, "property" + QString::number(i % 10), i);
+	}
+
+	qDebug() << "Filling" << elementsCount << "elements took" << timer.restart() << "ms";
+
+	EXPECT_EQ(mRepository->findElementsByName("element42", true, false).size(), 11 * elementsCount / namesCount);
+	qDebug() << "Search by name took" << timer.restart() << "ms";
+
+	EXPECT_EQ(mRepository->elementsByProperty("property7", true, false).size(), elementsCount / 10);
+	qDebug() << "Search by property took" << timer.restart() << "ms";
+
+	EXPECT_EQ(mRepository->elementsByProperty("PROPERTY[12]", false, true).size(), elementsCount / 5);
+	qDebug() << "Search by property regexp took" << timer.restart() << "ms";
+
+	EXPECT_EQ(mRepository->elementsByPropertyContent("49999", true, false).size(), 1);
+	qDebug() << "Search by property content took" << timer.restart() << "ms";
+}
+
 TEST_F(RepositoryTest, parentOperationsTest) {
 	EXPECT_EQ(mRepository->parent(child1), root);
 	EXPECT_EQ(mRepository->parent(child2), root);
@@ -595,6 +666,24 @@ TEST_F(RepositoryTest, saveAllTest) {
 	EXPECT_TRUE(mRepository->exist(child3_child));
 }
 
+TEST_F(RepositoryTest, saveAfterModificationsTest) {
+	mRepository->saveAll();
+	mRepository->setProperty(child1, "property1", "newValue");
+	mRepository->removeChild(root, child3);
+	mRepository->setMetaInformation("key", "info");
+	mRepository->saveAll();
+
+	mRepository->setProperty(child2, "property1", "otherValue");
+	mRepository->saveAll();
+	mRepository->open("saveFile.qrs");
+
+	EXPECT_EQ(mRepository->property(child1, "property1").toString(), "newValue");
+	EXPECT_EQ(mRepository->property(child2, "property1").toString(), "otherValue");
+	EXPECT_EQ(mRepository->property(child3_child, "property2").toString(), "value2");
+	EXPECT_FALSE(mRepository->children(root).contains(child3));
+	EXPECT_EQ(mRepository->metaInformation("key").toString(), "info");
+}
+
 TEST_F(RepositoryTest, saveTest) {
 	mRepository->serializer().clearWorkingDir();
 	IdList toSave;
@@ -521,3 +521,45 @@ TEST_F(LuaInterpreterTest, negativOutOfRangeAssignment)
 	EXPECT_EQ(1, mErrors.size());
 	mErrors.clear();
 }
+
+TEST_F(LuaInterpreterTest, logicalOperatorsShortCircuit)
+{
+	mAnalyzer->addIntrinsicFunction("f", QSharedPointer<types::Function>(new types::Function(
+			QSharedPointer<core::types::TypeExpression>(new types::Integer()),
+			{QSharedPointer<core::types::TypeExpression>(new types::Integer())}
+			)));
+
+	int calls = 0;
+	mInterpreter->addIntrinsicFunction("f", [&calls](QList<QVariant> params) {
+			++calls;
+			return params[0];
+			});
+
+	EXPECT_FALSE(interpret<bool>("0 and f(1)"));
+	EXPECT_TRUE(interpret<bool>("1 or f(0)"));
+	EXPECT_EQ(0, calls);
+
+	EXPECT_TRUE(interpret<bool>("1 and f(2)"));
+	EXPECT_FALSE(interpret<bool>("0 or f(0)"));
+	EXPECT_EQ(2, calls);
+	ASSERT_TRUE(mErrors.isEmpty());
+}
+
+TEST_F(LuaInterpreterTest, compiledCodeReuse)
+{
+	interpret<int>("a = 0; b = {0}");
+
+	const auto ast = parseAndAnalyze("a = a + 1; b[a] = a * 2; b[a] + 1");
+	ASSERT_TRUE(mErrors.isEmpty());
+
+	const auto bytecode = LuaCompiler(*mInterpreter).compile(ast, *mAnalyzer);
+	EXPECT_TRUE(LuaCompiler::isUpToDate(*bytecode, *mAnalyzer));
+
+	for (int i = 1; i <= 3; ++i) {
+		EXPECT_EQ(2 * i + 1, mInterpreter->execute(*bytecode).toInt());
+	}
+
+	EXPECT_EQ(3, interpret<int>("a"));
+	EXPECT_EQ(4, interpret<int>("b[2]"));
+	ASSERT_TRUE(mErrors.isEmpty());
+}
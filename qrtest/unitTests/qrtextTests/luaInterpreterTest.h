@@ -19,6 +19,7 @@
 #include <gtest/gtest.h>
 
 #include "qrtext/src/lua/luaInterpreter.h"
+#include "qrtext/src/lua/luaCompiler.h"
 #include "qrtext/src/lua/luaSemanticAnalyzer.h"
 #include "qrtext/src/lua/luaParser.h"
 #include "qrtext/src/lua/luaLexer.h"
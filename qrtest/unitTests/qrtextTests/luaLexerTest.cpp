@@ -14,6 +14,10 @@
 
 #include "luaLexerTest.h"
 
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QStringList>
+#include <QtCore/QDebug>
+
 #include "gtest/gtest.h"
 
 using namespace qrtext::lua::details;
@@ -363,3 +367,75 @@ TEST_F(LuaLexerTest, comments)
 	EXPECT_EQ(Connection(57, 3, 0), comments[2].range().start());
 	EXPECT_EQ(Connection(58, 3, 1), comments[2].range().end());
 }
+
+TEST_F(LuaLexerTest, automatonMatchesRegexps)
+{
+	const QStringList streams = {
+		"a = 1 --ololo\n---- x\nb = 'no -- comment' end\n--"
+		, "0x1F 0X1f.8p+3 0xA.Bp 0x1p-2 12 12.5 12.5e-3 1e10 1e 3.14E+2 12. .5"
+		, "'a\\'b' \"c\\\"d\" \"multi\\\nline\" 'x\\\ny\\\nz' w"
+		, "a.b:c(d, ...) .. e[f] == g ~= h != i <= j >= k < l > m = n :: o; #p ^ q % r // s / t * u - v + w"
+		, "x & y | z ~ w << 1 >> 2 && u || v"
+		, "функция_1(αβ, _été) ∀ x"
+		, "local function f()\n\tif a then return nil elseif b then goto c else break end\nend"
+		, "a = @b $ c\n'unterminated\nd = 1 \"also unterminated"
+		, ""
+	};
+
+	// Otherwise regexp lexer would be compared with itself.
+	ASSERT_TRUE(mLexer->usesAutomaton());
+
+	for (const QString &stream : streams) {
+		QList<Error> errors;
+		LuaLexer regExpLexer(errors, false);
+		ASSERT_FALSE(regExpLexer.usesAutomaton());
+		const auto expected = regExpLexer.tokenize(stream);
+		const auto expectedComments = regExpLexer.comments();
+		const auto expectedErrors = errors;
+
+		errors.clear();
+		const auto result = mLexer->tokenize(stream);
+
+		ASSERT_EQ(expected.size(), result.size()) << stream.toStdString();
+		for (int i = 0; i < expected.size(); ++i) {
+			EXPECT_EQ(expected[i].token(), result[i].token()) << stream.toStdString();
+			EXPECT_EQ(expected[i].lexeme(), result[i].lexeme()) << stream.toStdString();
+			EXPECT_EQ(expected[i].range().start(), result[i].range().start()) << stream.toStdString();
+			EXPECT_EQ(expected[i].range().end(), result[i].range().end()) << stream.toStdString();
+		}
+
+		ASSERT_EQ(expectedComments.size(), mLexer->comments().size());
+		for (int i = 0; i < expectedComments.size(); ++i) {
+			EXPECT_EQ(expectedComments[i].lexeme(), mLexer->comments()[i].lexeme());
+			EXPECT_EQ(expectedComments[i].range().start(), mLexer->comments()[i].range().start());
+			EXPECT_EQ(expectedComments[i].range().end(), mLexer->comments()[i].range().end());
+		}
+
+		ASSERT_EQ(expectedErrors.size(), mErrors.size());
+		for (int i = 0; i < expectedErrors.size(); ++i) {
+			EXPECT_EQ(expectedErrors[i].connection(), mErrors[i].connection());
+			EXPECT_EQ(expectedErrors[i].errorMessage(), mErrors[i].errorMessage());
+		}
+
+		mErrors.clear();
+	}
+}
+
+TEST_F(LuaLexerTest, DISABLED_tokenizeBenchmark)
+{
+	const QString line = "local speed = 0x1F * (sensorValue - 12.5e-3) // 2 -- adjusting motors\n"
+			"if speed ~= previous and name == 'скорость' then "
+			"motors[1], motors[2] = speed, -speed end\n";
+	const QString stream = line.repeated(2000);
+
+	QList<Error> errors;
+	LuaLexer regExpLexer(errors, false);
+
+	QElapsedTimer timer;
+	timer.start();
+	const int expectedSize = regExpLexer.tokenize(stream).size();
+	qDebug() << "Tokenizing" << stream.length() << "characters with regexps took" << timer.restart() << "ms";
+
+	EXPECT_EQ(expectedSize, mLexer->tokenize(stream).size());
+	qDebug() << "Tokenizing" << stream.length() << "characters with automaton took" << timer.restart() << "ms";
+}
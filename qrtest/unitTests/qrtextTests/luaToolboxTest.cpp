@@ -15,6 +15,9 @@
 
 #include "luaToolboxTest.h"
 
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QDebug>
+
 #include "gtest/gtest.h"
 
 #include "qrtext/lua/ast/integerNumber.h"
@@ -178,3 +181,179 @@ TEST_F(LuaToolboxTest, twoFunctions)
 	mToolbox->interpret<int>("cos(1)");
 	ASSERT_TRUE(mToolbox->errors().isEmpty());
 }
+
+TEST_F(LuaToolboxTest, repeatedInterpretation)
+{
+	const qReal::Id testId = qReal::Id("1", "2", "3", "test");
+	mToolbox->interpret<int>("a = 0; b = {0, 0}");
+	for (int i = 0; i < 10; ++i) {
+		mToolbox->interpret<int>(testId, "test", "a = a + 1; b[1] = b[1] + a");
+		ASSERT_TRUE(mToolbox->errors().isEmpty());
+	}
+
+	EXPECT_EQ(10, mToolbox->interpret<int>("a"));
+	EXPECT_EQ(55, mToolbox->interpret<int>("b[1]"));
+
+	mToolbox->interpret<int>(testId, "test", "a = a * 2");
+	EXPECT_EQ(20, mToolbox->interpret<int>("a"));
+}
+
+TEST_F(LuaToolboxTest, clearKeepsCompiledCodeValid)
+{
+	const qReal::Id testId = qReal::Id("1", "2", "3", "test");
+	mToolbox->interpret<int>(testId, "test", "a = 5");
+	mToolbox->clear();
+
+	EXPECT_EQ(0, mToolbox->value<int>("a"));
+
+	mToolbox->interpret<int>(testId, "test", "a = 5");
+	EXPECT_TRUE(mToolbox->errors().isEmpty());
+	EXPECT_EQ(5, mToolbox->interpret<int>("a"));
+}
+
+TEST_F(LuaToolboxTest, reanalysisAfterDeclarationChange)
+{
+	const qReal::Id testId = qReal::Id("1", "2", "3", "test");
+	mToolbox->interpret<int>("a = 1");
+	mToolbox->interpret<int>(testId, "test", "b = a");
+	EXPECT_TRUE(mToolbox->variableTypes()["b"]->is<types::Integer>());
+
+	mToolbox->interpret<int>("a = 0.5");
+	const int analysesBefore = mToolbox->analysesCount();
+	mToolbox->interpret<int>(testId, "test", "b = a");
+	EXPECT_EQ(analysesBefore + 1, mToolbox->analysesCount());
+	EXPECT_TRUE(mToolbox->errors().isEmpty());
+	EXPECT_TRUE(mToolbox->variableTypes()["b"]->is<types::Float>());
+}
+
+TEST_F(LuaToolboxTest, unchangedCodeIsNotReanalyzed)
+{
+	const qReal::Id testId = qReal::Id("1", "2", "3", "test");
+	const qReal::Id otherId = qReal::Id("1", "2", "3", "other");
+	mToolbox->interpret<int>(testId, "test", "a = 1; b = a + 1");
+	EXPECT_EQ(1, mToolbox->analysesCount());
+
+	mToolbox->interpret<int>(testId, "test", "a = 1; b = a + 1");
+	mToolbox->interpret<int>(testId, "test", "a = 1; b = a + 1");
+	EXPECT_EQ(1, mToolbox->analysesCount());
+
+	// Code that does not change types of "a" and "b" shall not invalidate analysis results.
+	mToolbox->interpret<int>(otherId, "test", "c = a + 2");
+	EXPECT_EQ(2, mToolbox->analysesCount());
+	mToolbox->interpret<int>(testId, "test", "a = 1; b = a + 1");
+	EXPECT_EQ(2, mToolbox->analysesCount());
+
+	// And code that generalizes type of "a" shall.
+	mToolbox->interpret<int>(otherId, "test", "a = 0.5");
+	EXPECT_EQ(3, mToolbox->analysesCount());
+	mToolbox->interpret<int>(testId, "test", "a = 1; b = a + 1");
+	EXPECT_EQ(4, mToolbox->analysesCount());
+	EXPECT_TRUE(mToolbox->errors().isEmpty());
+	EXPECT_TRUE(mToolbox->variableTypes()["b"]->is<types::Float>());
+
+	mToolbox->clear();
+	mToolbox->interpret<int>(testId, "test", "a = 1; b = a + 1");
+	EXPECT_EQ(5, mToolbox->analysesCount());
+}
+
+TEST_F(LuaToolboxTest, reanalysisAfterIntrinsicFunctionAdded)
+{
+	const qReal::Id testId = qReal::Id("1", "2", "3", "test");
+	mToolbox->interpret<int>(testId, "test", "f = 1");
+	EXPECT_TRUE(mToolbox->errors().isEmpty());
+
+	mToolbox->addIntrinsicFunction("f", new types::Integer(), {new types::Integer()}
+			, [] (QList<QVariant> params) { return params[0].toInt() + 2; }
+			);
+
+	mToolbox->interpret<int>(testId, "test", "f = 1");
+	EXPECT_FALSE(mToolbox->errors().isEmpty());
+}
+
+TEST_F(LuaToolboxTest, referencedIdentifiers)
+{
+	const qReal::Id testId = qReal::Id("1", "2", "3", "test");
+	mToolbox->setVariableValue("sensor1", 10);
+	mToolbox->setVariableValue("sensor2", 20);
+	EXPECT_FALSE(mToolbox->isReferenced("sensor1"));
+
+	mToolbox->interpret<int>(testId, "test", "a = sensor1 + 1");
+	EXPECT_TRUE(mToolbox->errors().isEmpty());
+	EXPECT_TRUE(mToolbox->isReferenced("sensor1"));
+	EXPECT_TRUE(mToolbox->isReferenced("a"));
+	EXPECT_FALSE(mToolbox->isReferenced("sensor2"));
+
+	mToolbox->clear();
+	EXPECT_FALSE(mToolbox->isReferenced("sensor1"));
+}
+
+TEST_F(LuaToolboxTest, DISABLED_interpretationBenchmark)
+{
+	const int iterations = 100000;
+	const qReal::Id testId = qReal::Id("1", "2", "3", "test");
+	mToolbox->interpret<int>("sensorA1 = 30; S = 0; Sold = 0; u = 0; speeds = {0, 0}");
+
+	QElapsedTimer timer;
+	timer.start();
+	for (int i = 0; i < iterations; ++i) {
+		mToolbox->interpret<int>(testId, "test"
+				, "S = sensorA1; u = 2.5 * (S - sensorA1) + 5 * (Sold - sensorA1); Sold = S; "
+				"speeds[0] = 50 - u; speeds[1] = 50 + u");
+	}
+
+	EXPECT_TRUE(mToolbox->errors().isEmpty());
+	qDebug() << iterations << "interpretations took" << timer.elapsed() << "ms";
+
+	// Table constructor appends elements one by one, so it shall take linear time of the table size.
+	const int tableSize = 10000;
+	QStringList elements;
+	for (int i = 0; i < tableSize; ++i) {
+		elements << QString::number(i);
+	}
+
+	const QString table = "table = {" + elements.join(", ") + "}";
+	timer.restart();
+	mToolbox->interpret<int>(table);
+	EXPECT_TRUE(mToolbox->errors().isEmpty());
+	EXPECT_EQ(tableSize, mToolbox->value<QVariantList>("table").size());
+	qDebug() << "Interpretation of a table of" << tableSize << "elements took" << timer.elapsed() << "ms";
+}
+
+TEST_F(LuaToolboxTest, DISABLED_unchangedCodeParsingBenchmark)
+{
+	const int properties = 1000;
+	const int iterations = 100;
+	mToolbox->interpret<int>("sensorA1 = 30; sensorA2 = 40");
+	for (int i = 0; i < properties; ++i) {
+		mToolbox->parse(qReal::Id("1", "2", "3", QString::number(i)), "test"
+				, QString("x%1 = sensorA1 * 2 + sensorA2 / 3").arg(i));
+	}
+
+	QElapsedTimer timer;
+	timer.start();
+	for (int iteration = 0; iteration < iterations; ++iteration) {
+		for (int i = 0; i < properties; ++i) {
+			mToolbox->parse(qReal::Id("1", "2", "3", QString::number(i)), "test"
+					, QString("x%1 = sensorA1 * 2 + sensorA2 / 3").arg(i));
+		}
+	}
+
+	EXPECT_TRUE(mToolbox->errors().isEmpty());
+	qDebug() << iterations * properties << "parses of unchanged code took" << timer.elapsed() << "ms, with"
+			<< mToolbox->analysesCount() << "analyses";
+
+	// Baseline: code of each property changes on every parse, so every parse is analyzed like before analyses
+	// of unchanged code were skipped.
+	const int analysesBefore = mToolbox->analysesCount();
+	timer.restart();
+	for (int iteration = 0; iteration < iterations; ++iteration) {
+		for (int i = 0; i < properties; ++i) {
+			mToolbox->parse(qReal::Id("1", "2", "3", QString::number(i)), "test"
+					, QString("x%1 = sensorA1 * 2 + sensorA2 / %2").arg(i).arg(iteration % 2 + 3));
+		}
+	}
+
+	EXPECT_TRUE(mToolbox->errors().isEmpty());
+	qDebug() << iterations * properties << "parses of changing code took" << timer.elapsed() << "ms, with"
+			<< mToolbox->analysesCount() - analysesBefore << "analyses";
+}
@@ -16,6 +16,7 @@ TEMPLATE = subdirs
 
 SUBDIRS = \
 	exampleTests \
+	mockEditorPlugin \
 	pluginsTests \
 	qrguiTests \
 	qrkernelTests \
@@ -25,9 +26,11 @@ SUBDIRS = \
 	qrtextTests \
 	testUtils \
 
+mockEditorPlugin.subdir = qrguiTests/pluginManagerTests/support/mockEditorPlugin
+
 exampleTests.depends = testUtils
 pluginsTests.depends = testUtils
-qrguiTests.depends = testUtils
+qrguiTests.depends = testUtils mockEditorPlugin
 qrkernelTests.depends = testUtils
 qrrepoTests.depends = testUtils
 qrutilsTests.depends = testUtils
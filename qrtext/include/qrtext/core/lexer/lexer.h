@@ -21,6 +21,7 @@
 #include "qrtext/core/lexer/token.h"
 #include "qrtext/core/error.h"
 #include "qrtext/core/lexer/tokenPatterns.h"
+#include "qrtext/core/lexer/tokenAutomaton.h"
 
 namespace qrtext {
 namespace core {
@@ -34,8 +35,9 @@ namespace core {
 /// and newlines to output token stream, but does use them for connection and error recovery, so it is recommended to
 /// not fiddle with them much.
 /// In case of error skips symbols until next whitespace or newline and reports error.
-/// Can be quite slow due to use of regexp matching with every regexp in patterns list, so do not use this lexer
-/// on really large files.
+/// Patterns are compiled into one table-driven automaton (see TokenAutomaton), so each token is recognized in a single
+/// pass over its characters. If some pattern can not be compiled, lexer falls back to matching every regexp in
+/// patterns list at every position, which is much slower.
 ///
 /// It is parameterized by TokenType --- enum class with all token types of a language. Token types may be arbitrary,
 /// but shall always contain TokenType::whitespace, TokenType::newline, TokenType::comment, TokenType::string,
@@ -48,14 +50,18 @@ public:
 	/// Constructor.
 	/// @param patterns - object containing token patterns.
 	/// @param errors - error stream, to which lexer errors shall be added.
-	explicit Lexer(TokenPatterns<TokenType> const &patterns, QList<Error> &errors)
+	/// @param useAutomaton - if false, regexps are matched one by one even if they can be compiled into automaton.
+	///        Regexp matching is a reference implementation, so it is useful for testing.
+	explicit Lexer(TokenPatterns<TokenType> const &patterns, QList<Error> &errors, bool useAutomaton = true)
 		: mPatterns(patterns), mErrors(errors)
 	{
 		// Doing syntax check of lexeme regexps and searching for whitespace and newline definitions, they will be
 		// needed later for error recovery.
+		bool regExpsAreValid = true;
 		for (const TokenType tokenType : mPatterns.allPatterns()) {
 			const QRegularExpression &regExp = mPatterns.tokenPattern(tokenType);
 			if (!regExp.isValid()) {
+				regExpsAreValid = false;
 				qDebug() << "Invalid regexp: " + regExp.pattern();
 				mErrors << Error(Connection(), QObject::tr("Invalid regexp: ") + regExp.pattern()
 						, ErrorType::lexicalError, Severity::internalError);
@@ -67,6 +73,23 @@ public:
 				}
 			}
 		}
+
+		if (useAutomaton && regExpsAreValid) {
+			mAutomatonTokens = mPatterns.allPatterns();
+			QList<QRegularExpression> regExps;
+			for (const TokenType tokenType : mAutomatonTokens) {
+				regExps << mPatterns.tokenPattern(tokenType);
+			}
+
+			// Unsupported patterns leave automaton invalid, regexps will be used then.
+			mAutomaton.compile(regExps);
+		}
+	}
+
+	/// Returns true if tokens are recognized by compiled automaton, false if regexps are matched one by one.
+	bool usesAutomaton() const
+	{
+		return mAutomaton.isValid();
 	}
 
 	/// Tokenizes input string, returns list of detected tokens, list of errors and separate list of comments.
@@ -85,7 +108,9 @@ public:
 		while (absolutePosition < input.length()) {
 			CandidateMatch bestMatch = findBestMatch(input, absolutePosition);
 
-			if (bestMatch.match.hasMatch()) {
+			if (bestMatch.length > 0) {
+				const QString lexeme = input.mid(absolutePosition, bestMatch.length);
+				const int absoluteTokenEnd = absolutePosition + bestMatch.length - 1;
 				int tokenEndLine = line;
 				int tokenEndColumn = column;
 
@@ -96,8 +121,7 @@ public:
 					// Determining connection of the lexeme. String is the only token that can span multiple lines so
 					// special care is needed to maintain connection.
 					if (bestMatch.candidate == TokenType::string) {
-						QRegularExpressionMatchIterator matchIterator = mNewLineRegexp.globalMatch(
-								bestMatch.match.captured());
+						QRegularExpressionMatchIterator matchIterator = mNewLineRegexp.globalMatch(lexeme);
 
 						QRegularExpressionMatch match;
 
@@ -109,34 +133,29 @@ public:
 						if (match.hasMatch()) {
 							const int relativeLastNewLineOffset = match.capturedEnd() - 1;
 							const int absoluteLastNewLineOffset = absolutePosition + relativeLastNewLineOffset;
-							const int absoluteTokenEnd = bestMatch.match.capturedEnd() - 1;
 							tokenEndColumn = absoluteTokenEnd - absoluteLastNewLineOffset - 1;
 						} else {
-							tokenEndColumn += bestMatch.match.capturedLength() - 1;
+							tokenEndColumn += bestMatch.length - 1;
 						}
 					} else {
-						tokenEndColumn += bestMatch.match.capturedLength() - 1;
+						tokenEndColumn += bestMatch.length - 1;
 					}
 
-					const Range range(Connection(bestMatch.match.capturedStart(), line, column)
-							, Connection(bestMatch.match.capturedEnd() - 1, tokenEndLine, tokenEndColumn));
+					const Range range(Connection(absolutePosition, line, column)
+							, Connection(absoluteTokenEnd, tokenEndLine, tokenEndColumn));
 
 					if (bestMatch.candidate == TokenType::identifier) {
 						// Keyword is an identifier which is separate lexeme.
-						bestMatch.candidate = checkForKeyword(bestMatch.match.captured());
+						bestMatch.candidate = checkForKeyword(lexeme);
 					}
 
-					result << Token<TokenType>(bestMatch.candidate
-							, range
-							, bestMatch.match.captured());
+					result << Token<TokenType>(bestMatch.candidate, range, lexeme);
 				} else if (bestMatch.candidate == TokenType::comment) {
-					tokenEndColumn += bestMatch.match.capturedLength() - 1;
-					const Range range(Connection(bestMatch.match.capturedStart(), line, column)
-							, Connection(bestMatch.match.capturedEnd() - 1, tokenEndLine, tokenEndColumn));
+					tokenEndColumn += bestMatch.length - 1;
+					const Range range(Connection(absolutePosition, line, column)
+							, Connection(absoluteTokenEnd, tokenEndLine, tokenEndColumn));
 
-					mComments << Token<TokenType>(bestMatch.candidate
-							, range
-							, bestMatch.match.captured());
+					mComments << Token<TokenType>(bestMatch.candidate, range, lexeme);
 				}
 
 				// Keeping connection updated.
@@ -144,13 +163,13 @@ public:
 					++line;
 					column = 0;
 				} else if (bestMatch.candidate == TokenType::whitespace || bestMatch.candidate == TokenType::comment) {
-					column += bestMatch.match.capturedLength();
+					column += bestMatch.length;
 				} else {
 					line = tokenEndLine;
 					column = tokenEndColumn + 1;
 				}
 
-				absolutePosition += bestMatch.match.capturedLength();
+				absolutePosition += bestMatch.length;
 			} else {
 				const auto errorConnection = Connection(absolutePosition, line, column);
 				QString skippedSymbols;
@@ -192,7 +211,9 @@ public:
 private:
 	struct CandidateMatch {
 		TokenType candidate;
-		QRegularExpressionMatch match;
+
+		/// Length of matched lexeme, 0 if nothing matched.
+		int length;
 	};
 
 	TokenType checkForKeyword(const QString &identifier) const
@@ -208,6 +229,12 @@ private:
 
 	CandidateMatch findBestMatch(const QString &input, const int absolutePosition) const
 	{
+		if (mAutomaton.isValid()) {
+			int pattern = -1;
+			const int length = mAutomaton.match(input, absolutePosition, pattern);
+			return CandidateMatch{length > 0 ? mAutomatonTokens[pattern] : TokenType::whitespace, length};
+		}
+
 		TokenType candidate = TokenType::whitespace;
 		QRegularExpressionMatch bestMatch;
 
@@ -228,7 +255,7 @@ private:
 			}
 		}
 
-		return CandidateMatch{candidate, bestMatch};
+		return CandidateMatch{candidate, bestMatch.capturedLength()};
 	}
 
 	TokenPatterns<TokenType> const mPatterns;
@@ -236,6 +263,12 @@ private:
 	QRegularExpression mWhitespaceRegexp;
 	QRegularExpression mNewLineRegexp;
 
+	/// Automaton recognizing all patterns, invalid if some of them are not supported by it.
+	TokenAutomaton mAutomaton;
+
+	/// Token types in the order their patterns were passed to automaton.
+	QList<TokenType> mAutomatonTokens;
+
 	QList<Error> &mErrors;
 	QList<Token<TokenType>> mComments;
 };
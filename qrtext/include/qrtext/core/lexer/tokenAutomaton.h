@@ -0,0 +1,79 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QList>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+#include <QtCore/QRegularExpression>
+
+#include "qrtext/declSpec.h"
+
+namespace qrtext {
+namespace core {
+
+/// Deterministic finite automaton recognizing a set of token patterns at once. Allows lexer to find the longest
+/// match of all patterns in a single pass over input instead of trying each regular expression separately.
+/// Characters of input are grouped into classes that are not distinguished by patterns, so transitions are stored
+/// in a table indexed by state and character class.
+///
+/// Only a subset of regular expressions syntax is supported: literal characters and escaped punctuation, "\n", "\t",
+/// "\r", ".", character sets like "[^a-z_\p{L}]", groups, alternatives and "*", "+", "?" quantifiers. Explicitly
+/// mentioned characters shall be from Latin-1 range, other characters are distinguished only by being or not being
+/// a letter. Patterns with anything else (or with pattern options) are not compiled, lexer shall use regular
+/// expressions then.
+///
+/// Note that automaton always finds the longest match of a pattern while regular expression engine prefers the first
+/// matching alternative, so patterns shall not depend on alternatives order.
+class QRTEXT_EXPORT TokenAutomaton
+{
+public:
+	/// Compiles given patterns into automaton, previous contents are discarded.
+	/// @returns true if all patterns were compiled, false if some of them use unsupported syntax.
+	bool compile(const QList<QRegularExpression> &patterns);
+
+	/// Returns true if automaton was successfully compiled and can be used for matching.
+	bool isValid() const;
+
+	/// Finds the longest non-empty prefix of input starting at given position that matches some pattern.
+	/// @param pattern - will contain an index of matched pattern in a list given to compile(), if there are several
+	///        such patterns the first one is taken. Will be -1 if nothing matched.
+	/// @returns length of a match or 0 if nothing matched.
+	int match(const QString &input, int position, int &pattern) const;
+
+private:
+	/// Returns class of given Unicode code point.
+	int characterClass(uint character) const;
+
+	/// Number of character classes, it is a row length of transitions table.
+	int mClassesCount = 0;
+
+	/// Character classes of Latin-1 characters.
+	QVector<int> mLatin1Classes;
+
+	/// Character classes of all other letters and non-letters.
+	int mLetterClass = -1;
+	int mNonLetterClass = -1;
+
+	/// Transitions table, next state for a state and a character class is stored at
+	/// (state * mClassesCount + class), -1 means that match can not be continued. Initial state is 0.
+	QVector<int> mTransitions;
+
+	/// For each state an index of a pattern matched when input ends in this state, or -1.
+	QVector<int> mAccepting;
+};
+
+}
+}
@@ -97,6 +97,14 @@ public:
 	/// types of identifiers declared there.
 	void forget(QSharedPointer<ast::Node> const &root);
 
+	/// Returns a number that changes each time when declaration or type of given identifier is changed (by analysis
+	/// of some code or by changing information about predefined identifiers). Results of analysis of a tree using
+	/// only identifiers with the same versions (and the same version()) will be the same, so it may be skipped.
+	int identifierVersion(const QString &identifier) const;
+
+	/// Returns a number that changes each time when analyzer is cleared.
+	int version() const;
+
 protected:
 	/// Assigns given type to given expression.
 	void assign(QSharedPointer<ast::Node> const &expression, const QSharedPointer<types::TypeExpression> &type);
@@ -135,13 +143,36 @@ protected:
 	/// and request another pass on AST to recheck type constraints.
 	void requestRecheck();
 
+	/// Tells that information about given identifier was changed outside of analysis, so code using it shall be
+	/// analyzed again.
+	void identifierChanged(const QString &identifier);
+
 private:
+	/// Declaration and type of an identifier at some moment of analysis. Keeps type variable alive, so identity
+	/// of type variables can be compared safely.
+	struct IdentifierState
+	{
+		bool operator !=(const IdentifierState &other) const;
+
+		QSharedPointer<ast::Node> declaration;
+		QSharedPointer<types::TypeVariable> type;
+		int typeVersion = 0;
+	};
+
 	/// Collects type information on a subtree.
 	void collect(QSharedPointer<ast::Node> const &node);
 
 	/// Checks that all nodes in AST have their types.
 	void finalizeResolve(QSharedPointer<ast::Node> const &node);
 
+	/// Remembers state of an identifier when it is first used by current analysis, to compare it with the state
+	/// after analysis. Only identifiers used in analyzed tree can change during analysis, since type variables of
+	/// declarations are shared with other trees only through identifiers.
+	void useIdentifier(const QString &identifier) const;
+
+	/// Returns current declaration and type of a given identifier.
+	IdentifierState identifierState(const QString &identifier) const;
+
 	/// Analyzes given node assuming that all its descendants were analysed and provides type information for it
 	/// using methods like constrain() and unify(). Shall be defined in concrete analyzers.
 	virtual void analyzeNode(QSharedPointer<ast::Node> const &node) = 0;
@@ -169,6 +200,18 @@ private:
 
 	/// True when we need to traverse AST and check type constraints again.
 	bool mRecheckNeeded = true;
+
+	/// Versions of identifiers, see identifierVersion().
+	QHash<QString, int> mIdentifierVersions;
+
+	/// Version of the whole analyzer state, see version().
+	int mVersion = 0;
+
+	/// True while analyze() is running.
+	bool mAnalyzing = false;
+
+	/// States of identifiers used by current analysis, as they were before their first use.
+	mutable QHash<QString, IdentifierState> mUsedIdentifiers;
 };
 
 }
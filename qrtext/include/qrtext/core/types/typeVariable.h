@@ -61,10 +61,19 @@ public:
 			, const GeneralizationsTableInterface &generalizationsTable
 			, bool *wasCoercion);
 
+	/// Returns a number that changes each time when the set of possible types of this variable changes.
+	int version() const;
+
 	QString toString() const override;
 
 private:
+	/// Replaces possible types of a variable, bumping its version if they are actually changed.
+	void setAllowedTypes(const QSet<QSharedPointer<TypeExpression>> &types);
+
 	QSet<QSharedPointer<TypeExpression>> mAllowedTypes;
+
+	/// Version of a set of possible types, see version().
+	int mVersion = 0;
 };
 
 }
@@ -30,6 +30,10 @@ public:
 	/// A list of identifiers currently known to interpreter.
 	virtual QStringList identifiers() const = 0;
 
+	/// Returns true if the given identifier is used by some code parsed since the last clear of interpreter state.
+	/// Allows to skip updating values that nobody reads.
+	virtual bool isReferenced(const QString &identifier) const = 0;
+
 	/// A value of identifier with given name.
 	template<typename T>
 	T value(const QString &identifier) const
@@ -16,6 +16,7 @@
 
 #include <QtCore/QSharedPointer>
 #include <QtCore/QScopedPointer>
+#include <QtCore/QSet>
 
 #include "qrtext/languageToolboxInterface.h"
 
@@ -29,6 +30,8 @@ class LuaLexer;
 class LuaParser;
 class LuaSemanticAnalyzer;
 class LuaInterpreter;
+class LuaCompiler;
+struct LuaBytecode;
 }
 
 typedef core::Error Error;
@@ -45,6 +48,9 @@ typedef core::Error Error;
 /// Note that types of variables may change during parsing next chunks, so, for example, after parsing "a = 123" type
 /// of "a" will be inferred as Integer, but after parsing "a = 1.0" it will be changed to Float. Generators may reliably
 /// use type information only when all code in a program is parsed.
+///
+/// Interpreted ASTs are compiled into bytecode once and the bytecode is reused while the AST and types it depends on
+/// stay the same.
 class QRTEXT_EXPORT LuaToolbox : public LanguageToolboxInterface
 {
 public:
@@ -92,6 +98,12 @@ public:
 
 	QStringList identifiers() const override;
 
+	bool isReferenced(const QString &identifier) const override;
+
+	/// Returns how many times parse() actually ran semantic analysis, analysis of unchanged code whose environment
+	/// did not change is skipped and not counted.
+	int analysesCount() const;
+
 	QMap<QString, QSharedPointer<core::types::TypeExpression>> variableTypes() const override;
 
 	const QStringList &specialIdentifiers() const override;
@@ -135,18 +147,51 @@ private:
 
 	void reportErrors();
 
+	/// Versions of analyzer environment that results of analysis of some code depend on.
+	struct AnalysisState
+	{
+		/// Version of the whole analyzer.
+		int analyzerVersion;
+
+		/// Versions of identifiers used in code.
+		QHash<QString, int> identifierVersions;
+	};
+
+	/// Returns true if code with given id and property was analyzed and environment has not changed since then.
+	bool isAnalyzed(const qReal::Id &id, const QString &propertyName) const;
+
+	/// Remembers versions of environment that analysis of a given AST depends on.
+	void rememberAnalysis(const qReal::Id &id, const QString &propertyName, const QSharedPointer<core::ast::Node> &ast);
+
+	/// Collects names of all identifiers used in a given AST.
+	static void collectIdentifiers(const QSharedPointer<core::ast::Node> &node, QSet<QString> &identifiers);
+
 	QList<core::Error> mErrors;
 
 	QScopedPointer<details::LuaLexer> mLexer;
 	QScopedPointer<details::LuaParser> mParser;
 	QScopedPointer<details::LuaSemanticAnalyzer> mAnalyzer;
 	QScopedPointer<details::LuaInterpreter> mInterpreter;
+	QScopedPointer<details::LuaCompiler> mCompiler;
 
 	QHash<qReal::Id, QHash<QString, QSharedPointer<core::ast::Node>>> mAstRoots;
 	QHash<qReal::Id, QHash<QString, QString>> mParsedCache;
 
+	/// Environment versions for successfully analyzed code, analysis of unchanged code is skipped if they are still
+	/// actual.
+	QHash<qReal::Id, QHash<QString, AnalysisState>> mAnalysisStates;
+
+	/// Compiled code of interpreted ASTs.
+	QHash<QSharedPointer<core::ast::Node>, QSharedPointer<details::LuaBytecode>> mBytecode;
+
 	QStringList mSpecialConstants;
 	QStringList mSpecialIdentifiers;
+
+	/// Identifiers used in successfully analyzed code since the last clear().
+	QSet<QString> mReferencedIdentifiers;
+
+	/// See analysesCount().
+	int mAnalysesCount = 0;
 };
 
 }
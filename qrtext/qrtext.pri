@@ -28,6 +28,7 @@ HEADERS += \
 	$$PWD/include/qrtext/core/lexer/lexer.h \
 	$$PWD/include/qrtext/core/lexer/token.h \
 	$$PWD/include/qrtext/core/lexer/tokenPatterns.h \
+	$$PWD/include/qrtext/core/lexer/tokenAutomaton.h \
 	$$PWD/include/qrtext/core/parser/parser.h \
 	$$PWD/include/qrtext/core/parser/parserContext.h \
 	$$PWD/include/qrtext/core/parser/parserRef.h \
@@ -109,6 +110,8 @@ HEADERS += \
 	$$PWD/include/qrtext/lua/types/number.h \
 	$$PWD/include/qrtext/lua/types/string.h \
 	$$PWD/include/qrtext/lua/types/table.h \
+	$$PWD/src/lua/luaBytecode.h \
+	$$PWD/src/lua/luaCompiler.h \
 	$$PWD/src/lua/luaGeneralizationsTable.h \
 	$$PWD/src/lua/luaInterpreter.h \
 	$$PWD/src/lua/luaLexer.h \
@@ -122,8 +125,10 @@ SOURCES += \
 	$$PWD/src/core/error.cpp \
 	$$PWD/src/core/range.cpp \
 	$$PWD/src/core/ast/node.cpp \
+	$$PWD/src/core/lexer/tokenAutomaton.cpp \
 	$$PWD/src/core/semantics/semanticAnalyzer.cpp \
 	$$PWD/src/core/types/typeVariable.cpp \
+	$$PWD/src/lua/luaCompiler.cpp \
 	$$PWD/src/lua/luaGeneralizationsTable.cpp \
 	$$PWD/src/lua/luaInterpreter.cpp \
 	$$PWD/src/lua/luaLexer.cpp \
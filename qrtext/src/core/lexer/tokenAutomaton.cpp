@@ -0,0 +1,530 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "qrtext/core/lexer/tokenAutomaton.h"
+
+#include <algorithm>
+
+#include <QtCore/QMap>
+#include <QtCore/QPair>
+
+using namespace qrtext::core;
+
+namespace {
+
+/// Code points representing all non-Latin-1 letters and non-letters respectively.
+const uint letterRepresentative = 0x0100;
+const uint nonLetterRepresentative = 0x2000;
+
+/// Limit of automaton size, patterns requiring more states are considered unsupported.
+const int maxStates = 10000;
+
+/// Set of characters that can be matched by one position in a pattern.
+struct CharacterSet
+{
+	QVector<QPair<uint, uint>> ranges;
+	bool letters = false;
+	bool negated = false;
+
+	bool contains(uint character) const
+	{
+		bool result = letters && QChar::isLetter(character);
+		for (const QPair<uint, uint> &range : ranges) {
+			result = result || (range.first <= character && character <= range.second);
+		}
+
+		return result != negated;
+	}
+};
+
+/// State of nondeterministic automaton.
+struct NfaState
+{
+	QVector<int> epsilonTransitions;
+
+	/// Transition on a character from this set (if any) leads to the state "next".
+	int characterSet = -1;
+	int next = -1;
+
+	int acceptedPattern = -1;
+};
+
+/// Part of nondeterministic automaton corresponding to a part of pattern, has single entry and single exit.
+struct Fragment
+{
+	int start;
+	int end;
+};
+
+/// Parses supported subset of regular expressions syntax and builds nondeterministic automaton by Thompson's
+/// construction.
+class PatternCompiler
+{
+public:
+	PatternCompiler(QVector<NfaState> &states, QVector<CharacterSet> &sets)
+		: mStates(states)
+		, mSets(sets)
+	{
+	}
+
+	/// Returns false if pattern uses unsupported syntax.
+	bool compile(const QString &pattern, Fragment &result)
+	{
+		mPattern = pattern;
+		mPosition = 0;
+		mFailed = false;
+		result = alternative();
+		return !mFailed && atEnd();
+	}
+
+private:
+	bool atEnd() const
+	{
+		return mPosition >= mPattern.length();
+	}
+
+	QChar peek() const
+	{
+		return mPattern.at(mPosition);
+	}
+
+	int newState()
+	{
+		mStates.append(NfaState());
+		return mStates.size() - 1;
+	}
+
+	void epsilon(int from, int to)
+	{
+		mStates[from].epsilonTransitions << to;
+	}
+
+	Fragment characters(const CharacterSet &set)
+	{
+		mSets << set;
+		const int start = newState();
+		const int end = newState();
+		mStates[start].characterSet = mSets.size() - 1;
+		mStates[start].next = end;
+		return {start, end};
+	}
+
+	void addRange(CharacterSet &set, uint from, uint to)
+	{
+		// Other characters are distinguished only by being letters, so they can not be mentioned explicitly.
+		if (from > to || to > 0xFF) {
+			mFailed = true;
+			return;
+		}
+
+		set.ranges << qMakePair(from, to);
+	}
+
+	Fragment alternative()
+	{
+		Fragment result = concatenation();
+		if (atEnd() || peek() != '|') {
+			return result;
+		}
+
+		const int start = newState();
+		const int end = newState();
+		epsilon(start, result.start);
+		epsilon(result.end, end);
+		while (!mFailed && !atEnd() && peek() == '|') {
+			++mPosition;
+			const Fragment next = concatenation();
+			epsilon(start, next.start);
+			epsilon(next.end, end);
+		}
+
+		return {start, end};
+	}
+
+	Fragment concatenation()
+	{
+		const int start = newState();
+		Fragment result{start, start};
+		while (!mFailed && !atEnd() && peek() != '|' && peek() != ')') {
+			const Fragment next = quantified();
+			epsilon(result.end, next.start);
+			result.end = next.end;
+		}
+
+		return result;
+	}
+
+	Fragment quantified()
+	{
+		const Fragment atom = this->atom();
+		if (mFailed || atEnd()) {
+			return atom;
+		}
+
+		const QChar quantifier = peek();
+		if (quantifier != '*' && quantifier != '+' && quantifier != '?') {
+			return atom;
+		}
+
+		++mPosition;
+		if (!atEnd() && (peek() == '*' || peek() == '+' || peek() == '?')) {
+			// Lazy and possessive quantifiers.
+			mFailed = true;
+			return atom;
+		}
+
+		const int start = newState();
+		const int end = newState();
+		epsilon(start, atom.start);
+		epsilon(atom.end, end);
+		if (quantifier != '+') {
+			epsilon(start, end);
+		}
+
+		if (quantifier != '?') {
+			epsilon(atom.end, atom.start);
+		}
+
+		return {start, end};
+	}
+
+	Fragment atom()
+	{
+		const QChar symbol = peek();
+		++mPosition;
+
+		CharacterSet set;
+		if (symbol == '(') {
+			if (!atEnd() && peek() == '?') {
+				// Special groups.
+				mFailed = true;
+				return {0, 0};
+			}
+
+			const Fragment result = alternative();
+			if (atEnd() || peek() != ')') {
+				mFailed = true;
+			} else {
+				++mPosition;
+			}
+
+			return result;
+		} else if (symbol == '[') {
+			set = characterSet();
+		} else if (symbol == '.') {
+			set.negated = true;
+			addRange(set, '\n', '\n');
+		} else if (symbol == '\\') {
+			escape(set);
+		} else if (symbol == '{' && !atEnd() && peek().isDigit()) {
+			// Counted repetition.
+			mFailed = true;
+		} else if (QString("*+?^$").contains(symbol)) {
+			// Anchors and quantifiers without an operand.
+			mFailed = true;
+		} else {
+			addRange(set, symbol.unicode(), symbol.unicode());
+		}
+
+		return characters(set);
+	}
+
+	/// Parses an escape sequence after a backslash and adds it into a given set.
+	void escape(CharacterSet &set)
+	{
+		if (atEnd()) {
+			mFailed = true;
+			return;
+		}
+
+		const QChar symbol = peek();
+		++mPosition;
+		if (symbol == 'n') {
+			addRange(set, '\n', '\n');
+		} else if (symbol == 't') {
+			addRange(set, '\t', '\t');
+		} else if (symbol == 'r') {
+			addRange(set, '\r', '\r');
+		} else if (symbol == 'p' && mPattern.mid(mPosition, 3) == "{L}") {
+			mPosition += 3;
+			set.letters = true;
+		} else if (symbol.isLetterOrNumber()) {
+			// Character types, back references, character codes and so on.
+			mFailed = true;
+		} else {
+			addRange(set, symbol.unicode(), symbol.unicode());
+		}
+	}
+
+	/// Parses a set in square brackets after the opening one.
+	CharacterSet characterSet()
+	{
+		CharacterSet set;
+		if (!atEnd() && peek() == '^') {
+			set.negated = true;
+			++mPosition;
+		}
+
+		// Closing bracket in the beginning of a set is treated literally.
+		bool first = true;
+		while (!mFailed) {
+			if (atEnd()) {
+				mFailed = true;
+				break;
+			}
+
+			const QChar symbol = peek();
+			++mPosition;
+			if (symbol == ']' && !first) {
+				break;
+			}
+
+			first = false;
+			const uint from = setCharacter(symbol, set);
+			if (from == 0xFFFFFFFF) {
+				continue;
+			}
+
+			if (mPosition + 1 < mPattern.length() && peek() == '-' && mPattern.at(mPosition + 1) != ']') {
+				++mPosition;
+				const QChar toSymbol = peek();
+				++mPosition;
+				CharacterSet escaped;
+				const uint to = setCharacter(toSymbol, escaped);
+				if (to == 0xFFFFFFFF) {
+					mFailed = true;
+				} else {
+					addRange(set, from, to);
+				}
+			} else {
+				addRange(set, from, from);
+			}
+		}
+
+		return set;
+	}
+
+	/// Returns a character described by the given symbol in a set and an escape sequence after it if any, or
+	/// 0xFFFFFFFF if it is not a single character (in this case it is added to the set).
+	uint setCharacter(const QChar &symbol, CharacterSet &set)
+	{
+		if (symbol == '[' && !atEnd() && peek() == ':') {
+			// POSIX classes.
+			mFailed = true;
+			return 0xFFFFFFFF;
+		}
+
+		if (symbol != '\\') {
+			return symbol.unicode();
+		}
+
+		CharacterSet escaped;
+		escape(escaped);
+		if (escaped.letters) {
+			set.letters = true;
+			return 0xFFFFFFFF;
+		}
+
+		return escaped.ranges.isEmpty() ? 0xFFFFFFFF : escaped.ranges.first().first;
+	}
+
+	QVector<NfaState> &mStates;
+	QVector<CharacterSet> &mSets;
+	QString mPattern;
+	int mPosition = 0;
+	bool mFailed = false;
+};
+
+/// Returns sorted list of states reachable from given ones by epsilon transitions.
+QVector<int> closure(const QVector<NfaState> &states, const QVector<int> &from)
+{
+	QVector<bool> visited(states.size(), false);
+	QVector<int> stack = from;
+	QVector<int> result;
+	while (!stack.isEmpty()) {
+		const int state = stack.takeLast();
+		if (visited[state]) {
+			continue;
+		}
+
+		visited[state] = true;
+		result << state;
+		for (const int next : states[state].epsilonTransitions) {
+			if (!visited[next]) {
+				stack << next;
+			}
+		}
+	}
+
+	std::sort(result.begin(), result.end());
+	return result;
+}
+
+}
+
+bool TokenAutomaton::compile(const QList<QRegularExpression> &patterns)
+{
+	mClassesCount = 0;
+	mLatin1Classes.clear();
+	mLetterClass = -1;
+	mNonLetterClass = -1;
+	mTransitions.clear();
+	mAccepting.clear();
+
+	// Building nondeterministic automaton with all patterns as alternatives.
+	QVector<NfaState> states(1);
+	QVector<CharacterSet> sets;
+	PatternCompiler compiler(states, sets);
+	for (int i = 0; i < patterns.size(); ++i) {
+		Fragment fragment;
+		if (patterns[i].patternOptions() != QRegularExpression::NoPatternOption
+				|| !compiler.compile(patterns[i].pattern(), fragment))
+		{
+			return false;
+		}
+
+		states[0].epsilonTransitions << fragment.start;
+		states[fragment.end].acceptedPattern = i;
+	}
+
+	// Splitting characters into classes by sets they belong to. Each class is described by a signature telling
+	// which sets contain its characters.
+	QVector<uint> representatives;
+	for (uint character = 0; character <= 0xFF; ++character) {
+		representatives << character;
+	}
+
+	representatives << letterRepresentative << nonLetterRepresentative;
+
+	QMap<QByteArray, int> classesBySignature;
+	QVector<QByteArray> signatures;
+	QVector<int> classes;
+	for (const uint character : representatives) {
+		QByteArray signature(sets.size(), '0');
+		for (int i = 0; i < sets.size(); ++i) {
+			if (sets[i].contains(character)) {
+				signature[i] = '1';
+			}
+		}
+
+		if (!classesBySignature.contains(signature)) {
+			classesBySignature[signature] = signatures.size();
+			signatures << signature;
+		}
+
+		classes << classesBySignature[signature];
+	}
+
+	mClassesCount = signatures.size();
+	mLatin1Classes = classes.mid(0, 0x100);
+	mLetterClass = classes[0x100];
+	mNonLetterClass = classes[0x101];
+
+	// Subset construction, each state of resulting automaton corresponds to a set of nondeterministic states.
+	QMap<QVector<int>, int> stateIndices;
+	QVector<QVector<int>> stateContents;
+	const auto stateFor = [&](const QVector<int> &nfaStates) {
+		if (stateIndices.contains(nfaStates)) {
+			return stateIndices[nfaStates];
+		}
+
+		int acceptedPattern = -1;
+		for (const int state : nfaStates) {
+			const int pattern = states[state].acceptedPattern;
+			if (pattern >= 0 && (acceptedPattern < 0 || pattern < acceptedPattern)) {
+				acceptedPattern = pattern;
+			}
+		}
+
+		const int index = stateContents.size();
+		stateIndices[nfaStates] = index;
+		stateContents << nfaStates;
+		mAccepting << acceptedPattern;
+		mTransitions << QVector<int>(mClassesCount, -1);
+		return index;
+	};
+
+	stateFor(closure(states, {0}));
+	for (int current = 0; current < stateContents.size(); ++current) {
+		if (stateContents.size() > maxStates) {
+			mTransitions.clear();
+			mAccepting.clear();
+			return false;
+		}
+
+		const QVector<int> nfaStates = stateContents[current];
+		for (int characterClass = 0; characterClass < mClassesCount; ++characterClass) {
+			QVector<int> next;
+			for (const int state : nfaStates) {
+				const int set = states[state].characterSet;
+				if (set >= 0 && signatures[characterClass][set] == '1') {
+					next << states[state].next;
+				}
+			}
+
+			if (!next.isEmpty()) {
+				// New state may be added here, so target is computed before taking a reference into the table.
+				const int target = stateFor(closure(states, next));
+				mTransitions[current * mClassesCount + characterClass] = target;
+			}
+		}
+	}
+
+	return true;
+}
+
+bool TokenAutomaton::isValid() const
+{
+	return !mAccepting.isEmpty();
+}
+
+int TokenAutomaton::match(const QString &input, int position, int &pattern) const
+{
+	pattern = -1;
+	int length = 0;
+	int state = 0;
+	int current = position;
+	while (current < input.length()) {
+		uint character = input.at(current).unicode();
+		int size = 1;
+		if (QChar::isHighSurrogate(character) && current + 1 < input.length()
+				&& input.at(current + 1).isLowSurrogate())
+		{
+			character = QChar::surrogateToUcs4(input.at(current), input.at(current + 1));
+			size = 2;
+		}
+
+		state = mTransitions[state * mClassesCount + characterClass(character)];
+		if (state < 0) {
+			break;
+		}
+
+		current += size;
+		if (mAccepting[state] >= 0) {
+			pattern = mAccepting[state];
+			length = current - position;
+		}
+	}
+
+	return length;
+}
+
+int TokenAutomaton::characterClass(uint character) const
+{
+	if (character <= 0xFF) {
+		return mLatin1Classes[character];
+	}
+
+	return QChar::isLetter(character) ? mLetterClass : mNonLetterClass;
+}
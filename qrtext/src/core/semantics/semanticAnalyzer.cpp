@@ -34,6 +34,9 @@ QSharedPointer<ast::Node> SemanticAnalyzer::analyze(QSharedPointer<ast::Node> co
 		return root;
 	}
 
+	mUsedIdentifiers.clear();
+	mAnalyzing = true;
+
 	precheck(root);
 
 	mRecheckNeeded = true;
@@ -44,6 +47,16 @@ QSharedPointer<ast::Node> SemanticAnalyzer::analyze(QSharedPointer<ast::Node> co
 	}
 
 	finalizeResolve(root);
+
+	mAnalyzing = false;
+	for (auto it = mUsedIdentifiers.cbegin(); it != mUsedIdentifiers.cend(); ++it) {
+		if (it.value() != identifierState(it.key())) {
+			identifierChanged(it.key());
+		}
+	}
+
+	mUsedIdentifiers.clear();
+
 	return root;
 }
 
@@ -114,6 +127,7 @@ void SemanticAnalyzer::clear()
 {
 	mTypes.clear();
 	mIdentifierDeclarations.clear();
+	++mVersion;
 }
 
 void SemanticAnalyzer::forget(const QSharedPointer<ast::Node> &root)
@@ -136,6 +150,16 @@ void SemanticAnalyzer::forget(const QSharedPointer<ast::Node> &root)
 	}
 }
 
+int SemanticAnalyzer::identifierVersion(const QString &identifier) const
+{
+	return mIdentifierVersions.value(identifier);
+}
+
+int SemanticAnalyzer::version() const
+{
+	return mVersion;
+}
+
 void SemanticAnalyzer::assign(const QSharedPointer<ast::Node> &expression
 		, const QSharedPointer<types::TypeExpression> &type)
 {
@@ -184,16 +208,19 @@ void SemanticAnalyzer::reportError(QSharedPointer<ast::Node> const &node, const
 
 bool SemanticAnalyzer::hasDeclaration(const QString &identifierName) const
 {
+	useIdentifier(identifierName);
 	return mIdentifierDeclarations.contains(identifierName);
 }
 
 QSharedPointer<ast::Node> SemanticAnalyzer::declaration(const QString &identifierName) const
 {
+	useIdentifier(identifierName);
 	return mIdentifierDeclarations.value(identifierName);
 }
 
 void SemanticAnalyzer::addDeclaration(const QString &identifierName, QSharedPointer<ast::Node> const &declaration)
 {
+	useIdentifier(identifierName);
 	mIdentifierDeclarations.insert(identifierName, declaration);
 }
 
@@ -217,6 +244,35 @@ void SemanticAnalyzer::requestRecheck()
 	mRecheckNeeded = true;
 }
 
+void SemanticAnalyzer::identifierChanged(const QString &identifier)
+{
+	++mIdentifierVersions[identifier];
+}
+
+void SemanticAnalyzer::useIdentifier(const QString &identifier) const
+{
+	if (mAnalyzing && !mUsedIdentifiers.contains(identifier)) {
+		mUsedIdentifiers.insert(identifier, identifierState(identifier));
+	}
+}
+
+SemanticAnalyzer::IdentifierState SemanticAnalyzer::identifierState(const QString &identifier) const
+{
+	IdentifierState state;
+	state.declaration = mIdentifierDeclarations.value(identifier);
+	if (state.declaration) {
+		state.type = mTypes.value(as<ast::Expression>(state.declaration));
+		state.typeVersion = state.type ? state.type->version() : 0;
+	}
+
+	return state;
+}
+
+bool SemanticAnalyzer::IdentifierState::operator !=(const IdentifierState &other) const
+{
+	return declaration != other.declaration || type != other.type || typeVersion != other.typeVersion;
+}
+
 bool SemanticAnalyzer::isGeneralization(const QSharedPointer<types::TypeExpression> &specific
 		, const QSharedPointer<types::TypeExpression> &general) const
 {
@@ -72,7 +72,7 @@ void TypeVariable::constrain(const QList<QSharedPointer<TypeExpression>> &types
 		}
 	}
 
-	mAllowedTypes = result;
+	setAllowedTypes(result);
 }
 
 void TypeVariable::constrainAssignment(const QSharedPointer<TypeVariable> &other
@@ -111,7 +111,12 @@ void TypeVariable::constrainAssignment(const QSharedPointer<TypeVariable> &other
 		result.unite(allowedForType);
 	}
 
-	mAllowedTypes = result;
+	setAllowedTypes(result);
+}
+
+int TypeVariable::version() const
+{
+	return mVersion;
 }
 
 QString TypeVariable::toString() const
@@ -123,3 +128,11 @@ QString TypeVariable::toString() const
 
 	return result.join(", ");
 }
+
+void TypeVariable::setAllowedTypes(const QSet<QSharedPointer<TypeExpression>> &types)
+{
+	if (types != mAllowedTypes) {
+		mAllowedTypes = types;
+		++mVersion;
+	}
+}
@@ -0,0 +1,136 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QList>
+#include <QtCore/QVector>
+#include <QtCore/QVariant>
+#include <QtCore/QSharedPointer>
+
+#include "qrtext/core/connection.h"
+#include "qrtext/core/ast/node.h"
+
+namespace qrtext {
+namespace lua {
+namespace details {
+
+/// Operations of virtual machine executing compiled Lua code. In descriptions R(x) denotes register x, K(x) ---
+/// constant x from constants pool, V(x) --- variable in slot x of interpreter, C --- connection of an instruction.
+enum class OpCode
+{
+	/// R(a) = K(b).
+	loadConstant
+	/// R(a) = nil.
+	, loadNil
+	/// R(a) = R(b).
+	, move
+	/// R(a) = V(b).
+	, getVariable
+	/// V(b) = R(a), reports error at C if variable is read-only.
+	, setVariable
+	/// R(a) = intrinsic function number b called with arguments R(a), ..., R(a + c - 1).
+	, call
+	/// R(a) = V(b)[R(a)]...[R(a + c - 1)], reports error at C on negative index.
+	, getElement
+	/// V(b)[R(a + 1)]...[R(a + c)] = R(a), reports error at C on negative index.
+	, setElement
+	/// R(a) = {}.
+	, newTable
+	/// Appends R(b) to table R(a).
+	, append
+	/// R(a)[R(b)] = R(c) converted to string, table is padded with empty strings if needed.
+	, setField
+	/// Reports K(b) as runtime error at C.
+	, error
+
+	/// R(a) = R(b).toInt() != 0.
+	, toBoolean
+	/// Jumps to instruction b if R(a) is false.
+	, jumpIfFalse
+	/// Jumps to instruction b if R(a) is true.
+	, jumpIfTrue
+
+	/// R(a) = op R(b).
+	, unaryMinus
+	, logicalNot
+	, length
+	, bitwiseNegation
+
+	/// R(a) = R(b) op R(c), division operations report error at C on division by zero.
+	, addition
+	, subtraction
+	, multiplication
+	, division
+	, integerDivision
+	, modulo
+	, exponentiation
+	, bitwiseAnd
+	, bitwiseOr
+	, bitwiseXor
+	, bitwiseLeftShift
+	, bitwiseRightShift
+	, concatenation
+	, lessThan
+	, lessOrEqual
+	, greaterThan
+	, greaterOrEqual
+	, equality
+	, inequality
+};
+
+/// Single instruction of virtual machine. Meaning of operands depends on operation code.
+struct Instruction
+{
+	OpCode opCode;
+	int a;
+	int b;
+	int c;
+
+	/// Index of connection in bytecode connections table used to report errors, -1 if instruction can not fail.
+	int connection;
+};
+
+/// Result of a type check made by compiler. Compiled code depends on types of some expressions (for example, only
+/// tables indexed by numbers are supported), so it shall be recompiled when these types change.
+struct TypeAssumption
+{
+	enum Type {
+		number
+		, string
+	};
+
+	/// Expression whose type was checked.
+	QSharedPointer<core::ast::Node> expression;
+
+	/// Type that expression was checked against.
+	Type type;
+
+	/// True if expression had given type during compilation.
+	bool holds;
+};
+
+/// Compiled code of one chunk. Registers are local to chunk execution, result of a chunk is in register 0.
+struct LuaBytecode
+{
+	QVector<Instruction> instructions;
+	QVector<QVariant> constants;
+	QVector<core::Connection> connections;
+	QList<TypeAssumption> typeAssumptions;
+	int registersCount = 1;
+};
+
+}
+}
+}
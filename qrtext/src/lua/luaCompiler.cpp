@@ -0,0 +1,413 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "qrtext/src/lua/luaCompiler.h"
+
+#include "qrtext/src/lua/luaInterpreter.h"
+
+#include "qrtext/lua/types/number.h"
+#include "qrtext/lua/types/string.h"
+
+#include "qrtext/lua/ast/assignment.h"
+#include "qrtext/lua/ast/floatNumber.h"
+#include "qrtext/lua/ast/functionCall.h"
+#include "qrtext/lua/ast/identifier.h"
+#include "qrtext/lua/ast/integerNumber.h"
+#include "qrtext/lua/ast/string.h"
+#include "qrtext/lua/ast/true.h"
+#include "qrtext/lua/ast/false.h"
+#include "qrtext/lua/ast/nil.h"
+#include "qrtext/lua/ast/tableConstructor.h"
+#include "qrtext/lua/ast/indexingExpression.h"
+#include "qrtext/lua/ast/block.h"
+
+#include "qrtext/lua/ast/unaryMinus.h"
+#include "qrtext/lua/ast/not.h"
+#include "qrtext/lua/ast/length.h"
+#include "qrtext/lua/ast/bitwiseNegation.h"
+
+#include "qrtext/lua/ast/addition.h"
+#include "qrtext/lua/ast/subtraction.h"
+#include "qrtext/lua/ast/multiplication.h"
+#include "qrtext/lua/ast/division.h"
+#include "qrtext/lua/ast/integerDivision.h"
+#include "qrtext/lua/ast/exponentiation.h"
+#include "qrtext/lua/ast/modulo.h"
+#include "qrtext/lua/ast/bitwiseAnd.h"
+#include "qrtext/lua/ast/bitwiseXor.h"
+#include "qrtext/lua/ast/bitwiseOr.h"
+#include "qrtext/lua/ast/bitwiseRightShift.h"
+#include "qrtext/lua/ast/bitwiseLeftShift.h"
+#include "qrtext/lua/ast/concatenation.h"
+#include "qrtext/lua/ast/lessThan.h"
+#include "qrtext/lua/ast/greaterThan.h"
+#include "qrtext/lua/ast/lessOrEqual.h"
+#include "qrtext/lua/ast/greaterOrEqual.h"
+#include "qrtext/lua/ast/equality.h"
+#include "qrtext/lua/ast/inequality.h"
+#include "qrtext/lua/ast/logicalAnd.h"
+#include "qrtext/lua/ast/logicalOr.h"
+
+using namespace qrtext::lua::details;
+using namespace qrtext;
+
+LuaCompiler::LuaCompiler(LuaInterpreter &interpreter)
+	: mInterpreter(interpreter)
+{
+}
+
+QSharedPointer<LuaBytecode> LuaCompiler::compile(const QSharedPointer<core::ast::Node> &root
+		, const core::SemanticAnalyzer &semanticAnalyzer)
+{
+	mSemanticAnalyzer = &semanticAnalyzer;
+	mBytecode.reset(new LuaBytecode());
+	mFreeRegister = 0;
+
+	compileNode(root, allocateRegisters(1));
+
+	mSemanticAnalyzer = nullptr;
+	QSharedPointer<LuaBytecode> result;
+	result.swap(mBytecode);
+	return result;
+}
+
+bool LuaCompiler::isUpToDate(const LuaBytecode &bytecode, const core::SemanticAnalyzer &semanticAnalyzer)
+{
+	for (const TypeAssumption &assumption : bytecode.typeAssumptions) {
+		if (checkType(assumption.expression, assumption.type, semanticAnalyzer) != assumption.holds) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void LuaCompiler::compileNode(const QSharedPointer<core::ast::Node> &node, int target)
+{
+	if (!node) {
+		addInstruction(OpCode::loadNil, target);
+	} else if (node->is<ast::Block>()) {
+		const auto statements = as<ast::Block>(node)->children();
+		if (statements.isEmpty()) {
+			addInstruction(OpCode::loadNil, target);
+		}
+
+		// Each statement overwrites the result of previous one, so the last statement gives the result of a block.
+		for (const auto &statement : statements) {
+			compileNode(statement, target);
+		}
+	} else if (node->is<ast::IntegerNumber>()) {
+		/// @todo Integer and float literals may differ from those recognized in toInt() and toDouble().
+		bool ok = false;
+		addInstruction(OpCode::loadConstant, target
+				, addConstant(as<ast::IntegerNumber>(node)->stringRepresentation().toInt(&ok, 0)));
+	} else if (node->is<ast::FloatNumber>()) {
+		addInstruction(OpCode::loadConstant, target
+				, addConstant(as<ast::FloatNumber>(node)->stringRepresentation().toDouble()));
+	} else if (node->is<ast::String>()) {
+		addInstruction(OpCode::loadConstant, target, addConstant(as<ast::String>(node)->string()));
+	} else if (node->is<ast::TableConstructor>()) {
+		compileTable(node, target);
+	} else if (node->is<ast::Assignment>()) {
+		compileAssignment(node, target);
+	} else if (node->is<ast::Identifier>()) {
+		addInstruction(OpCode::getVariable, target, mInterpreter.variableSlot(as<ast::Identifier>(node)->name()));
+	} else if (node->is<ast::FunctionCall>()) {
+		compileFunctionCall(node, target);
+	} else if (node->is<ast::IndexingExpression>()) {
+		compileTableElement(node, QSharedPointer<core::ast::Node>(), target);
+	} else if (node->is<ast::UnaryOperator>()) {
+		compileUnaryOperator(node, target);
+	} else if (node->is<ast::BinaryOperator>()) {
+		compileBinaryOperator(node, target);
+	} else if (node->is<ast::True>()) {
+		addInstruction(OpCode::loadConstant, target, addConstant(true));
+	} else if (node->is<ast::False>()) {
+		addInstruction(OpCode::loadConstant, target, addConstant(false));
+	} else if (node->is<ast::Nil>()) {
+		addInstruction(OpCode::loadNil, target);
+	} else {
+		compileError(node, QObject::tr("This construction is not supported by interpreter"));
+		addInstruction(OpCode::loadNil, target);
+	}
+}
+
+void LuaCompiler::compileAssignment(const QSharedPointer<core::ast::Node> &assignment, int target)
+{
+	const auto variable = as<ast::Assignment>(assignment)->variable();
+	const auto value = as<ast::Assignment>(assignment)->value();
+
+	if (variable->is<ast::Identifier>()) {
+		const int valueRegister = allocateRegisters(1);
+		compileNode(value, valueRegister);
+		const int slot = mInterpreter.variableSlot(as<ast::Identifier>(variable)->name());
+		addInstruction(OpCode::setVariable, valueRegister, slot, 0, addConnection(assignment));
+		freeRegisters(1);
+	} else if (variable->is<ast::IndexingExpression>()) {
+		compileTableElement(variable, value, target);
+	} else {
+		const int valueRegister = allocateRegisters(1);
+		compileNode(value, valueRegister);
+		freeRegisters(1);
+		compileError(assignment, QObject::tr("This construction is not supported by interpreter"));
+	}
+
+	addInstruction(OpCode::loadNil, target);
+}
+
+void LuaCompiler::compileFunctionCall(const QSharedPointer<core::ast::Node> &functionCall, int target)
+{
+	const auto function = as<ast::FunctionCall>(functionCall)->function();
+	const auto arguments = as<ast::FunctionCall>(functionCall)->arguments();
+	if (!function->is<ast::Identifier>()) {
+		compileError(functionCall, QObject::tr("This construction is not supported by interpreter"));
+		addInstruction(OpCode::loadNil, target);
+		return;
+	}
+
+	// Result is returned in the register of the first argument, so at least one register is needed.
+	const int registersCount = qMax(1, arguments.size());
+	const int firstArgument = allocateRegisters(registersCount);
+	for (int i = 0; i < arguments.size(); ++i) {
+		compileNode(arguments[i], firstArgument + i);
+	}
+
+	const int functionIndex = mInterpreter.intrinsicFunctionIndex(as<ast::Identifier>(function)->name());
+	addInstruction(OpCode::call, firstArgument, functionIndex, arguments.size());
+	addInstruction(OpCode::move, target, firstArgument);
+	freeRegisters(registersCount);
+}
+
+void LuaCompiler::compileTable(const QSharedPointer<core::ast::Node> &tableConstructor, int target)
+{
+	addInstruction(OpCode::newTable, target);
+	for (const auto &initializer : as<ast::TableConstructor>(tableConstructor)->initializers()) {
+		if (initializer->implicitKey()) {
+			const int value = allocateRegisters(1);
+			compileNode(initializer->value(), value);
+			addInstruction(OpCode::append, target, value);
+			freeRegisters(1);
+		} else if (hasType(initializer->key(), TypeAssumption::number)) {
+			const int key = allocateRegisters(2);
+			compileNode(initializer->key(), key);
+			compileNode(initializer->value(), key + 1);
+			addInstruction(OpCode::setField, target, key, key + 1);
+			freeRegisters(2);
+		} else {
+			compileError(tableConstructor, QObject::tr("Explicit table indexes of non-integer type are not supported"));
+		}
+	}
+}
+
+void LuaCompiler::compileUnaryOperator(const QSharedPointer<core::ast::Node> &node, int target)
+{
+	const auto operand = as<ast::UnaryOperator>(node)->operand();
+
+	OpCode opCode;
+	if (node->is<ast::UnaryMinus>()) {
+		opCode = OpCode::unaryMinus;
+	} else if (node->is<ast::Not>()) {
+		opCode = OpCode::logicalNot;
+	} else if (node->is<ast::Length>() && hasType(operand, TypeAssumption::string)) {
+		/// @todo Support everything else.
+		opCode = OpCode::length;
+	} else if (node->is<ast::BitwiseNegation>()) {
+		opCode = OpCode::bitwiseNegation;
+	} else {
+		addInstruction(OpCode::loadNil, target);
+		return;
+	}
+
+	compileNode(operand, target);
+	addInstruction(opCode, target, target);
+}
+
+void LuaCompiler::compileBinaryOperator(const QSharedPointer<core::ast::Node> &node, int target)
+{
+	const auto leftOperand = as<ast::BinaryOperator>(node)->leftOperand();
+	const auto rightOperand = as<ast::BinaryOperator>(node)->rightOperand();
+
+	if (node->is<ast::LogicalAnd>() || node->is<ast::LogicalOr>()) {
+		// Right operand is not evaluated if result is known from the left one.
+		compileNode(leftOperand, target);
+		addInstruction(OpCode::toBoolean, target, target);
+		const int jump = addInstruction(node->is<ast::LogicalAnd>() ? OpCode::jumpIfFalse : OpCode::jumpIfTrue, target);
+		compileNode(rightOperand, target);
+		addInstruction(OpCode::toBoolean, target, target);
+		mBytecode->instructions[jump].b = mBytecode->instructions.size();
+		return;
+	}
+
+	OpCode opCode;
+	if (node->is<ast::Addition>()) {
+		opCode = OpCode::addition;
+	} else if (node->is<ast::Subtraction>()) {
+		opCode = OpCode::subtraction;
+	} else if (node->is<ast::Multiplication>()) {
+		opCode = OpCode::multiplication;
+	} else if (node->is<ast::Division>()) {
+		opCode = OpCode::division;
+	} else if (node->is<ast::IntegerDivision>()) {
+		opCode = OpCode::integerDivision;
+	} else if (node->is<ast::Exponentiation>()) {
+		opCode = OpCode::exponentiation;
+	} else if (node->is<ast::Modulo>()) {
+		opCode = OpCode::modulo;
+	} else if (node->is<ast::BitwiseAnd>()) {
+		opCode = OpCode::bitwiseAnd;
+	} else if (node->is<ast::BitwiseOr>()) {
+		opCode = OpCode::bitwiseOr;
+	} else if (node->is<ast::BitwiseXor>()) {
+		opCode = OpCode::bitwiseXor;
+	} else if (node->is<ast::BitwiseLeftShift>()) {
+		opCode = OpCode::bitwiseLeftShift;
+	} else if (node->is<ast::BitwiseRightShift>()) {
+		opCode = OpCode::bitwiseRightShift;
+	} else if (node->is<ast::Concatenation>()) {
+		opCode = OpCode::concatenation;
+	} else if (node->is<ast::LessThan>()) {
+		opCode = OpCode::lessThan;
+	} else if (node->is<ast::LessOrEqual>()) {
+		opCode = OpCode::lessOrEqual;
+	} else if (node->is<ast::GreaterThan>()) {
+		opCode = OpCode::greaterThan;
+	} else if (node->is<ast::GreaterOrEqual>()) {
+		opCode = OpCode::greaterOrEqual;
+	} else if (node->is<ast::Equality>()) {
+		opCode = OpCode::equality;
+	} else if (node->is<ast::Inequality>()) {
+		opCode = OpCode::inequality;
+	} else {
+		addInstruction(OpCode::loadNil, target);
+		return;
+	}
+
+	const int rightRegister = allocateRegisters(1);
+	compileNode(leftOperand, target);
+	compileNode(rightOperand, rightRegister);
+	const bool canFail = opCode == OpCode::division || opCode == OpCode::integerDivision || opCode == OpCode::modulo;
+	addInstruction(opCode, target, target, rightRegister, canFail ? addConnection(node) : -1);
+	freeRegisters(1);
+}
+
+void LuaCompiler::compileTableElement(const QSharedPointer<core::ast::Node> &indexingExpression
+		, const QSharedPointer<core::ast::Node> &value, int target)
+{
+	// Collecting nested indexing expressions, from the outermost to the innermost one, like "(a[1])[2]", "a[1]".
+	QList<QSharedPointer<ast::IndexingExpression>> levels{as<ast::IndexingExpression>(indexingExpression)};
+	while (levels.last()->table()->is<ast::IndexingExpression>()) {
+		levels << as<ast::IndexingExpression>(levels.last()->table());
+	}
+
+	// Assigned value is evaluated first and is followed by indexes, the first index belongs to the innermost level.
+	const bool isAssignment = !value.isNull();
+	const int registersCount = levels.size() + (isAssignment ? 1 : 0);
+	const int first = allocateRegisters(registersCount);
+	const int firstIndex = isAssignment ? first + 1 : first;
+	if (isAssignment) {
+		compileNode(value, first);
+	}
+
+	for (int i = 0; i < levels.size(); ++i) {
+		if (!hasType(levels[i]->indexer(), TypeAssumption::number)) {
+			compileError(levels[i], QObject::tr("Currently interpreter allows only tables denoted by identifier and "
+					"by integer expression index, as in 'a[1 + 2][3]'"));
+			if (!isAssignment) {
+				addInstruction(OpCode::loadNil, target);
+			}
+
+			freeRegisters(registersCount);
+			return;
+		}
+
+		compileNode(levels[i]->indexer(), firstIndex + levels.size() - 1 - i);
+	}
+
+	const auto table = levels.last()->table();
+	if (!table->is<ast::Identifier>()) {
+		/// @todo Support more complex cases of table slice, like
+		///       "f(x)['a'] = 1". Note that field access in form of "a.x = 1" is parsed as "a['x'] = 1", so
+		///       no special handling is needed for that case.
+		compileError(levels.last()
+				, QObject::tr("Tables denoted by something other than identifier (like f(x)[0]) are not allowed"));
+		if (!isAssignment) {
+			addInstruction(OpCode::loadNil, target);
+		}
+
+		freeRegisters(registersCount);
+		return;
+	}
+
+	const int slot = mInterpreter.variableSlot(as<ast::Identifier>(table)->name());
+	if (isAssignment) {
+		addInstruction(OpCode::setElement, first, slot, levels.size(), addConnection(levels.last()));
+	} else {
+		addInstruction(OpCode::getElement, first, slot, levels.size(), addConnection(levels.last()));
+		addInstruction(OpCode::move, target, first);
+	}
+
+	freeRegisters(registersCount);
+}
+
+void LuaCompiler::compileError(const QSharedPointer<core::ast::Node> &node, const QString &message)
+{
+	addInstruction(OpCode::error, 0, addConstant(message), 0, addConnection(node));
+}
+
+int LuaCompiler::addInstruction(OpCode opCode, int a, int b, int c, int connection)
+{
+	mBytecode->instructions << Instruction{opCode, a, b, c, connection};
+	return mBytecode->instructions.size() - 1;
+}
+
+int LuaCompiler::addConstant(const QVariant &value)
+{
+	mBytecode->constants << value;
+	return mBytecode->constants.size() - 1;
+}
+
+int LuaCompiler::addConnection(const QSharedPointer<core::ast::Node> &node)
+{
+	mBytecode->connections << node->start();
+	return mBytecode->connections.size() - 1;
+}
+
+int LuaCompiler::allocateRegisters(int count)
+{
+	const int first = mFreeRegister;
+	mFreeRegister += count;
+	mBytecode->registersCount = qMax(mBytecode->registersCount, mFreeRegister);
+	return first;
+}
+
+void LuaCompiler::freeRegisters(int count)
+{
+	mFreeRegister -= count;
+}
+
+bool LuaCompiler::hasType(const QSharedPointer<core::ast::Node> &expression, TypeAssumption::Type type)
+{
+	const bool result = checkType(expression, type, *mSemanticAnalyzer);
+	mBytecode->typeAssumptions << TypeAssumption{expression, type, result};
+	return result;
+}
+
+bool LuaCompiler::checkType(const QSharedPointer<core::ast::Node> &expression, TypeAssumption::Type type
+		, const core::SemanticAnalyzer &semanticAnalyzer)
+{
+	const auto expressionType = semanticAnalyzer.type(expression);
+	return type == TypeAssumption::number
+			? expressionType->is<types::Number>()
+			: expressionType->is<types::String>();
+}
@@ -0,0 +1,92 @@
+/* Copyright 2007-2015 QReal Research Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QSharedPointer>
+
+#include "qrtext/core/ast/node.h"
+#include "qrtext/core/semantics/semanticAnalyzer.h"
+
+#include "qrtext/src/lua/luaBytecode.h"
+
+namespace qrtext {
+namespace lua {
+namespace details {
+
+class LuaInterpreter;
+
+/// Compiles analyzed Lua AST into bytecode for LuaInterpreter. Identifiers and intrinsic functions are resolved into
+/// slots of given interpreter, literals are converted into values once and stored in constants pool. Runtime errors
+/// are compiled into code, so they are reported on each execution just as when AST is interpreted directly.
+class LuaCompiler
+{
+public:
+	/// Constructor.
+	/// @param interpreter - interpreter that will execute compiled code.
+	explicit LuaCompiler(LuaInterpreter &interpreter);
+
+	/// Compiles given AST using type information provided by given semantic analyzer.
+	QSharedPointer<LuaBytecode> compile(const QSharedPointer<core::ast::Node> &root
+			, const core::SemanticAnalyzer &semanticAnalyzer);
+
+	/// Returns true if types of expressions used during compilation of given bytecode are still the same, so it does
+	/// not need to be recompiled.
+	static bool isUpToDate(const LuaBytecode &bytecode, const core::SemanticAnalyzer &semanticAnalyzer);
+
+private:
+	/// Emits code that calculates a value of given node and puts it into given register.
+	void compileNode(const QSharedPointer<core::ast::Node> &node, int target);
+
+	void compileAssignment(const QSharedPointer<core::ast::Node> &assignment, int target);
+	void compileFunctionCall(const QSharedPointer<core::ast::Node> &functionCall, int target);
+	void compileTable(const QSharedPointer<core::ast::Node> &tableConstructor, int target);
+	void compileUnaryOperator(const QSharedPointer<core::ast::Node> &node, int target);
+	void compileBinaryOperator(const QSharedPointer<core::ast::Node> &node, int target);
+
+	/// Emits code for reading table element denoted by given indexing expression into target register (if value is
+	/// null) or for assigning given value to it.
+	void compileTableElement(const QSharedPointer<core::ast::Node> &indexingExpression
+			, const QSharedPointer<core::ast::Node> &value, int target);
+
+	/// Emits code that reports runtime error with given message at the start of given node.
+	void compileError(const QSharedPointer<core::ast::Node> &node, const QString &message);
+
+	int addInstruction(OpCode opCode, int a, int b = 0, int c = 0, int connection = -1);
+	int addConstant(const QVariant &value);
+	int addConnection(const QSharedPointer<core::ast::Node> &node);
+
+	/// Reserves given number of consecutive registers and returns the first of them.
+	int allocateRegisters(int count);
+
+	/// Releases given number of registers reserved last.
+	void freeRegisters(int count);
+
+	/// Checks type of an expression and remembers the result in type assumptions of bytecode.
+	bool hasType(const QSharedPointer<core::ast::Node> &expression, TypeAssumption::Type type);
+
+	static bool checkType(const QSharedPointer<core::ast::Node> &expression, TypeAssumption::Type type
+			, const core::SemanticAnalyzer &semanticAnalyzer);
+
+	LuaInterpreter &mInterpreter;
+	const core::SemanticAnalyzer *mSemanticAnalyzer = nullptr;
+	QSharedPointer<LuaBytecode> mBytecode;
+
+	/// First register that is not used by code being compiled.
+	int mFreeRegister = 0;
+};
+
+}
+}
+}
@@ -16,48 +16,7 @@
 
 #include <QtCore/QtMath>
 
-#include "qrtext/lua/types/string.h"
-#include "qrtext/lua/types/integer.h"
-
-#include "qrtext/lua/ast/assignment.h"
-#include "qrtext/lua/ast/floatNumber.h"
-#include "qrtext/lua/ast/functionCall.h"
-#include "qrtext/lua/ast/identifier.h"
-#include "qrtext/lua/ast/integerNumber.h"
-#include "qrtext/lua/ast/string.h"
-#include "qrtext/lua/ast/true.h"
-#include "qrtext/lua/ast/false.h"
-#include "qrtext/lua/ast/nil.h"
-#include "qrtext/lua/ast/tableConstructor.h"
-#include "qrtext/lua/ast/indexingExpression.h"
-#include "qrtext/lua/ast/block.h"
-
-#include "qrtext/lua/ast/unaryMinus.h"
-#include "qrtext/lua/ast/not.h"
-#include "qrtext/lua/ast/length.h"
-#include "qrtext/lua/ast/bitwiseNegation.h"
-
-#include "qrtext/lua/ast/addition.h"
-#include "qrtext/lua/ast/subtraction.h"
-#include "qrtext/lua/ast/multiplication.h"
-#include "qrtext/lua/ast/division.h"
-#include "qrtext/lua/ast/integerDivision.h"
-#include "qrtext/lua/ast/exponentiation.h"
-#include "qrtext/lua/ast/modulo.h"
-#include "qrtext/lua/ast/bitwiseAnd.h"
-#include "qrtext/lua/ast/bitwiseXor.h"
-#include "qrtext/lua/ast/bitwiseOr.h"
-#include "qrtext/lua/ast/bitwiseRightShift.h"
-#include "qrtext/lua/ast/bitwiseLeftShift.h"
-#include "qrtext/lua/ast/concatenation.h"
-#include "qrtext/lua/ast/lessThan.h"
-#include "qrtext/lua/ast/greaterThan.h"
-#include "qrtext/lua/ast/lessOrEqual.h"
-#include "qrtext/lua/ast/greaterOrEqual.h"
-#include "qrtext/lua/ast/equality.h"
-#include "qrtext/lua/ast/inequality.h"
-#include "qrtext/lua/ast/logicalAnd.h"
-#include "qrtext/lua/ast/logicalOr.h"
+#include "qrtext/src/lua/luaCompiler.h"
 
 using namespace qrtext::lua::details;
 using namespace qrtext;
@@ -70,87 +29,194 @@ LuaInterpreter::LuaInterpreter(QList<core::Error> &errors)
 QVariant LuaInterpreter::interpret(const QSharedPointer<core::ast::Node> &root
 		, const core::SemanticAnalyzer &semanticAnalyzer)
 {
-	Q_UNUSED(semanticAnalyzer);
+	return execute(*LuaCompiler(*this).compile(root, semanticAnalyzer));
+}
 
-	if (!root) {
-		return QVariant();
-	}
+QVariant LuaInterpreter::execute(const LuaBytecode &bytecode)
+{
+	QVector<QVariant> registers(bytecode.registersCount);
+	const auto connection = [&bytecode](const Instruction &instruction) {
+		return bytecode.connections[instruction.connection];
+	};
+
+	const auto index = [&registers](const Instruction &instruction, int first) {
+		QVector<int> result(instruction.c);
+		for (int i = 0; i < instruction.c; ++i) {
+			result[i] = registers[first + i].toInt();
+		}
+
+		return result;
+	};
+
+	int programCounter = 0;
+	while (programCounter < bytecode.instructions.size()) {
+		const Instruction &instruction = bytecode.instructions[programCounter];
+		++programCounter;
+
+		QVariant &a = registers[instruction.a];
+		switch (instruction.opCode) {
+		case OpCode::loadConstant:
+			a = bytecode.constants[instruction.b];
+			break;
+		case OpCode::loadNil:
+			a = QVariant();
+			break;
+		case OpCode::move:
+			a = registers[instruction.b];
+			break;
+		case OpCode::getVariable:
+			a = mVariableValues[instruction.b];
+			break;
+		case OpCode::setVariable:
+			if (mVariableReadOnly[instruction.b]) {
+				reportError(connection(instruction), QObject::tr("Variable %1 is read-only"));
+			} else {
+				mVariableValues[instruction.b] = a;
+				mVariableDefined[instruction.b] = true;
+			}
 
-	if (root->is<ast::Block>()) {
-		auto statements = as<ast::Block>(root)->children();
-		for (auto &&statement : statements) {
-			if (statement != statements.last()) {
-				interpret(statement, semanticAnalyzer);
+			break;
+		case OpCode::call: {
+			QList<QVariant> actualParameters;
+			for (int i = 0; i < instruction.c; ++i) {
+				actualParameters << registers[instruction.a + i];
 			}
+
+			a = mIntrinsicFunctions[instruction.b](actualParameters);
+			break;
+		}
+		case OpCode::getElement:
+			a = element(instruction.b, index(instruction, instruction.a), connection(instruction));
+			break;
+		case OpCode::setElement:
+			mVariableValues[instruction.b] = doAssignToTableElement(mVariableValues[instruction.b].value<QVariantList>()
+					, a, index(instruction, instruction.a + 1), connection(instruction));
+			mVariableDefined[instruction.b] = true;
+			break;
+		case OpCode::newTable:
+			a = QVariantList();
+			break;
+		case OpCode::append: {
+			// Register must not share the list while it is modified, otherwise every append copies the whole table.
+			QVariantList table = a.value<QVariantList>();
+			a = QVariant();
+			table << registers[instruction.b];
+			a = table;
+			break;
 		}
+		case OpCode::setField: {
+			QVariantList table = a.value<QVariantList>();
+			a = QVariant();
+			const int key = registers[instruction.b].toInt();
+			while (key >= table.size()) {
+				/// @todo: add proper "nil" value.
+				table.append("");
+			}
 
-		return !statements.isEmpty() ? interpret(statements.last(), semanticAnalyzer) : QVariant();
-	} else if (root->is<ast::IntegerNumber>()) {
-		/// @todo Integer and float literals may differ from those recognized in toInt() and toDouble().
-		bool ok = false;
-		return as<ast::IntegerNumber>(root)->stringRepresentation().toInt(&ok, 0);
-	} else if (root->is<ast::FloatNumber>()) {
-		return as<ast::FloatNumber>(root)->stringRepresentation().toDouble();
-	} else if (root->is<ast::String>()) {
-		return as<ast::String>(root)->string();
-	} else if (root->is<ast::TableConstructor>()) {
-		return constructTable(root, semanticAnalyzer);
-	} else if (root->is<ast::Assignment>()) {
-		auto variable = as<ast::Assignment>(root)->variable();
-		auto value = as<ast::Assignment>(root)->value();
-		auto interpretedValue = interpret(value, semanticAnalyzer);
-
-		if (variable->is<ast::Identifier>()) {
-			const auto name = as<ast::Identifier>(variable)->name();
-
-			if (mReadOnlyVariables.contains(name)) {
-				mErrors.append(core::Error(root->start(), QObject::tr("Variable %1 is read-only")
-						, core::ErrorType::runtimeError, core::Severity::error));
-
-				return QVariant();
+			table[key] = registers[instruction.c].value<QString>();
+			a = table;
+			break;
+		}
+		case OpCode::error:
+			reportError(connection(instruction), bytecode.constants[instruction.b].toString());
+			break;
+		case OpCode::toBoolean:
+			a = registers[instruction.b].toInt() != 0;
+			break;
+		case OpCode::jumpIfFalse:
+			if (!a.toBool()) {
+				programCounter = instruction.b;
 			}
 
-			mIdentifierValues.insert(name, interpretedValue);
-			return QVariant();
-		} else if (variable->is<ast::IndexingExpression>()) {
-			assignToTableElement(variable, interpretedValue, semanticAnalyzer);
-			return QVariant();
-		} else {
-			mErrors.append(core::Error(root->start(), QObject::tr("This construction is not supported by interpreter")
-					, core::ErrorType::runtimeError, core::Severity::error));
+			break;
+		case OpCode::jumpIfTrue:
+			if (a.toBool()) {
+				programCounter = instruction.b;
+			}
+
+			break;
+		case OpCode::unaryMinus:
+			a = -registers[instruction.b].toFloat();
+			break;
+		case OpCode::logicalNot:
+			/// @todo Code 'nil' more adequately.
+			a = registers[instruction.b].isNull() ? true : !registers[instruction.b].toBool();
+			break;
+		case OpCode::length:
+			/// @todo Well, in Lua '#' returns bytes in a string, not symbols.
+			a = registers[instruction.b].toString().length();
+			break;
+		case OpCode::bitwiseNegation:
+			a = ~registers[instruction.b].toInt();
+			break;
+		default:
+			a = calculate(instruction, registers[instruction.b], registers[instruction.c], bytecode);
+			break;
 		}
+	}
 
-		return QVariant();
+	return registers.first();
+}
 
-	} else if (root->is<ast::Identifier>()) {
-		return mIdentifierValues.value(as<ast::Identifier>(root)->name());
-	} else if (root->is<ast::FunctionCall>()) {
-		auto function = as<ast::FunctionCall>(root)->function();
-		auto name = as<ast::Identifier>(function)->name();
-		auto parameters = as<ast::FunctionCall>(root)->arguments();
+QVariant LuaInterpreter::calculate(const Instruction &instruction, const QVariant &left, const QVariant &right
+		, const LuaBytecode &bytecode)
+{
+	switch (instruction.opCode) {
+	case OpCode::addition:
+		return left.toDouble() + right.toDouble();
+	case OpCode::subtraction:
+		return left.toDouble() - right.toDouble();
+	case OpCode::multiplication:
+		return left.toDouble() * right.toDouble();
+	case OpCode::division:
+		if (right.toDouble() != 0) {
+			return left.toDouble() / right.toDouble();
+		}
 
-		QList<QVariant> actualParameters;
-		for (auto &&parameter : parameters) {
-			actualParameters << interpret(parameter, semanticAnalyzer);
+		reportError(bytecode.connections[instruction.connection], QObject::tr("Division by zero"));
+		return 0;
+	case OpCode::integerDivision:
+		if (right.toInt() != 0) {
+			return left.toInt() / right.toInt();
 		}
 
-		return mIntrinsicFunctions[name](actualParameters);
-	} else if (root->is<ast::IndexingExpression>()) {
-		return slice(root, semanticAnalyzer);
-	} else if (root->is<ast::UnaryOperator>()) {
-		return interpretUnaryOperator(root, semanticAnalyzer);
-	} else if (root->is<ast::BinaryOperator>()) {
-		return interpretBinaryOperator(root, semanticAnalyzer);
-	} else if (root->is<ast::True>()) {
-		return true;
-	} else if (root->is<ast::False>()) {
-		return false;
-	} else if (root->is<ast::Nil>()) {
-		return QVariant();
-	} else {
-		mErrors.append(core::Error(root->start(), QObject::tr("This construction is not supported by interpreter")
-				, core::ErrorType::runtimeError, core::Severity::error));
+		reportError(bytecode.connections[instruction.connection], QObject::tr("Division by zero"));
+		return 0;
+	case OpCode::modulo:
+		if (right.toInt() != 0) {
+			return left.toInt() % right.toInt();
+		}
 
+		reportError(bytecode.connections[instruction.connection], QObject::tr("Division by zero"));
+		return 0;
+	case OpCode::exponentiation:
+		return qPow(left.toDouble(), right.toDouble());
+	case OpCode::bitwiseAnd:
+		return left.toInt() & right.toInt();
+	case OpCode::bitwiseOr:
+		return left.toInt() | right.toInt();
+	case OpCode::bitwiseXor:
+		return left.toInt() ^ right.toInt();
+	case OpCode::bitwiseLeftShift:
+		return left.toInt() << right.toInt();
+	case OpCode::bitwiseRightShift:
+		return left.toInt() >> right.toInt();
+	case OpCode::concatenation:
+		return left.toString() + right.toString();
+	/// @todo String comparison.
+	case OpCode::lessThan:
+		return left.toDouble() < right.toDouble();
+	case OpCode::lessOrEqual:
+		return left.toDouble() <= right.toDouble();
+	case OpCode::greaterThan:
+		return left.toDouble() > right.toDouble();
+	case OpCode::greaterOrEqual:
+		return left.toDouble() >= right.toDouble();
+	case OpCode::equality:
+		return left == right;
+	case OpCode::inequality:
+		return left != right;
+	default:
 		return QVariant();
 	}
 }
@@ -158,26 +224,32 @@ QVariant LuaInterpreter::interpret(const QSharedPointer<core::ast::Node> &root
 void LuaInterpreter::addIntrinsicFunction(const QString &name
 		, std::function<QVariant(const QList<QVariant> &)> const &semantic)
 {
-	mIntrinsicFunctions.insert(name, semantic);
+	mIntrinsicFunctions[intrinsicFunctionIndex(name)] = semantic;
 }
 
 bool LuaInterpreter::hasIdentifier(const QString &name) const
 {
-	return mIdentifierValues.contains(name);
+	return mVariableSlots.contains(name) && mVariableDefined[mVariableSlots[name]];
 }
 
 void LuaInterpreter::forgetIdentifier(const QString &identifier)
 {
-	mIdentifierValues.remove(identifier);
+	if (mVariableSlots.contains(identifier)) {
+		mVariableValues[mVariableSlots[identifier]] = QVariant();
+		mVariableDefined[mVariableSlots[identifier]] = false;
+	}
 }
 
 QVariant LuaInterpreter::value(const QString &identifier) const
 {
-	return mIdentifierValues.value(identifier);
+	return mVariableSlots.contains(identifier) ? mVariableValues[mVariableSlots[identifier]] : QVariant();
 }
 
 void LuaInterpreter::setVariableValue(const QString &name, const QVariant &value)
 {
+	const int slot = variableSlot(name);
+	mVariableDefined[slot] = true;
+
 	QString valueString = value.toString();
 	if (!valueString.isEmpty()
 			&& (valueString[0] == '\'' || valueString[0] == '\"')
@@ -187,249 +259,77 @@ void LuaInterpreter::setVariableValue(const QString &name, const QVariant &value
 		// It is a string variable, chop off quotes.
 		valueString.remove(0, 1);
 		valueString.chop(1);
-		mIdentifierValues.insert(name, valueString);
+		mVariableValues[slot] = valueString;
 	} else {
-		mIdentifierValues.insert(name, value);
+		mVariableValues[slot] = value;
 	}
 }
 
 void LuaInterpreter::addReadOnlyVariable(const QString &name)
 {
-	mReadOnlyVariables.insert(name);
+	mVariableReadOnly[variableSlot(name)] = true;
 }
 
 void LuaInterpreter::clear()
 {
-	mIdentifierValues.clear();
-	mReadOnlyVariables.clear();
+	mVariableValues.fill(QVariant());
+	mVariableDefined.fill(false);
+	mVariableReadOnly.fill(false);
 }
 
-QVariant LuaInterpreter::interpretUnaryOperator(const QSharedPointer<core::ast::Node> &root
-		, const core::SemanticAnalyzer &semanticAnalyzer)
+int LuaInterpreter::variableSlot(const QString &name)
 {
-	auto operand = as<ast::UnaryOperator>(root)->operand();
-	if (root->is<ast::UnaryMinus>()) {
-		return -interpret(operand, semanticAnalyzer).toFloat();
-	} else if (root->is<ast::Not>()) {
-		const QVariant operandResult = interpret(operand, semanticAnalyzer);
-		/// @todo Code 'nil' more adequately.
-		if (operandResult.isNull()) {
-			return true;
-		}
-
-		return !operandResult.toBool();
-	} else if (root->is<ast::Length>()) {
-		if (semanticAnalyzer.type(operand)->is<types::String>()) {
-			/// @todo Well, in Lua '#' returns bytes in a string, not symbols.
-			return interpret(operand, semanticAnalyzer).toString().length();
-		}
-		/// @todo Support everything else.
-	} else if (root->is<ast::BitwiseNegation>()) {
-		return ~(interpret(operand, semanticAnalyzer).toInt());
+	if (!mVariableSlots.contains(name)) {
+		mVariableSlots.insert(name, mVariableValues.size());
+		mVariableValues << QVariant();
+		mVariableDefined << false;
+		mVariableReadOnly << false;
 	}
 
-	return QVariant();
+	return mVariableSlots[name];
 }
 
-QVariant LuaInterpreter::interpretBinaryOperator(const QSharedPointer<core::ast::Node> &root
-		, const core::SemanticAnalyzer &semanticAnalyzer)
+int LuaInterpreter::intrinsicFunctionIndex(const QString &name)
 {
-	auto leftOperand = as<ast::BinaryOperator>(root)->leftOperand();
-	auto rightOperand = as<ast::BinaryOperator>(root)->rightOperand();
-
-	if (root->is<ast::Addition>()) {
-		return interpret(leftOperand, semanticAnalyzer).toDouble()
-				+ interpret(rightOperand, semanticAnalyzer).toDouble();
-	} else if (root->is<ast::Subtraction>()) {
-		return interpret(leftOperand, semanticAnalyzer).toDouble()
-				- interpret(rightOperand, semanticAnalyzer).toDouble();
-	} else if (root->is<ast::Multiplication>()) {
-		QVariant leftOperandValue = interpret(leftOperand, semanticAnalyzer);
-		return leftOperandValue.toDouble()
-				* interpret(rightOperand, semanticAnalyzer).toDouble();
-	} else if (root->is<ast::Division>()) {
-		const auto leftOperandValue = interpret(leftOperand, semanticAnalyzer).toDouble();
-		const auto rightOperandValue = interpret(rightOperand, semanticAnalyzer).toDouble();
-		if (rightOperandValue != 0) {
-			return leftOperandValue / rightOperandValue;
-		} else {
-			mErrors.append(core::Error(root->start(), QObject::tr("Division by zero")
-					, core::ErrorType::runtimeError, core::Severity::error));
-			return 0;
-		}
-	} else if (root->is<ast::IntegerDivision>()) {
-		const auto leftOperandValue = interpret(leftOperand, semanticAnalyzer).toInt();
-		const auto rightOperandValue = interpret(rightOperand, semanticAnalyzer).toInt();
-		if (rightOperandValue != 0) {
-			return leftOperandValue / rightOperandValue;
-		} else {
-			mErrors.append(core::Error(root->start(), QObject::tr("Division by zero")
-					, core::ErrorType::runtimeError, core::Severity::error));
-			return 0;
-		}
-	} else if (root->is<ast::Exponentiation>()) {
-		return qPow(interpret(leftOperand, semanticAnalyzer).toDouble()
-				, interpret(rightOperand, semanticAnalyzer).toDouble());
-	} else if (root->is<ast::Modulo>()) {
-		const auto leftOperandValue = interpret(leftOperand, semanticAnalyzer).toInt();
-		const auto rightOperandValue = interpret(rightOperand, semanticAnalyzer).toInt();
-		if (rightOperandValue != 0) {
-			return leftOperandValue % rightOperandValue;
-		} else {
-			mErrors.append(core::Error(root->start(), QObject::tr("Division by zero")
-					, core::ErrorType::runtimeError, core::Severity::error));
-			return 0;
-		}
-	} else if (root->is<ast::BitwiseAnd>()) {
-		return interpret(leftOperand, semanticAnalyzer).toInt()
-				& interpret(rightOperand, semanticAnalyzer).toInt();
-	} else if (root->is<ast::BitwiseOr>()) {
-		return interpret(leftOperand, semanticAnalyzer).toInt()
-				| interpret(rightOperand, semanticAnalyzer).toInt();
-	} else if (root->is<ast::BitwiseXor>()) {
-		return interpret(leftOperand, semanticAnalyzer).toInt()
-				^ interpret(rightOperand, semanticAnalyzer).toInt();
-	} else if (root->is<ast::BitwiseLeftShift>()) {
-		return interpret(leftOperand, semanticAnalyzer).toInt()
-				<< interpret(rightOperand, semanticAnalyzer).toInt();
-	} else if (root->is<ast::BitwiseRightShift>()) {
-		return interpret(leftOperand, semanticAnalyzer).toInt()
-				>> interpret(rightOperand, semanticAnalyzer).toInt();
-
-	} else if (root->is<ast::Concatenation>()) {
-		return interpret(leftOperand, semanticAnalyzer).toString()
-				+ interpret(rightOperand, semanticAnalyzer).toString();
-
-	/// @todo String comparison.
-	} else if (root->is<ast::LessThan>()) {
-		return interpret(leftOperand, semanticAnalyzer).toDouble()
-				< interpret(rightOperand, semanticAnalyzer).toDouble();
-	} else if (root->is<ast::LessOrEqual>()) {
-		return interpret(leftOperand, semanticAnalyzer).toDouble()
-				<= interpret(rightOperand, semanticAnalyzer).toDouble();
-	} else if (root->is<ast::GreaterThan>()) {
-		return interpret(leftOperand, semanticAnalyzer).toDouble()
-				> interpret(rightOperand, semanticAnalyzer).toDouble();
-	} else if (root->is<ast::GreaterOrEqual>()) {
-		return interpret(leftOperand, semanticAnalyzer).toDouble()
-				>= interpret(rightOperand, semanticAnalyzer).toDouble();
-	} else if (root->is<ast::Equality>()) {
-		return interpret(leftOperand, semanticAnalyzer) == interpret(rightOperand, semanticAnalyzer);
-	} else if (root->is<ast::Inequality>()) {
-		return interpret(leftOperand, semanticAnalyzer) != interpret(rightOperand, semanticAnalyzer);
-	} else if (root->is<ast::LogicalAnd>()) {
-		return interpret(leftOperand, semanticAnalyzer).toInt()
-				&& interpret(rightOperand, semanticAnalyzer).toInt();
-	} else if (root->is<ast::LogicalOr>()) {
-		return interpret(leftOperand, semanticAnalyzer).toInt()
-				|| interpret(rightOperand, semanticAnalyzer).toInt();
+	if (!mIntrinsicFunctionIndices.contains(name)) {
+		mIntrinsicFunctionIndices.insert(name, mIntrinsicFunctions.size());
+		mIntrinsicFunctions << std::function<QVariant(const QList<QVariant> &)>();
 	}
 
-	return QVariant();
-}
-
-
-QVariant LuaInterpreter::operateOnIndexingExpression(const QSharedPointer<core::ast::Node> &indexingExpression
-		, const core::SemanticAnalyzer &semanticAnalyzer
-		, const std::function<QVariant(const QString &
-				, const QVariantList &
-				, const QVector<int> &
-				, const core::Connection &)> &action)
-{
-	return operateOnIndexingExpressionRecursive(indexingExpression, {}, semanticAnalyzer, action);
+	return mIntrinsicFunctionIndices[name];
 }
 
-QVariant LuaInterpreter::operateOnIndexingExpressionRecursive(const QSharedPointer<core::ast::Node> &indexingExpression
-		, const QVector<int> &currentIndex, const core::SemanticAnalyzer &semanticAnalyzer
-		, const std::function<QVariant(const QString &
-				, const QVariantList &
-				, const QVector<int> &
-				, const core::Connection &)> &action)
+QVariant LuaInterpreter::element(int slot, const QVector<int> &index, const core::Connection &connection)
 {
-	const auto node = as<ast::IndexingExpression>(indexingExpression);
-
-	const auto reportError = [this, &node](){
-		mErrors.append(core::Error(node->start()
-				, QObject::tr("Currently interpreter allows only tables denoted by identifier and "
-						"by integer expression index, as in 'a[1 + 2][3]'")
-				, core::ErrorType::runtimeError, core::Severity::error));
-	};
+	QVariantList slice = mVariableValues[slot].value<QVariantList>();
 
-	if (node->table()->is<ast::Identifier>()) {
-		const auto name = as<ast::Identifier>(node->table())->name();
-		if (semanticAnalyzer.type(node->indexer())->is<types::Number>()) {
-			const auto index = interpret(node->indexer(), semanticAnalyzer).toInt();
-			const auto table = mIdentifierValues.value(name).value<QVariantList>();
+	QVector<int> actualIndex = index;
+	const int lastIndex = index.last();
+	actualIndex.removeLast();
 
-			return action(name, table, QVector<int>{index} + currentIndex, node->start());
+	for (int i : actualIndex) {
+		if (slice.size() <= i) {
+			return QVariant();
 		}
 
-		reportError();
-		return QVariant();
-	} else if (node->table()->is<ast::IndexingExpression>()) {
-		if (semanticAnalyzer.type(node->indexer())->is<types::Number>()) {
-			const auto index = interpret(node->indexer(), semanticAnalyzer).toInt();
-			return operateOnIndexingExpressionRecursive(node->table()
-					, QVector<int>{index} + currentIndex, semanticAnalyzer, action);
+		if (i < 0) {
+			reportError(connection, QObject::tr("Negative index for a table"));
+			return QVariant();
 		}
 
-		reportError();
-		return QVariant();
+		slice = slice[i].value<QVariantList>();
 	}
 
-	/// @todo Support more complex cases of table slice, like
-	///       "f(x)['a'] = 1". Note that field access in form of "a.x = 1" is parsed as "a['x'] = 1", so
-	///       no special handling is needed for that case.
-	mErrors.append(core::Error(node->start()
-			, QObject::tr("Tables denoted by something other than identifier (like f(x)[0]) are not allowed")
-			, core::ErrorType::runtimeError, core::Severity::error));
-
-	return QVariant();
-}
-
-QVariant LuaInterpreter::constructTable(const QSharedPointer<core::ast::Node> &tableConstructor
-		, const core::SemanticAnalyzer &semanticAnalyzer)
-{
-	QVariantList temp;
-	for (const auto &node : as<ast::TableConstructor>(tableConstructor)->initializers()) {
-		if (node->implicitKey()) {
-			temp << interpret(node->value(), semanticAnalyzer);
-		} else {
-			if (semanticAnalyzer.type(node->key())->is<types::Number>()) {
-				const auto index = interpret(node->key(), semanticAnalyzer).toInt();
-				if (temp.size() <= index) {
-					for (int i = 0; index >= temp.size(); ++i) {
-						/// @todo: add proper "nil" value.
-						temp.append("");
-					}
-				}
-
-				temp[index] = interpret(node->value(), semanticAnalyzer).value<QString>();
-			} else {
-				mErrors.append(core::Error(tableConstructor->start()
-						, QObject::tr("Explicit table indexes of non-integer type are not supported")
-						, core::ErrorType::runtimeError, core::Severity::error));
-			}
-		}
+	if (slice.size() <= lastIndex) {
+		return QVariant();
 	}
 
-	return QVariant(temp);
-}
-
-void LuaInterpreter::assignToTableElement(const QSharedPointer<core::ast::Node> &variable
-		, const QVariant &interpretedValue, const core::SemanticAnalyzer &semanticAnalyzer)
-{
-	const auto action = [this, &interpretedValue] (
-			const QString &name
-			, const QVariantList &table
-			, const QVector<int> &index
-			, const core::Connection &connection)
-	{
-		mIdentifierValues.insert(name, doAssignToTableElement(table, interpretedValue, index, connection));
+	if (lastIndex < 0) {
+		reportError(connection, QObject::tr("Negative index for a table"));
 		return QVariant();
-	};
+	}
 
-	operateOnIndexingExpression(variable, semanticAnalyzer, action);
+	return slice[lastIndex];
 }
 
 QVariantList LuaInterpreter::doAssignToTableElement(const QVariantList &table
@@ -441,9 +341,7 @@ QVariantList LuaInterpreter::doAssignToTableElement(const QVariantList &table
 	int i = 0;
 	const int currentIndex = index.first();
 	if (currentIndex < 0) {
-		mErrors.append(core::Error(connection
-				, QObject::tr("Negative index for a table")
-				, core::ErrorType::runtimeError, core::Severity::error));
+		reportError(connection, QObject::tr("Negative index for a table"));
 		return table;
 	}
 
@@ -458,9 +356,7 @@ QVariantList LuaInterpreter::doAssignToTableElement(const QVariantList &table
 		if (currentIndex >= 0) {
 			result[currentIndex] = value;
 		} else {
-			mErrors.append(core::Error(connection
-					, QObject::tr("Negative index for a table")
-					, core::ErrorType::runtimeError, core::Severity::error));
+			reportError(connection, QObject::tr("Negative index for a table"));
 		}
 
 		return result;
@@ -490,50 +386,7 @@ QVariantList LuaInterpreter::doAssignToTableElement(const QVariantList &table
 	return result;
 }
 
-QVariant LuaInterpreter::slice(const QSharedPointer<core::ast::Node> &indexingExpression
-		, const core::SemanticAnalyzer &semanticAnalyzer)
+void LuaInterpreter::reportError(const core::Connection &connection, const QString &message)
 {
-	const auto action = [this] (const QString &name
-			, const QVariantList &table
-			, const QVector<int> &index
-			, const core::Connection &connection)
-	{
-		Q_UNUSED(name);
-
-		QVariantList slice = table;
-
-		QVector<int> actualIndex = index;
-		const int lastIndex = index.last();
-		actualIndex.removeLast();
-
-		for (int i : actualIndex) {
-			if (slice.size() <= i) {
-				return QVariant();
-			}
-
-			if (i < 0) {
-				mErrors.append(core::Error(connection
-						, QObject::tr("Negative index for a table")
-						, core::ErrorType::runtimeError, core::Severity::error));
-				return QVariant();
-			}
-
-			slice = slice[i].value<QVariantList>();
-		}
-
-		if (slice.size() <= lastIndex) {
-			return QVariant();
-		}
-
-		if (lastIndex < 0) {
-			mErrors.append(core::Error(connection
-					, QObject::tr("Negative index for a table")
-					, core::ErrorType::runtimeError, core::Severity::error));
-			return QVariant();
-		}
-
-		return slice[lastIndex];
-	};
-
-	return operateOnIndexingExpression(indexingExpression, semanticAnalyzer, action);
+	mErrors.append(core::Error(connection, message, core::ErrorType::runtimeError, core::Severity::error));
 }
@@ -16,6 +16,7 @@
 
 #include <functional>
 #include <QtCore/QHash>
+#include <QtCore/QVector>
 #include <QtCore/QVariantList>
 
 #include "qrtext/core/error.h"
@@ -25,11 +26,14 @@
 
 #include "qrtext/lua/types/function.h"
 
+#include "qrtext/src/lua/luaBytecode.h"
+
 namespace qrtext {
 namespace lua {
 namespace details {
 
-/// Interpreter of AST for Lua language.
+/// Interpreter for Lua language. Executes bytecode produced by LuaCompiler on a register-based virtual machine.
+/// Keeps values of variables in slots, names of variables are resolved into slots during compilation.
 class LuaInterpreter
 {
 public:
@@ -44,11 +48,14 @@ public:
 	void addIntrinsicFunction(const QString &name
 			, std::function<QVariant(const QList<QVariant> &)> const &semantic);
 
-	/// Interprets given AST using type information provided by given semantic analyzer, returns the result of
-	/// calculation or QVariant() if there is no result (error or AST is not supposed to return anything).
-	/// @todo Remove direct reference to semanticAnalyzer.
+	/// Compiles and interprets given AST using type information provided by given semantic analyzer, returns
+	/// the result of calculation or QVariant() if there is no result (error or AST is not supposed to return anything).
+	/// Use LuaCompiler and execute() directly to interpret the same AST many times.
 	QVariant interpret(const QSharedPointer<core::ast::Node> &root, const core::SemanticAnalyzer &semanticAnalyzer);
 
+	/// Executes given compiled code, returns the result of calculation or QVariant() if there is no result.
+	QVariant execute(const LuaBytecode &bytecode);
+
 	/// Check if the identifier is known to interpreter
 	bool hasIdentifier(const QString &name) const;
 
@@ -67,47 +74,41 @@ public:
 	/// Clear all execution state, except added intrinsic functions.
 	void clear();
 
-private:
-	QVariant interpretUnaryOperator(const QSharedPointer<core::ast::Node> &root
-			, const core::SemanticAnalyzer &semanticAnalyzer);
-
-	QVariant interpretBinaryOperator(const QSharedPointer<core::ast::Node> &root
-			, const core::SemanticAnalyzer &semanticAnalyzer);
+	/// Returns a slot for the value of variable with given name, allocating it if needed. Slots are never freed, so
+	/// compiled code remains valid after clear().
+	int variableSlot(const QString &name);
 
-	QVariant operateOnIndexingExpression(const QSharedPointer<core::ast::Node> &indexingExpression
-			, const core::SemanticAnalyzer &semanticAnalyzer
-			, const std::function<QVariant(const QString &
-					, const QVariantList &
-					, const QVector<int> &
-					, const core::Connection &)> &action);
+	/// Returns an index of intrinsic function with given name. Function may be registered later, the index stays
+	/// the same.
+	int intrinsicFunctionIndex(const QString &name);
 
-	QVariant constructTable(const QSharedPointer<core::ast::Node> &tableConstructor
-			, const core::SemanticAnalyzer &semanticAnalyzer);
+private:
+	/// Returns the result of binary operation described by given instruction.
+	QVariant calculate(const Instruction &instruction, const QVariant &left, const QVariant &right
+			, const LuaBytecode &bytecode);
 
-	void assignToTableElement(const QSharedPointer<core::ast::Node> &variable, const QVariant &interpretedValue
-			, const core::SemanticAnalyzer &semanticAnalyzer);
+	/// Returns element of table stored in given slot denoted by given list of indexes.
+	QVariant element(int slot, const QVector<int> &index, const core::Connection &connection);
 
 	QVariantList doAssignToTableElement(const QVariantList &table
 			, const QVariant &value
 			, const QVector<int> &index
 			, const core::Connection &connection);
 
-	QVariant slice(const QSharedPointer<core::ast::Node> &indexingExpression
-			, const core::SemanticAnalyzer &semanticAnalyzer);
+	void reportError(const core::Connection &connection, const QString &message);
+
+	QHash<QString, int> mVariableSlots;
+	QVector<QVariant> mVariableValues;
 
-	QVariant operateOnIndexingExpressionRecursive(const QSharedPointer<core::ast::Node> &indexingExpression
-			, const QVector<int> &currentIndex, const core::SemanticAnalyzer &semanticAnalyzer
-			, const std::function<QVariant(const QString &
-					, const QVariantList &
-					, const QVector<int> &
-					, const core::Connection &)> &action);
+	/// True for slots containing a value of some identifier, identifiers without value are unknown to interpreter.
+	QVector<bool> mVariableDefined;
 
-	QHash<QString, QVariant> mIdentifierValues;
-	QHash<QString, std::function<QVariant(const QList<QVariant> &)>> mIntrinsicFunctions;
+	/// True for slots of variables which can be modified only by setVariableValue() call (used to support sensor
+	/// variables and ailases)
+	QVector<bool> mVariableReadOnly;
 
-	/// A set of variables which can be modified only by setVariableValue() call (used to support sensor variables and
-	/// ailases)
-	QSet<QString> mReadOnlyVariables;
+	QHash<QString, int> mIntrinsicFunctionIndices;
+	QVector<std::function<QVariant(const QList<QVariant> &)>> mIntrinsicFunctions;
 
 	QList<core::Error> &mErrors;
 };
@@ -18,8 +18,8 @@ using namespace qrtext::lua;
 using namespace qrtext::lua::details;
 using namespace qrtext::core;
 
-LuaLexer::LuaLexer(QList<core::Error> &errors)
-	: Lexer<LuaTokenTypes>(initPatterns(), errors)
+LuaLexer::LuaLexer(QList<core::Error> &errors, bool useAutomaton)
+	: Lexer<LuaTokenTypes>(initPatterns(), errors, useAutomaton)
 {
 }
 
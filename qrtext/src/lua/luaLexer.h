@@ -23,7 +23,8 @@ namespace qrtext {
 namespace lua {
 namespace details {
 
-/// Lexer of something like Lua 5.3 based on regular expressions. Provides a list of tokens by given input string.
+/// Lexer of something like Lua 5.3 based on regular expressions compiled into automaton. Provides a list of tokens
+/// by given input string.
 /// Allows Unicode input.
 ///
 /// Now lexer (with default token patterns) follows Lua 5.3 specification with following exceptions:
@@ -33,7 +34,8 @@ class LuaLexer: public core::Lexer<LuaTokenTypes>
 public:
 	/// Constructor.
 	/// @param errors - error stream to report errors to.
-	LuaLexer(QList<core::Error> &errors);
+	/// @param useAutomaton - if false, token regexps are matched one by one (which is much slower).
+	LuaLexer(QList<core::Error> &errors, bool useAutomaton = true);
 
 private:
 	static core::TokenPatterns<LuaTokenTypes> initPatterns();
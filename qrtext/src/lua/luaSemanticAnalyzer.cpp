@@ -85,16 +85,19 @@ LuaSemanticAnalyzer::LuaSemanticAnalyzer(QList<Error> &errors)
 void LuaSemanticAnalyzer::addIntrinsicFunction(const QString &name, const QSharedPointer<types::Function> &type)
 {
 	mIntrinsicFunctions.insert(name, type);
+	identifierChanged(name);
 }
 
 void LuaSemanticAnalyzer::addReadOnlyVariable(const QString &name)
 {
 	mReadOnlyVariables.insert(name);
+	identifierChanged(name);
 }
 
 void LuaSemanticAnalyzer::removeReadOnlyVariable(const QString &name)
 {
 	mReadOnlyVariables.remove(name);
+	identifierChanged(name);
 }
 
 void LuaSemanticAnalyzer::precheck(QSharedPointer<ast::Node> const &node)
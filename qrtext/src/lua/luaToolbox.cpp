@@ -20,6 +20,9 @@
 #include "qrtext/src/lua/luaParser.h"
 #include "qrtext/src/lua/luaSemanticAnalyzer.h"
 #include "qrtext/src/lua/luaInterpreter.h"
+#include "qrtext/src/lua/luaCompiler.h"
+
+#include "qrtext/lua/ast/identifier.h"
 
 using namespace qrtext::lua;
 using namespace qrtext::core;
@@ -30,6 +33,7 @@ LuaToolbox::LuaToolbox()
 	, mParser(new details::LuaParser(mErrors))
 	, mAnalyzer(new details::LuaSemanticAnalyzer(mErrors))
 	, mInterpreter(new details::LuaInterpreter(mErrors))
+	, mCompiler(new details::LuaCompiler(*mInterpreter))
 {
 }
 
@@ -37,7 +41,14 @@ LuaToolbox::~LuaToolbox() = default;
 
 QVariant LuaToolbox::interpret(QSharedPointer<Node> const &root)
 {
-	const auto result = mInterpreter->interpret(root, *mAnalyzer);
+	QSharedPointer<details::LuaBytecode> &bytecode = mBytecode[root];
+	if (!bytecode || !details::LuaCompiler::isUpToDate(*bytecode, *mAnalyzer)) {
+		bytecode = mCompiler->compile(root, *mAnalyzer);
+	}
+
+	// Bytecode is held by a copy of a pointer since intrinsic functions may interpret other code and modify the cache.
+	const QSharedPointer<details::LuaBytecode> code = bytecode;
+	const auto result = mInterpreter->execute(*code);
 	reportErrors();
 	return result;
 }
@@ -66,20 +77,27 @@ QSharedPointer<Node> const &LuaToolbox::parse(const qReal::Id &id, const QString
 
 		if (mErrors.isEmpty()) {
 			mAnalyzer->forget(mAstRoots[id][propertyName]);
+			mBytecode.remove(mAstRoots[id][propertyName]);
 			mAstRoots[id][propertyName] = ast;
 		}
 
 		mParsedCache[id][propertyName] = code;
+		mAnalysisStates[id].remove(propertyName);
 	} else {
 		ast = mAstRoots[id][propertyName];
 	}
 
-	if (mErrors.isEmpty()) {
+	if (mErrors.isEmpty() && !isAnalyzed(id, propertyName)) {
 		mAnalyzer->analyze(ast);
+		++mAnalysesCount;
+		if (mErrors.isEmpty()) {
+			rememberAnalysis(id, propertyName, ast);
+		}
 	}
 
 	if (!mErrors.isEmpty()) {
 		mParsedCache[id].remove(propertyName);
+		mAnalysisStates[id].remove(propertyName);
 		reportErrors();
 	}
 
@@ -126,6 +144,16 @@ QStringList LuaToolbox::identifiers() const
 	return mAnalyzer->identifiers();
 }
 
+bool LuaToolbox::isReferenced(const QString &identifier) const
+{
+	return mReferencedIdentifiers.contains(identifier);
+}
+
+int LuaToolbox::analysesCount() const
+{
+	return mAnalysesCount;
+}
+
 QMap<QString, QSharedPointer<qrtext::core::types::TypeExpression>> LuaToolbox::variableTypes() const
 {
 	return mAnalyzer->variableTypes();
@@ -173,8 +201,14 @@ QVariant LuaToolbox::value(const QString &identifier) const
 void LuaToolbox::setVariableValue(const QString &name, const QString &initCode, const QVariant &value)
 {
 	if (!mInterpreter->hasIdentifier(name)) {
+		// Initialization code is not a use of the variable by some program.
+		const bool referenced = mReferencedIdentifiers.contains(name);
 		parse(qReal::Id(), "", initCode);
+		if (!referenced) {
+			mReferencedIdentifiers.remove(name);
+		}
 	}
+
 	mInterpreter->setVariableValue(name, value);
 }
 
@@ -182,8 +216,11 @@ void LuaToolbox::clear()
 {
 	mAnalyzer->clear();
 	mInterpreter->clear();
+	mBytecode.clear();
+	mAnalysisStates.clear();
 	mSpecialConstants.clear();
 	mSpecialIdentifiers.clear();
+	mReferencedIdentifiers.clear();
 }
 
 bool LuaToolbox::isGeneralization(const QSharedPointer<qrtext::core::types::TypeExpression> &specific
@@ -192,6 +229,58 @@ bool LuaToolbox::isGeneralization(const QSharedPointer<qrtext::core::types::Type
 	return mAnalyzer->isGeneralization(specific, general);
 }
 
+bool LuaToolbox::isAnalyzed(const qReal::Id &id, const QString &propertyName) const
+{
+	const auto idStates = mAnalysisStates.constFind(id);
+	if (idStates == mAnalysisStates.constEnd()) {
+		return false;
+	}
+
+	const auto state = idStates->constFind(propertyName);
+	if (state == idStates->constEnd() || state->analyzerVersion != mAnalyzer->version()) {
+		return false;
+	}
+
+	for (auto it = state->identifierVersions.cbegin(); it != state->identifierVersions.cend(); ++it) {
+		if (mAnalyzer->identifierVersion(it.key()) != it.value()) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void LuaToolbox::rememberAnalysis(const qReal::Id &id, const QString &propertyName
+		, const QSharedPointer<Node> &ast)
+{
+	QSet<QString> identifiers;
+	collectIdentifiers(ast, identifiers);
+
+	AnalysisState state;
+	state.analyzerVersion = mAnalyzer->version();
+	for (const QString &identifier : identifiers) {
+		state.identifierVersions.insert(identifier, mAnalyzer->identifierVersion(identifier));
+	}
+
+	mAnalysisStates[id][propertyName] = state;
+	mReferencedIdentifiers.unite(identifiers);
+}
+
+void LuaToolbox::collectIdentifiers(const QSharedPointer<Node> &node, QSet<QString> &identifiers)
+{
+	if (!node) {
+		return;
+	}
+
+	if (node->is<qrtext::lua::ast::Identifier>()) {
+		identifiers.insert(as<qrtext::lua::ast::Identifier>(node)->name());
+	}
+
+	for (const QSharedPointer<Node> &child : node->children()) {
+		collectIdentifiers(child, identifiers);
+	}
+}
+
 void LuaToolbox::reportErrors()
 {
 	for (const qrtext::core::Error &error : mErrors) {
@@ -16,6 +16,7 @@
 
 #include <QtWidgets/QApplication>
 #include <QtCore/QTimer>
+#include <QtCore/QPointer>
 
 #include <qrkernel/settingsManager.h>
 
@@ -28,6 +29,12 @@ using namespace interpretation;
 
 const int blocksCountTillProcessingEvents = 100;
 
+/// Time in ms after which thread in fast mode returns control to event loop.
+const int fastModeTimeSlice = 10;
+
+/// Time in ms between updates of highlighting in fast mode, about one frame.
+const int highlightingInterval = 16;
+
 Thread::Thread(const GraphicalModelAssistInterface *graphicalModelApi
 		, gui::MainWindowInterpretersInterface &interpretersInterface
 		, const Id &initialNodeType
@@ -43,6 +50,8 @@ Thread::Thread(const GraphicalModelAssistInterface *graphicalModelApi
 	, mProcessEventsTimer(new QTimer(this))
 	, mProcessEventsMapper(new QSignalMapper(this))
 	, mId(threadId)
+	, mFastMode(SettingsManager::value("interpreterFastMode").toBool())
+	, mHighlightingTimer(new QTimer(this))
 {
 	initTimer();
 }
@@ -63,15 +72,23 @@ Thread::Thread(const GraphicalModelAssistInterface *graphicalModelApi
 	, mProcessEventsTimer(new QTimer(this))
 	, mProcessEventsMapper(new QSignalMapper(this))
 	, mId(threadId)
+	, mFastMode(SettingsManager::value("interpreterFastMode").toBool())
+	, mHighlightingTimer(new QTimer(this))
 {
 	initTimer();
 }
 
 Thread::~Thread()
 {
-	for (const StackFrame &frame : mStack) {
-		if (frame.block()) {
-			mInterpretersInterface.dehighlight(frame.block()->id());
+	if (mFastMode) {
+		for (const Id &block : mHighlightedBlocks) {
+			mInterpretersInterface.dehighlight(block);
+		}
+	} else {
+		for (const StackFrame &frame : mStack) {
+			if (frame.block()) {
+				mInterpretersInterface.dehighlight(frame.block()->id());
+			}
 		}
 	}
 }
@@ -85,11 +102,19 @@ void Thread::initTimer()
 
 	connect(mProcessEventsMapper, SIGNAL(mapped(QObject*))
 			, this, SLOT(interpretAfterEventsProcessing(QObject*)));
+
+	mHighlightingTimer->setSingleShot(true);
+	mHighlightingTimer->setInterval(highlightingInterval);
+	connect(mHighlightingTimer, &QTimer::timeout, this, &Thread::updateHighlighting);
 }
 
 void Thread::interpret()
 {
 	if (mCurrentBlock) {
+		if (mFastMode) {
+			linkBlocks(mCurrentBlock->id());
+		}
+
 		turnOn(mCurrentBlock);
 	} else {
 		stepInto(mInitialDiagram);
@@ -103,6 +128,10 @@ void Thread::stop(qReal::interpretation::StopReason reason)
 
 void Thread::nextBlock(const Id &blockId)
 {
+	if (isForeignSignal()) {
+		return;
+	}
+
 	turnOff(mCurrentBlock);
 	BlockInterface *const block = blockId == Id() ? nullptr : mBlocksTable.block(blockId);
 	turnOn(block);
@@ -110,6 +139,10 @@ void Thread::nextBlock(const Id &blockId)
 
 void Thread::stepInto(const Id &diagram)
 {
+	if (isForeignSignal()) {
+		return;
+	}
+
 	const Id initialNode = findStartingElement(diagram);
 	BlockInterface * const block = mBlocksTable.block(initialNode);
 
@@ -123,6 +156,10 @@ void Thread::stepInto(const Id &diagram)
 		return;
 	}
 
+	if (mFastMode && !mLinkedBlocks.contains(initialNode)) {
+		linkBlocks(initialNode);
+	}
+
 	turnOn(block);
 }
 
@@ -137,7 +174,10 @@ void Thread::finishedSteppingInto()
 
 	// If block already connected then nothing will happen because of Qt::UniquieConnection modifiers.
 	// But if it is disconnected (for example, we did it in turnOff() on recursive lifting) we should connect it back.
-	connectBlock(mCurrentBlock);
+	// In fast mode linked blocks are never disconnected.
+	if (!mFastMode) {
+		connectBlock(mCurrentBlock);
+	}
 
 	// Execution must proceed here
 	mCurrentBlock->finishedSteppingInto();
@@ -145,13 +185,17 @@ void Thread::finishedSteppingInto()
 
 void Thread::failure()
 {
+	if (isForeignSignal()) {
+		return;
+	}
+
 	emit stopped(qReal::interpretation::StopReason::error);
 }
 
 void Thread::error(const QString &message, const Id &source)
 {
 	mInterpretersInterface.errorReporter()->addError(message, source);
-	failure();
+	emit stopped(qReal::interpretation::StopReason::error);
 }
 
 Id Thread::findStartingElement(const Id &diagram) const
@@ -175,18 +219,33 @@ void Thread::turnOn(BlockInterface * const block)
 		return;
 	}
 
-	if (!mGraphicalModelApi->graphicalRepoApi().exist(block->id())) {
-		// If we get non-null block instance, but non-existing id then the block
-		// was removed from diagram during the interpretation.
-		error(tr("Block has disappeared!"));
-		return;
-	}
+	const blocks::SubprogramBlock *subprogram = nullptr;
+	if (mFastMode) {
+		const LinkedBlock * const linkedBlock = linkBlock(mCurrentBlock);
+		if (!linkedBlock) {
+			error(tr("Block has disappeared!"));
+			return;
+		}
 
-	mInterpretersInterface.highlight(mCurrentBlock->id(), false);
-	connectBlock(mCurrentBlock);
+		subprogram = linkedBlock->subprogram;
+		if (!mHighlightingTimer->isActive()) {
+			mHighlightingTimer->start();
+		}
+	} else {
+		if (!mGraphicalModelApi->graphicalRepoApi().exist(block->id())) {
+			// If we get non-null block instance, but non-existing id then the block
+			// was removed from diagram during the interpretation.
+			error(tr("Block has disappeared!"));
+			return;
+		}
+
+		mInterpretersInterface.highlight(mCurrentBlock->id(), false);
+		connectBlock(mCurrentBlock);
+
+		// Check subprogram block
+		subprogram = dynamic_cast<blocks::SubprogramBlock *>(mCurrentBlock);
+	}
 
-	// Check subprogram block
-	const blocks::SubprogramBlock * const subprogram = dynamic_cast<blocks::SubprogramBlock *>(mCurrentBlock);
 	if (subprogram) {
 		QList<QPair<QString, QVariant>> properties;
 		const QList<blocks::SubprogramBlock::DynamicParameter> parameters = subprogram->dynamicParameters();
@@ -199,6 +258,16 @@ void Thread::turnOn(BlockInterface * const block)
 		mStack.push(StackFrame(mCurrentBlock));
 	}
 
+	if (mFastMode) {
+		mPendingBlock = mCurrentBlock;
+		if (!mDispatching) {
+			mTimeSlice.start();
+			dispatch();
+		}
+
+		return;
+	}
+
 	++mBlocksSincePreviousEventsProcessing;
 	if (mBlocksSincePreviousEventsProcessing > blocksCountTillProcessingEvents) {
 		// Here we want to process all accumulated events and terminate blocks recursion
@@ -223,11 +292,144 @@ void Thread::turnOn(BlockInterface * const block)
 void Thread::interpretAfterEventsProcessing(QObject *blockObject)
 {
 	BlockInterface * const block = dynamic_cast<BlockInterface *>(blockObject);
-	if (block) {
+	if (!block) {
+		return;
+	}
+
+	if (mFastMode) {
+		mPendingBlock = block;
+		mTimeSlice.start();
+		dispatch();
+	} else {
 		block->interpret(this);
 	}
 }
 
+void Thread::dispatch()
+{
+	// A block may stop this thread and it will be deleted right away, so its fields must not be accessed then.
+	const QPointer<Thread> self(this);
+	mDispatching = true;
+	while (mPendingBlock) {
+		BlockInterface * const block = mPendingBlock;
+		mPendingBlock = nullptr;
+
+		if (mTimeSlice.elapsed() > fastModeTimeSlice) {
+			// Time slice is over, letting events (including stop requests and highlighting) to be processed.
+			mDispatching = false;
+			mProcessEventsMapper->removeMappings(mProcessEventsTimer);
+			mProcessEventsMapper->setMapping(mProcessEventsTimer, block);
+			mProcessEventsTimer->start();
+			return;
+		}
+
+		block->interpret(this);
+		if (!self) {
+			return;
+		}
+	}
+
+	mDispatching = false;
+}
+
+void Thread::linkBlocks(const Id &startBlock)
+{
+	const auto &repoApi = mGraphicalModelApi->graphicalRepoApi();
+	QSet<Id> visited = { startBlock };
+	QQueue<Id> queue;
+	queue.enqueue(startBlock);
+	while (!queue.isEmpty()) {
+		const Id id = queue.dequeue();
+		BlockInterface * const block = mBlocksTable.block(id);
+		if (block) {
+			linkBlock(block);
+		}
+
+		for (const Id &link : repoApi.outgoingLinks(id)) {
+			const Id next = repoApi.otherEntityFromLink(link, id);
+			if (!next.isNull() && next != Id::rootId() && !visited.contains(next)) {
+				visited.insert(next);
+				queue.enqueue(next);
+			}
+		}
+	}
+}
+
+const Thread::LinkedBlock *Thread::linkBlock(BlockInterface * const block)
+{
+	const auto linked = mLinkedBlocks.constFind(block->id());
+	if (linked != mLinkedBlocks.constEnd() && linked->block == block) {
+		// Blocks check existence of their ids on a diagram themselves on each execution.
+		return &linked.value();
+	}
+
+	if (!mGraphicalModelApi->graphicalRepoApi().exist(block->id())) {
+		return nullptr;
+	}
+
+	connect(block, &BlockInterface::done, this, &Thread::nextBlock);
+	connect(block, &BlockInterface::newThread, this, &Thread::relayNewThread);
+	connect(block, &BlockInterface::killThread, this, &Thread::relayKillThread);
+	connect(block, &BlockInterface::sendMessage, this, &Thread::relaySendMessage);
+	connect(block, &BlockInterface::failure, this, &Thread::failure);
+	connect(block, &BlockInterface::stepInto, this, &Thread::stepInto);
+
+	const LinkedBlock linkedBlock = { block, dynamic_cast<blocks::SubprogramBlock *>(block) };
+	return &mLinkedBlocks.insert(block->id(), linkedBlock).value();
+}
+
+bool Thread::isForeignSignal() const
+{
+	// Linked blocks stay connected to all threads that executed them, signals of blocks executed by other threads
+	// shall be ignored.
+	return mFastMode && sender() && sender() != mCurrentBlock;
+}
+
+void Thread::relayNewThread(const Id &startBlockId, const QString &threadId)
+{
+	if (!isForeignSignal()) {
+		emit newThread(startBlockId, threadId);
+	}
+}
+
+void Thread::relayKillThread(const QString &threadId)
+{
+	if (!isForeignSignal()) {
+		emit killThread(threadId);
+	}
+}
+
+void Thread::relaySendMessage(const QString &threadId, const QString &message)
+{
+	if (!isForeignSignal()) {
+		emit sendMessage(threadId, message);
+	}
+}
+
+void Thread::updateHighlighting()
+{
+	QSet<Id> blocksOnStack;
+	for (const StackFrame &frame : mStack) {
+		if (frame.block()) {
+			blocksOnStack.insert(frame.block()->id());
+		}
+	}
+
+	for (const Id &block : mHighlightedBlocks) {
+		if (!blocksOnStack.contains(block)) {
+			mInterpretersInterface.dehighlight(block);
+		}
+	}
+
+	for (const Id &block : blocksOnStack) {
+		if (!mHighlightedBlocks.contains(block)) {
+			mInterpretersInterface.highlight(block, false);
+		}
+	}
+
+	mHighlightedBlocks = blocksOnStack;
+}
+
 void Thread::turnOff(BlockInterface * const block)
 {
 	// This is a signal not from a current block of this thread.
@@ -236,7 +438,7 @@ void Thread::turnOff(BlockInterface * const block)
 		return;
 	}
 
-	if (sender()) {
+	if (sender() && !mFastMode) {
 		sender()->disconnect(this);
 	}
 
@@ -261,7 +463,9 @@ void Thread::turnOff(BlockInterface * const block)
 	}
 
 	mStack.pop();
-	mInterpretersInterface.dehighlight(block->id());
+	if (!mFastMode) {
+		mInterpretersInterface.dehighlight(block->id());
+	}
 }
 
 void Thread::connectBlock(BlockInterface * const block)
@@ -17,6 +17,9 @@
 #include <QtCore/QObject>
 #include <QtCore/QStack>
 #include <QtCore/QQueue>
+#include <QtCore/QHash>
+#include <QtCore/QSet>
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QSignalMapper>
 
 #include <qrkernel/ids.h>
@@ -35,7 +38,16 @@ class QTimer;
 namespace qReal {
 namespace interpretation {
 
+namespace blocks {
+class SubprogramBlock;
+}
+
 /// Program execution thread. Has currently executed block, and its own stack.
+///
+/// When "interpreterFastMode" setting is on, thread links all blocks reachable from its starting block when
+/// interpretation starts: their signals are connected once and their kinds are determined once. Successors are then
+/// executed in a loop instead of recursive signal-slot calls, control is returned to event loop only when time slice
+/// is over, and highlighting of executed blocks is updated once per frame.
 class QRUTILS_EXPORT Thread : public QObject
 {
 	Q_OBJECT
@@ -108,9 +120,39 @@ private slots:
 
 	void interpretAfterEventsProcessing(QObject *block);
 
+	/// Fast mode only: filter out signals of linked blocks that are not current blocks of this thread.
+	void relayNewThread(const qReal::Id &startBlockId, const QString &threadId);
+	void relayKillThread(const QString &threadId);
+	void relaySendMessage(const QString &threadId, const QString &message);
+
+	/// Fast mode only: makes highlighting on a diagram correspond to a current stack.
+	void updateHighlighting();
+
 private:
+	/// Block with information about it collected when thread is started in fast mode.
+	struct LinkedBlock
+	{
+		BlockInterface *block;
+
+		/// The same block if it is a subprogram call, nullptr otherwise.
+		const blocks::SubprogramBlock *subprogram;
+	};
+
 	void initTimer();
 
+	/// Fast mode only: links all blocks reachable from a given one by outgoing links.
+	void linkBlocks(const Id &startBlock);
+
+	/// Fast mode only: links given block if it was not linked yet.
+	/// @returns linked block or nullptr if block has disappeared from diagram.
+	const LinkedBlock *linkBlock(BlockInterface * const block);
+
+	/// Fast mode only: executes pending blocks one by one until some block waits for something or time slice ends.
+	void dispatch();
+
+	/// Fast mode only: returns true if signal is sent by some block that is not current for this thread.
+	bool isForeignSignal() const;
+
 	qReal::Id findStartingElement(const qReal::Id &diagram) const;
 	void error(const QString &message, const qReal::Id &source = qReal::Id());
 
@@ -131,6 +173,27 @@ private:
 	QSignalMapper *mProcessEventsMapper;  // Has ownership
 	QString mId;
 	QQueue<QString> mMessages;
+
+	/// True if blocks are executed in fast mode (see class description).
+	const bool mFastMode;
+
+	/// Fast mode only: linked blocks by their ids.
+	QHash<Id, LinkedBlock> mLinkedBlocks;
+
+	/// Fast mode only: block that shall be executed next by dispatch(), if any.
+	BlockInterface *mPendingBlock {};  // Doesn't have ownership
+
+	/// Fast mode only: true if dispatch() loop is running.
+	bool mDispatching = false;
+
+	/// Fast mode only: measures time since interpretation got control from event loop.
+	QElapsedTimer mTimeSlice;
+
+	/// Fast mode only: triggers updateHighlighting() once per frame.
+	QTimer *mHighlightingTimer;  // Has ownership
+
+	/// Fast mode only: blocks that are highlighted on a diagram now.
+	QSet<Id> mHighlightedBlocks;
 };
 
 }
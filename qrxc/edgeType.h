@@ -60,7 +60,7 @@ private:
 	virtual bool initDividability() override;
 	virtual bool initPortTypes() override;
 	void initPortTypes(const QDomElement &portsElement, QStringList &ports);
-	void generateEdgeStyle(const QString &styleString, utils::OutFile &out);
+	static QString arrowStyle(const QString &arrowType);
 	void generatePorts(utils::OutFile &out, const QStringList &portTypes, const QString &direction);
 	virtual bool initLabel(Label *label, const QDomElement &element, const int &count) override;
 };
@@ -117,7 +117,6 @@ void GraphicType::generateCommonData(OutFile &out) const
 	generateFriendlyName(out);
 	generateDiagram(out);
 	generateDescription(out);
-	generateLabels(out);
 }
 
 void GraphicType::generateLabels(OutFile &out) const
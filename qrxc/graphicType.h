@@ -55,6 +55,8 @@ public:
 	const QMap<QString, QPair<bool, bool>> &explosions() const;
 
 protected:
+	/// Generates assignments of the data that type descriptor gets in constructor: names and description.
+	/// Other data shall be generated into initialize() method, it will be assigned on first use of the type.
 	void generateCommonData(utils::OutFile &out) const;
 	void generateName(utils::OutFile &out) const;
 	void generateFriendlyName(utils::OutFile &out) const;
@@ -254,6 +254,12 @@ void NodeType::generateCode(OutFile &out)
 
 	generateCommonData(out);
 
+	out() << "\t\t}\n\n"
+			<< "\t\tvoid initialize() override\n"
+			<< "\t\t{\n";
+
+	generateLabels(out);
+
 	if (!mSdfDomElement.isNull()) {
 		out() << "\t\t\tloadSdf(utils::xmlUtils::loadDocument(\":/generated/shapes/"
 				+ className + "Class.sdf\").documentElement());\n";
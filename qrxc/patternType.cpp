@@ -51,6 +51,7 @@ void PatternType::generateCode(OutFile &out)
 			<< "\t\t\t: PatternType(metamodel)\n"
 			<< "\t\t{\n";
 	generateCommonData(out);
+	generateLabels(out);
 	out() << "\t\t\tsetXml(QString::fromUtf8(\"" << mXml << "\"));\n"
 			<< "\t\t}\n\n";
 